@@ -1,63 +1,304 @@
 // applications/backtest_app/main.cpp
-#include "winter/core/engine.hpp"
-#include "winter/strategy/strategy_factory.hpp"
-#include "winter/utils/config.hpp"
-#include "winter/utils/logger.hpp"
-#include "winter/backtest/backtest_engine.hpp"
+#include <winter/backtest/backtest_engine.hpp>
+#include <winter/backtest/csv_loader.hpp>
+#include <winter/backtest/multi_strategy_backtest.hpp>
+#include <winter/backtest/report.hpp>
+#include <winter/runtime/ingest.hpp>
+#include <winter/strategy/strategy_factory.hpp>
+#include <winter/utils/config_parser.hpp>
+#include <winter/utils/logger.hpp>
+#include <winter/utils/thread_pool.hpp>
+#include <winter/utils/tsc_clock.hpp>
+#include "strategies/mean_reversion_strategy.hpp"
+#include "strategies/stat_arbitrage.hpp"
+#include "examples/strategy_ma_strategy/simple_ma_strategy.hpp"
+
+#include <filesystem>
+#include <iomanip>
 #include <iostream>
-#include <string>
 #include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+// winter-backtest: batch backtests over recorded ticks.
+//
+// Loads one or more data files (CSV tape or binary tick store), builds the
+// requested strategies with their parameters from winter_config.yaml, replays
+// the ticks and writes metrics.json, trades.csv and report.html.
+//
+// Modes:
+//   lanes    one pass over the data, every strategy in its own portfolio
+//            (MultiStrategyBacktest); the default
+//   engine   the threaded Engine fed in parallel batch views, strategies
+//            sharing one portfolio (BacktestEngine)
+//   ordered  the threaded Engine fed strictly in file order
+//
+// Usage: winter-backtest [options] <data files...>
+
+namespace {
+
+struct Options {
+    std::vector<std::string> data_files;
+    std::vector<std::string> strategies;  // Empty: the config's enabled_strategies
+    std::string config_file = "winter_config.yaml";
+    bool explicit_config = false;         // --config given: the file must exist
+    std::string output_dir = "./backtest_results";
+    std::string save_ticks;               // Write the loaded ticks as a tick store
+    std::string mode = "lanes";
+    double capital = 5000000.0;
+    size_t threads = 0;                   // 0: one per hardware thread
+    bool profile = false;
+};
+
+void print_usage(const char* program) {
+    std::cerr << "Usage: " << program << " [options] <data files...>\n"
+              << "  --strategies A,B      strategy types to run (default: enabled_strategies)\n"
+              << "  --config FILE         YAML parameter file (default: winter_config.yaml if present)\n"
+              << "  --capital N           initial capital per portfolio (default: 5000000)\n"
+              << "  --threads N           worker threads (default: hardware threads)\n"
+              << "  --mode M              lanes | engine | ordered (default: lanes)\n"
+              << "  --profile             add phase timings, throughput and peak RSS to metrics.json\n"
+              << "  --output-dir DIR      where results go (default: ./backtest_results)\n"
+              << "  --save-ticks FILE     also save the loaded ticks as a binary tick store\n"
+              << "Registered strategies:";
+    for (const auto& type : winter::strategy::StrategyFactory::get_registered_types()) {
+        std::cerr << " " << type;
+    }
+    std::cerr << std::endl;
+}
+
+std::vector<std::string> split_list(const std::string& list) {
+    std::vector<std::string> items;
+    std::stringstream ss(list);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+bool parse_options(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        try {
+            if (arg == "--strategies" && has_value) {
+                options.strategies = split_list(argv[++i]);
+            } else if (arg == "--config" && has_value) {
+                options.config_file = argv[++i];
+                options.explicit_config = true;
+            } else if (arg == "--capital" && has_value) {
+                options.capital = std::stod(argv[++i]);
+            } else if (arg == "--threads" && has_value) {
+                options.threads = std::stoul(argv[++i]);
+            } else if (arg == "--mode" && has_value) {
+                options.mode = argv[++i];
+            } else if (arg == "--output-dir" && has_value) {
+                options.output_dir = argv[++i];
+            } else if (arg == "--save-ticks" && has_value) {
+                options.save_ticks = argv[++i];
+            } else if (arg == "--profile") {
+                options.profile = true;
+            } else if (arg.rfind("--", 0) == 0) {
+                return false;
+            } else {
+                options.data_files.push_back(arg);
+            }
+        } catch (const std::exception&) {
+            std::cerr << "Invalid value for " << arg << std::endl;
+            return false;
+        }
+    }
+    if (options.mode != "lanes" && options.mode != "engine" && options.mode != "ordered") {
+        std::cerr << "Unknown mode: " << options.mode << std::endl;
+        return false;
+    }
+    return !options.data_files.empty();
+}
+
+long peak_rss_kb() {
+#ifndef _WIN32
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+#else
+    return 0;
+#endif
+}
+
+// Milliseconds per phase, measured on the TSC
+class PhaseTimer {
+public:
+    void start() { start_ = winter::utils::tsc_now(); }
+    void stop(const std::string& phase) {
+        double ms = winter::utils::TscClock::instance().elapsed_ns(start_, winter::utils::tsc_now()) / 1e6;
+        phases_.emplace_back(phase + "_ms", ms);
+    }
+    double total_ms(const std::string& phase) const {
+        for (const auto& [name, ms] : phases_) {
+            if (name == phase + "_ms") return ms;
+        }
+        return 0.0;
+    }
+    const std::vector<std::pair<std::string, double>>& phases() const { return phases_; }
+
+private:
+    uint64_t start_ = 0;
+    std::vector<std::pair<std::string, double>> phases_;
+};
+
+std::string join(const std::vector<std::string>& items, const char* separator) {
+    std::string out;
+    for (const auto& item : items) {
+        out += (out.empty() ? "" : separator) + item;
+    }
+    return out;
+}
+
+} // namespace
 
 int main(int argc, char** argv) {
-    try {
-        // Load configuration
-        auto config = winter::utils::Config::instance();
-        if (!config->load_from_file("winter.conf")) {
-            std::cerr << "Failed to load configuration file. Using defaults." << std::endl;
-        }
-        
-        // Create backtest engine
-        winter::backtest::BacktestEngine backtest;
-        
-        // Load data
-        std::string data_file = config->get("data_file", "data.csv");
-        if (!backtest.load_data(data_file)) {
-            std::cerr << "Failed to load data from " << data_file << std::endl;
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    // The pool is sized before anything starts it
+    size_t threads = options.threads > 0 ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+    winter::utils::ThreadPool::configure_shared(threads, -1);
+
+    winter::utils::WinterConfig config;
+    std::string error;
+    // Only the implicit default may be missing
+    bool have_config = options.explicit_config || std::filesystem::exists(options.config_file);
+    if (have_config && !winter::utils::WinterConfig::load(options.config_file, config, error)) {
+        std::cerr << error << std::endl;
+        return 1;
+    }
+    if (options.strategies.empty()) {
+        options.strategies = config.enabled_strategies;
+    }
+    if (options.strategies.empty()) {
+        std::cerr << "No strategies given and no enabled_strategies in " << options.config_file << std::endl;
+        return 1;
+    }
+
+    // Lanes need one instance each; the engine modes share a portfolio between them
+    std::vector<winter::strategy::StrategyPtr> strategies;
+    for (const auto& type : options.strategies) {
+        auto strategy = winter::strategy::StrategyFactory::create_configured(type, config.parameters_for(type));
+        if (!strategy) {
+            std::cerr << "Could not create strategy: " << type << std::endl;
             return 1;
         }
-        
-        // Create strategy
-        std::string strategy_type = config->get("strategy_type", "SimpleMAStrategy");
-        auto strategy = winter::strategy::StrategyFactory::create_strategy(strategy_type);
-        if (!strategy) {
-            std::cerr << "Failed to create strategy of type " << strategy_type << std::endl;
+        strategies.push_back(strategy);
+    }
+
+    PhaseTimer timer;
+    timer.start();
+    std::vector<winter::core::MarketData> ticks;
+    if (!winter::runtime::load_ticks(options.data_files, ticks) || ticks.empty()) {
+        std::cerr << "No market data loaded" << std::endl;
+        return 1;
+    }
+    timer.stop("load");
+    if (!options.save_ticks.empty() && !winter::backtest::save_market_data_binary(options.save_ticks, ticks)) {
+        return 1;
+    }
+
+    winter::backtest::BacktestConfiguration backtest_config;
+    backtest_config.thread_count = threads;
+    backtest_config.ordered_feed = options.mode == "ordered";
+
+    std::vector<winter::backtest::StrategyResult> results;
+    const size_t tick_count = ticks.size();
+
+    if (options.mode == "lanes") {
+        winter::backtest::MultiStrategyBacktest backtest;
+        backtest.configure(backtest_config);
+        for (auto& strategy : strategies) {
+            backtest.add_strategy(strategy);
+        }
+        backtest.initialize(options.capital);
+        backtest.set_data(ticks);
+
+        timer.start();
+        if (!backtest.run()) {
+            return 1;
+        }
+        timer.stop("run");
+        results = backtest.get_results();
+        backtest.print_comparison();
+    } else {
+        winter::backtest::BacktestEngine backtest;
+        // Keep the engine's own queue and fill settings
+        backtest_config.engine_config = backtest.get_config().engine_config;
+        backtest.configure(backtest_config);
+        backtest.initialize(options.capital);
+        for (auto& strategy : strategies) {
+            backtest.add_strategy(strategy);
+        }
+        backtest.set_data(std::move(ticks));
+
+        timer.start();
+        if (!backtest.run_backtest()) {
             return 1;
         }
-        
-        // Configure strategy
-        std::unordered_map<std::string, std::string> strategy_config;
-        strategy_config["fast_period"] = config->get("fast_period", "10");
-        strategy_config["slow_period"] = config->get("slow_period", "30");
-        strategy->configure(strategy_config);
-        
-        // Add strategy to backtest
-        backtest.add_strategy(strategy);
-        
-        // Run backtest
-        std::cout << "Running backtest..." << std::endl;
-        backtest.run();
-        
-        // Display results
-        auto results = backtest.get_results();
-        std::cout << "Backtest completed." << std::endl;
-        std::cout << "Total trades: " << results.total_trades << std::endl;
-        std::cout << "Win rate: " << (results.win_rate * 100.0) << "%" << std::endl;
-        std::cout << "Profit factor: " << results.profit_factor << std::endl;
-        std::cout << "Sharpe ratio: " << results.sharpe_ratio << std::endl;
-        
-        return 0;
-    } catch (const std::exception& e) {
-        std::cerr << "Error: " << e.what() << std::endl;
+        timer.stop("run");
+
+        winter::backtest::StrategyResult combined;
+        combined.strategy_name = join(options.strategies, "+");
+        combined.metrics = backtest.calculate_performance_metrics();
+        combined.equity_curve = backtest.get_equity_curve();
+        combined.trades = backtest.get_trades();
+        combined.orders_executed = combined.trades.size();
+        results.push_back(std::move(combined));
+    }
+
+    // One journal and one report per result, named after the strategy when there are several
+    timer.start();
+    std::filesystem::create_directories(options.output_dir);
+    const std::filesystem::path dir(options.output_dir);
+    for (const auto& result : results) {
+        auto file = [&](const std::string& name) {
+            return (dir / winter::backtest::result_file_name(name, result, results.size())).string();
+        };
+        winter::backtest::write_trades_csv(file("trades.csv"), result.trades);
+        winter::backtest::write_html_report(file("report.html"), result.metrics, result.equity_curve,
+                                            join(options.data_files, ", "));
+    }
+
+    winter::backtest::RunSummary summary;
+    summary.mode = options.mode;
+    summary.data_files = options.data_files;
+    summary.ticks = tick_count;
+    summary.threads = threads;
+    timer.stop("report");
+    if (options.profile) {
+        summary.profile = timer.phases();
+        double run_seconds = timer.total_ms("run") / 1000.0;
+        summary.profile.emplace_back("ticks_per_second", run_seconds > 0 ? tick_count / run_seconds : 0.0);
+        summary.profile.emplace_back("peak_rss_kb", static_cast<double>(peak_rss_kb()));
+    }
+    std::string metrics_file = (dir / "metrics.json").string();
+    if (!winter::backtest::write_metrics_json(metrics_file, summary, results)) {
         return 1;
     }
+
+    std::cout << "\nResults written to " << options.output_dir << std::endl;
+    if (options.profile) {
+        for (const auto& [name, value] : summary.profile) {
+            std::cout << "  " << name << ": " << std::fixed << std::setprecision(1) << value << std::endl;
+        }
+    }
+    return 0;
 }
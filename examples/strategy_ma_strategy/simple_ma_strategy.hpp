@@ -2,33 +2,55 @@
 #pragma once
 #include "winter/strategy/enhanced_strategy_base.hpp"
 #include "winter/strategy/strategy_factory.hpp"
+#include "winter/utils/typed_config.hpp"
 
 namespace winter {
 namespace examples {
 
+struct SimpleMAParams {
+    int fast_period = 10;
+    int slow_period = 30;  // At most the base class's price history
+
+    static const utils::ConfigSchema<SimpleMAParams>& schema() {
+        using P = SimpleMAParams;
+        static const auto schema = utils::ConfigSchema<P>()
+            .field("fast_period", &P::fast_period, 1, 1000)
+            .field("slow_period", &P::slow_period, 1, 1000)
+            .check("fast_period < slow_period", [](const P& p) { return p.fast_period < p.slow_period; });
+        return schema;
+    }
+};
+
 class SimpleMAStrategy : public strategy::EnhancedStrategyBase {
 public:
-    SimpleMAStrategy() : EnhancedStrategyBase("SimpleMAStrategy") {}
+    SimpleMAStrategy(const std::string& name = "SimpleMAStrategy") : EnhancedStrategyBase(name) {}
+    
+    // Periods take effect on the next tick, so config reloads apply while running
+    bool configure(const std::unordered_map<std::string, std::string>& config) override {
+        return configure_params(params_, config);
+    }
+    
+    bool validate_config(const std::unordered_map<std::string, std::string>& config,
+                         std::vector<std::string>& errors) const override {
+        return validate_params<SimpleMAParams>(config, errors);
+    }
+    
+    const SimpleMAParams& params() const { return params_.get(); }
     
     void initialize() override {
-        // Get parameters from configuration
-        fast_period_ = std::stoi(get_config("fast_period", "10"));
-        slow_period_ = std::stoi(get_config("slow_period", "30"));
-        
-        log_message("Initialized with fast_period=" + std::to_string(fast_period_) + 
-                   ", slow_period=" + std::to_string(slow_period_));
+        log_message("Initialized with fast_period=" + std::to_string(params_->fast_period) + 
+                   ", slow_period=" + std::to_string(params_->slow_period));
     }
     
-    std::vector<core::Signal> generate_signals(const core::MarketData& data) override {
-        std::vector<core::Signal> signals;
-        
+    void generate_signals_into(const core::MarketData& data, std::vector<core::Signal>& signals) override {
         // Calculate moving averages
-        double fast_ma = calculate_sma(data.symbol, fast_period_);
-        double slow_ma = calculate_sma(data.symbol, slow_period_);
+        const SimpleMAParams& params = params_.get();
+        double fast_ma = calculate_sma(data.symbol, params.fast_period);
+        double slow_ma = calculate_sma(data.symbol, params.slow_period);
         
         // Skip if we don't have enough data
         if (fast_ma == 0.0 || slow_ma == 0.0) {
-            return signals;
+            return;
         }
         
         // Get current position
@@ -38,19 +60,18 @@ public:
         if (fast_ma > slow_ma && position <= 0) {
             // Buy signal
             signals.push_back(create_buy_signal(data.symbol, data.price));
-            log_message("BUY signal for " + data.symbol + " at " + std::to_string(data.price));
+            utils::Logger::debug() << "[" << name() << "] BUY signal for " << data.symbol << " at " << data.price
+                                   << utils::Logger::endl;
         } else if (fast_ma < slow_ma && position >= 0) {
             // Sell signal
             signals.push_back(create_sell_signal(data.symbol, data.price));
-            log_message("SELL signal for " + data.symbol + " at " + std::to_string(data.price));
+            utils::Logger::debug() << "[" << name() << "] SELL signal for " << data.symbol << " at " << data.price
+                                   << utils::Logger::endl;
         }
-        
-        return signals;
     }
     
 private:
-    int fast_period_ = 10;
-    int slow_period_ = 30;
+    utils::ConfigSnapshot<SimpleMAParams> params_;
 };
 
 // Register the strategy with the factory
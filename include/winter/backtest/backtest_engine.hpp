@@ -2,6 +2,7 @@
 
 #include <winter/core/engine.hpp>
 #include <winter/core/market_data.hpp>
+#include <winter/backtest/monte_carlo.hpp>
 #include <winter/utils/logger.hpp>
 #include <string>
 #include <vector>
@@ -19,6 +20,7 @@
 #include <execution>
 #include <optional>
 #include <deque>
+#include <functional>
 #include <unordered_map>
 
 namespace winter::backtest {
@@ -72,9 +74,12 @@ struct EquityPoint {
     std::string trade_type; // "BUY", "SELL", or empty for regular equity point
 };
 
+// Observes each executed order with the event time of the tick behind it
+using FillCallback = std::function<void(const winter::core::Order& executed, int64_t event_us)>;
+
 // Backtest configuration
 struct BacktestConfiguration {
-    // Parallelism settings
+    // Parallelism settings; work is split this many ways on the shared ThreadPool
     size_t thread_count = std::thread::hardware_concurrency();
     size_t batch_size = 10000;
     
@@ -107,6 +112,14 @@ struct BacktestConfiguration {
     bool generate_equity_curve = true;
     bool generate_trade_list = true;
     std::string output_directory = "./backtest_results";
+    
+    // Checkpointing: empty path disables it. Checkpointed runs feed ticks through
+    // a single ordered producer so the tick offset is a valid resume point.
+    std::string checkpoint_path;
+    double checkpoint_interval_seconds = 60.0;
+    
+    // Use that ordered producer even without a checkpoint (slower, deterministic equity curve)
+    bool ordered_feed = false;
 };
 
 class PerformanceAnalyzer {
@@ -155,24 +168,28 @@ private:
     BacktestConfiguration config_;
     PerformanceAnalyzer performance_analyzer_;
     
-    // Thread pool for parallel processing
-    std::vector<std::thread> worker_threads_;
-    
     // Active trades tracking
     std::unordered_map<std::string, Trade> active_trades_;
     std::vector<Trade> completed_trades_;
     std::mutex trades_mutex_;
     
     // Helper methods
-    bool load_csv_data(const std::string& csv_file);
-    bool load_parquet_data(const std::string& parquet_file); // NEW
-    double calculate_sharpe_ratio(const std::vector<double>& returns, double risk_free_rate = 0.0);
-    double calculate_max_drawdown(const std::vector<EquityPoint>& equity_curve, double& duration);
+    static std::vector<double> extract_period_returns(const std::vector<EquityPoint>& equity_curve, double initial_capital);
+    static double calculate_sharpe_ratio(const std::vector<double>& returns, double risk_free_rate = 0.0);
+    static double calculate_max_drawdown(const std::vector<EquityPoint>& equity_curve, double& duration);
     void generate_html_report(const std::string& output_file, const PerformanceMetrics& metrics);
     void export_trades_to_csv(const std::string& csv_file);
     
+    // Tick offset restored from a checkpoint
+    size_t resume_offset_ = 0;
+    FillCallback fill_callback_;
+    
     // Process a chunk of data in parallel
     void process_data_chunk(size_t start, size_t end);
+    // Feed [start, end) in order without dropping, recording equity after each batch drains
+    void process_data_ordered(size_t start, size_t end);
+    void save_checkpoint_state(winter::utils::BinaryWriter& out);
+    bool load_checkpoint_state(winter::utils::BinaryReader& in);
     
     // Event handlers
     void on_order_executed(const winter::core::Order& order);
@@ -191,18 +208,32 @@ public:
     
     // Initialization
     bool initialize(double initial_capital);
+    // CSV tape or binary tick store (see csv_loader.hpp)
     bool load_data(const std::string& data_file);
+    void set_data(std::vector<winter::core::MarketData> data);
     bool add_strategy(std::shared_ptr<winter::strategy::StrategyBase> strategy);
+    // Runs on the engine's execution thread, in fill order
+    void set_fill_callback(FillCallback callback) { fill_callback_ = std::move(callback); }
     
     // Execution
     bool run_backtest();
+    // Restores engine, strategy and equity state; the next run_backtest continues from the saved tick
+    bool resume_from_checkpoint(const std::string& checkpoint_file);
     void stop_backtest();
     
     // Results
     PerformanceMetrics calculate_performance_metrics();
+    static PerformanceMetrics compute_metrics(const std::vector<EquityPoint>& equity_curve,
+                                              const std::vector<winter::core::Trade>& trades,
+                                              double initial_capital);
     bool generate_report(const std::string& output_file);
+    
+    // Robustness analysis: resamples closed-trade P&L, or period returns of the equity curve
+    MonteCarloResult run_monte_carlo(const MonteCarloConfiguration& config, bool resample_trades = true);
     const std::vector<EquityPoint>& get_equity_curve() const { return equity_curve_; }
     const std::vector<Trade>& get_completed_trades() const { return completed_trades_; }
+    const std::vector<winter::core::MarketData>& get_historical_data() const { return historical_data_; }
+    const std::vector<winter::core::Trade>& get_trades() { return engine_.portfolio().get_trades(); }
     
     // Progress tracking
     double get_progress() const;
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <winter/core/market_data.hpp>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace winter::backtest {
+
+constexpr int64_t TAPE_DAY_US = 24LL * 3600 * 1000000;
+
+// Loads a trade tape in the "Time,Symbol,Market Center,Price,Size,..." format.
+// Tick timestamps are the Time column in microseconds since midnight. Rows
+// keep their file order, which breaks ties between equal times.
+bool load_market_data_csv(const std::string& csv_file, std::vector<winter::core::MarketData>& data);
+
+// Parses one tape row; nullopt for headers and malformed rows
+std::optional<winter::core::MarketData> parse_market_data_line(const std::string& line);
+
+// Tape time of day, "HH:MM:SS" with an optional fraction, as microseconds
+// since midnight; false if the text is anything else
+bool parse_tape_time(std::string_view text, int64_t& us);
+// "HH:MM:SS.ffffff" for a tape timestamp; whole days are dropped
+std::string format_tape_time(int64_t us);
+
+// Compact binary tick store: a symbol table followed by fixed-size records.
+// Loads much faster than re-parsing the CSV; native byte order, like snapshots.
+bool save_market_data_binary(const std::string& file, const std::vector<winter::core::MarketData>& data);
+bool load_market_data_binary(const std::string& file, std::vector<winter::core::MarketData>& data);
+
+// Loads either format, telling them apart by the tick store header
+bool load_market_data(const std::string& file, std::vector<winter::core::MarketData>& data);
+
+} // namespace winter::backtest
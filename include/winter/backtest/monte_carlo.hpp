@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace winter::backtest {
+
+// Methods apply to either input (period returns or trade P&L)
+enum class ResamplingMethod {
+    BOOTSTRAP,        // IID resampling with replacement
+    BLOCK_BOOTSTRAP,  // Moving-block resampling, keeps short-range autocorrelation
+    RESHUFFLE         // Random permutation of the original sequence (path risk only)
+};
+
+struct MonteCarloConfiguration {
+    size_t simulations = 10000;
+    ResamplingMethod method = ResamplingMethod::BOOTSTRAP;
+    size_t block_size = 5;                 // Only used by BLOCK_BOOTSTRAP
+    size_t thread_count = std::thread::hardware_concurrency();  // Chunks handed to the shared ThreadPool
+    uint64_t seed = 42;
+    double confidence_level = 0.95;
+    int periods_per_year = 252;            // Annualization factor for the Sharpe ratio
+};
+
+struct ConfidenceInterval {
+    double lower = 0.0;
+    double median = 0.0;
+    double upper = 0.0;
+    double mean = 0.0;
+};
+
+struct MonteCarloResult {
+    size_t simulations = 0;
+    double confidence_level = 0.0;
+    ConfidenceInterval sharpe_ratio;
+    ConfidenceInterval max_drawdown_pct;
+    ConfidenceInterval terminal_equity;
+    double probability_of_loss = 0.0;      // Share of paths ending below initial capital
+    double elapsed_ms = 0.0;
+};
+
+// Parallel resampling of backtest results.
+//
+// Simulation i always draws from Philox stream i, so results depend only on the
+// seed and the simulation count, never on the number of worker threads.
+class MonteCarloEngine {
+private:
+    MonteCarloConfiguration config_;
+
+    MonteCarloResult run(const std::vector<double>& samples, double initial_capital, bool samples_are_pnl);
+
+public:
+    explicit MonteCarloEngine(const MonteCarloConfiguration& config = MonteCarloConfiguration());
+
+    void configure(const MonteCarloConfiguration& config) { config_ = config; }
+    const MonteCarloConfiguration& get_config() const { return config_; }
+
+    // Resample period returns (fractions, e.g. 0.01 for +1%)
+    MonteCarloResult run_on_returns(const std::vector<double>& returns, double initial_capital);
+
+    // Resample closed-trade P&L in currency units
+    MonteCarloResult run_on_trades(const std::vector<double>& trade_pnl, double initial_capital);
+
+    static std::string to_string(ResamplingMethod method);
+};
+
+} // namespace winter::backtest
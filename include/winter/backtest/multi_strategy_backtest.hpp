@@ -0,0 +1,79 @@
+#pragma once
+
+#include <winter/backtest/backtest_engine.hpp>
+#include <winter/core/clock.hpp>
+#include <winter/core/market_data.hpp>
+#include <winter/core/portfolio.hpp>
+#include <winter/strategy/strategy_base.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace winter::backtest {
+
+// Per-strategy outcome of a shared-pass backtest
+struct StrategyResult {
+    std::string strategy_name;
+    PerformanceMetrics metrics;
+    std::vector<EquityPoint> equity_curve;
+    std::vector<winter::core::Trade> trades;
+    size_t signals = 0;
+    size_t orders_executed = 0;
+    size_t orders_rejected = 0;
+};
+
+// Replays one tick store through K independent strategy+portfolio lanes.
+//
+// The data is walked once in batches of config.batch_size; for every batch all
+// lanes run in parallel on the shared ThreadPool and all finish before the
+// next batch starts, so the batch stays hot in the shared cache while each lane keeps
+// isolated cash and positions. Orders are filled synchronously with the same
+// sizing and fill rules as the threaded Engine (see core/execution.hpp).
+class MultiStrategyBacktest {
+private:
+    struct Lane {
+        winter::strategy::StrategyPtr strategy;
+        FillCallback on_fill;
+        winter::core::Portfolio portfolio;
+        // Per-lane event time; lanes walk the same batch at different speeds
+        std::shared_ptr<winter::core::SimulatedClock> clock = std::make_shared<winter::core::SimulatedClock>();
+        std::vector<EquityPoint> equity_curve;
+        std::vector<winter::core::Signal> signal_buffer;  // Reused across ticks
+        size_t signals = 0;
+        size_t orders_executed = 0;
+        size_t orders_rejected = 0;
+    };
+
+    std::vector<std::unique_ptr<Lane>> lanes_;
+    std::vector<winter::core::MarketData> owned_data_;
+    const std::vector<winter::core::MarketData>* data_ = &owned_data_;
+    BacktestConfiguration config_;
+    double initial_capital_ = 0.0;
+
+    void process_batch(Lane& lane, size_t begin, size_t end);
+
+public:
+    MultiStrategyBacktest() = default;
+
+    void configure(const BacktestConfiguration& config) { config_ = config; }
+    const BacktestConfiguration& get_config() const { return config_; }
+
+    // Resets every lane's portfolio to the given capital
+    bool initialize(double initial_capital);
+
+    // Each strategy gets its own lane; instances must not be shared between lanes.
+    // on_fill runs on whichever worker walks the lane, never concurrently with itself.
+    bool add_strategy(winter::strategy::StrategyPtr strategy, FillCallback on_fill = {});
+    size_t strategy_count() const { return lanes_.size(); }
+
+    // Load ticks (CSV or binary tick store), or replay a store owned by someone else (e.g. a BacktestEngine)
+    bool load_data(const std::string& data_file);
+    void set_data(const std::vector<winter::core::MarketData>& data) { data_ = &data; }
+
+    bool run();
+
+    std::vector<StrategyResult> get_results() const;
+    void print_comparison() const;
+};
+
+} // namespace winter::backtest
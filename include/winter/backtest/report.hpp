@@ -0,0 +1,39 @@
+#pragma once
+
+#include <winter/backtest/backtest_engine.hpp>
+#include <winter/backtest/multi_strategy_backtest.hpp>
+#include <winter/core/portfolio.hpp>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace winter::backtest {
+
+// Result files shared by BacktestEngine, MultiStrategyBacktest and the command
+// line tools. Each returns false (and logs) when the file cannot be written.
+
+// Equity chart and metrics page; chart data goes to a .data.js file next to it
+bool write_html_report(const std::string& html_file, const PerformanceMetrics& metrics,
+                       const std::vector<EquityPoint>& equity_curve, const std::string& period);
+
+// Trades journal: one row per fill, realized P&L on sells
+bool write_trades_csv(const std::string& csv_file, const std::vector<winter::core::Trade>& trades);
+
+// Run-level facts written next to the per-strategy metrics
+struct RunSummary {
+    std::string mode;
+    std::vector<std::string> data_files;
+    size_t ticks = 0;
+    size_t threads = 0;
+    std::vector<std::pair<std::string, double>> profile;  // Empty unless profiling
+};
+
+bool write_metrics_json(const std::string& json_file, const RunSummary& run,
+                        const std::vector<StrategyResult>& results);
+
+// Name of a per-result file: `file` when there is one result, otherwise
+// prefixed with the strategy name so side-by-side lanes do not overwrite each other
+std::string result_file_name(const std::string& file, const StrategyResult& result, size_t result_count);
+
+} // namespace winter::backtest
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <winter/utils/buffered_writer.hpp>
+#include <winter/utils/downsample.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstddef>
+#include <type_traits>
+
+namespace winter::backtest {
+
+// Streams chart data for HTML reports into a separate data file.
+//
+// The data file is a single JSON object assigned to `window.WINTER_REPORT`, so
+// the report page can load it with a plain <script src> even from file://.
+// Series are downsampled with LTTB while being written, so memory use is bounded
+// by max_points and the writer's fixed-size output buffer, not by the input size.
+class ReportWriter {
+private:
+    std::string data_file_;
+    winter::utils::BufferedWriter out_;
+    size_t max_points_;
+    bool first_field_ = true;
+
+    // Indices picked for the current series; bounded by max_points_
+    std::vector<size_t> selected_;
+
+    void begin_field(std::string_view name);
+
+    template<typename XFn, typename YFn, typename LabelFn>
+    void write_selected(std::string_view name, XFn& x, YFn& y, LabelFn& label) {
+        begin_field(name);
+        out_.write("{\"x\":[");
+        for (size_t k = 0; k < selected_.size(); ++k) {
+            if (k) out_.write(',');
+            out_.write_double(static_cast<double>(x(selected_[k])));
+        }
+        out_.write("],\"y\":[");
+        for (size_t k = 0; k < selected_.size(); ++k) {
+            if (k) out_.write(',');
+            out_.write_double(static_cast<double>(y(selected_[k])));
+        }
+        if constexpr (!std::is_same_v<std::decay_t<LabelFn>, std::nullptr_t>) {
+            out_.write("],\"label\":[");
+            for (size_t k = 0; k < selected_.size(); ++k) {
+                if (k) out_.write(',');
+                out_.write_json_string(label(selected_[k]));
+            }
+        }
+        out_.write("]}");
+    }
+
+public:
+    static constexpr size_t DEFAULT_MAX_POINTS = 2000;
+
+    explicit ReportWriter(const std::string& html_file, size_t max_points = DEFAULT_MAX_POINTS);
+    ~ReportWriter();
+
+    // "report.html" -> "report.data.js"
+    static std::string data_file_for(const std::string& html_file);
+
+    bool is_open() const { return out_.is_open(); }
+    const std::string& data_file() const { return data_file_; }
+
+    // Data file name relative to the HTML report, for the <script src> tag
+    std::string data_script_src() const;
+
+    // Scalar fields
+    void number(std::string_view name, double value);
+    void text(std::string_view name, std::string_view value);
+
+    // Downsampled series: {"x":[...],"y":[...]} with at most max_points entries
+    template<typename XFn, typename YFn>
+    void series(std::string_view name, size_t n, XFn&& x, YFn&& y) {
+        series(name, n, x, y, nullptr);
+    }
+
+    // Downsampled series carrying a per-point label: {"x":[...],"y":[...],"label":[...]}
+    template<typename XFn, typename YFn, typename LabelFn>
+    void series(std::string_view name, size_t n, XFn&& x, YFn&& y, LabelFn&& label) {
+        selected_.clear();
+        winter::utils::lttb_downsample(n, max_points_, x, y,
+                                       [this](size_t i) { selected_.push_back(i); });
+        write_selected(name, x, y, label);
+    }
+
+    // Sparse markers (e.g. trades): every point matching `include`, thinned with a
+    // uniform stride when there are more than max_points of them
+    template<typename IncludeFn, typename XFn, typename YFn, typename LabelFn>
+    void markers(std::string_view name, size_t n, IncludeFn&& include,
+                 XFn&& x, YFn&& y, LabelFn&& label) {
+        size_t matches = 0;
+        for (size_t i = 0; i < n; ++i) {
+            if (include(i)) ++matches;
+        }
+        const size_t stride = matches > max_points_ ? (matches + max_points_ - 1) / max_points_ : 1;
+
+        selected_.clear();
+        size_t seen = 0;
+        for (size_t i = 0; i < n; ++i) {
+            if (include(i) && (seen++ % stride) == 0) selected_.push_back(i);
+        }
+        write_selected(name, x, y, label);
+    }
+
+    // Small categorical data written in full: {"label":[...],"y":[...]}
+    template<typename LabelFn, typename YFn>
+    void categories(std::string_view name, size_t n, LabelFn&& label, YFn&& y) {
+        begin_field(name);
+        out_.write("{\"label\":[");
+        for (size_t i = 0; i < n; ++i) {
+            if (i) out_.write(',');
+            out_.write_json_string(label(i));
+        }
+        out_.write("],\"y\":[");
+        for (size_t i = 0; i < n; ++i) {
+            if (i) out_.write(',');
+            out_.write_double(static_cast<double>(y(i)));
+        }
+        out_.write("]}");
+    }
+
+    // Terminates the JSON object and closes the file
+    bool close();
+};
+
+} // namespace winter::backtest
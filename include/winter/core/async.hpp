@@ -0,0 +1,300 @@
+#pragma once
+
+#include <winter/core/clock.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace winter::core {
+
+class Executor;
+
+namespace detail {
+
+struct PromiseBase {
+    std::coroutine_handle<> continuation;
+    std::exception_ptr error;
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    // Hands control straight back to whoever awaited the task
+    struct FinalAwaiter {
+        bool await_ready() noexcept { return false; }
+        template<typename P>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<P> handle) noexcept {
+            auto next = handle.promise().continuation;
+            return next ? next : std::noop_coroutine();
+        }
+        void await_resume() noexcept {}
+    };
+    FinalAwaiter final_suspend() noexcept { return {}; }
+
+    void unhandled_exception() { error = std::current_exception(); }
+};
+
+template<typename T>
+struct Promise : PromiseBase {
+    std::optional<T> value;
+    void return_value(T v) { value.emplace(std::move(v)); }
+    T take() {
+        if (error) std::rethrow_exception(error);
+        return std::move(*value);
+    }
+};
+
+template<>
+struct Promise<void> : PromiseBase {
+    void return_void() {}
+    void take() {
+        if (error) std::rethrow_exception(error);
+    }
+};
+
+} // namespace detail
+
+// Lazily started coroutine; runs when awaited and resumes its awaiter on
+// completion. Exceptions propagate to the awaiter.
+template<typename T = void>
+class Task {
+public:
+    struct promise_type : detail::Promise<T> {
+        Task get_return_object() { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+    };
+
+    Task() = default;
+    Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            if (handle_) handle_.destroy();
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+    ~Task() {
+        if (handle_) handle_.destroy();
+    }
+
+    bool await_ready() const noexcept { return !handle_ || handle_.done(); }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiter) noexcept {
+        handle_.promise().continuation = awaiter;
+        return handle_;
+    }
+    T await_resume() { return handle_.promise().take(); }
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+    std::coroutine_handle<promise_type> handle_;
+};
+
+// Single-threaded coroutine scheduler: a ready queue, timers on a Clock and
+// file-descriptor readiness, all multiplexed through one poll() call. The
+// thread can be pinned to a core, and it sleeps in poll() when there is
+// nothing to run instead of spinning. Windows has no poll() over arbitrary
+// descriptors, so there the loop sleeps on a condition variable and
+// readable() wakes its awaiter every few milliseconds instead.
+//
+// post() may be called from any thread. sleep_until(), sleep_for() and
+// readable() must be awaited from a coroutine running on this executor.
+class Executor {
+public:
+    explicit Executor(std::string name, int core = -1, ClockPtr clock = real_clock());
+    ~Executor();
+
+    Executor(const Executor&) = delete;
+    Executor& operator=(const Executor&) = delete;
+
+    bool start();
+    // Ask the loop to exit; coroutines still suspended on it are destroyed.
+    // Close the queues they wait on first so they can finish cleanly.
+    void stop();
+    void join();
+
+    // Runs a top-level coroutine on this executor; failures are logged
+    void spawn(Task<void> task);
+    void post(std::coroutine_handle<> handle);
+
+    const std::string& name() const { return name_; }
+    const ClockPtr& clock() const { return clock_; }
+    bool running_here() const;
+    // The executor running the calling thread, if any
+    static Executor* current();
+
+    // Moves the awaiting coroutine onto this executor
+    auto schedule() {
+        struct Awaiter {
+            Executor* executor;
+            bool await_ready() const noexcept { return executor->running_here(); }
+            void await_suspend(std::coroutine_handle<> handle) { executor->post(handle); }
+            void await_resume() const noexcept {}
+        };
+        return Awaiter{this};
+    }
+
+    // Resumes once the clock reads at least deadline_ns
+    auto sleep_until(int64_t deadline_ns) {
+        struct Awaiter {
+            Executor* executor;
+            int64_t deadline;
+            bool await_ready() const { return executor->clock_->now_ns() >= deadline; }
+            void await_suspend(std::coroutine_handle<> handle) { executor->add_timer(deadline, handle); }
+            void await_resume() const noexcept {}
+        };
+        return Awaiter{this, deadline_ns};
+    }
+
+    auto sleep_for(std::chrono::nanoseconds delay) {
+        return sleep_until(clock_->now_ns() + delay.count());
+    }
+
+    // Resumes when fd is readable (or has hung up). May resume early, so
+    // callers re-check readiness; on Windows it always does.
+    auto readable(int fd) {
+        struct Awaiter {
+            Executor* executor;
+            int fd;
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> handle) { executor->add_reader(fd, handle); }
+            void await_resume() const noexcept {}
+        };
+        return Awaiter{this, fd};
+    }
+
+private:
+    struct Timer {
+        int64_t deadline;
+        std::coroutine_handle<> handle;
+        bool operator>(const Timer& other) const { return deadline > other.deadline; }
+    };
+    struct Reader {
+        int fd;
+        std::coroutine_handle<> handle;
+    };
+
+    std::string name_;
+    int core_;
+    ClockPtr clock_;
+    std::thread thread_;
+    std::atomic<bool> stopping_{false};
+#ifdef _WIN32
+    std::condition_variable wake_cv_;
+    bool wake_pending_ = false;  // Guarded by ready_mutex_
+#else
+    int wake_pipe_[2] = {-1, -1};
+#endif
+
+    mutable std::mutex ready_mutex_;
+    std::vector<std::coroutine_handle<>> ready_;  // Guarded by ready_mutex_
+    // Owned by the executor thread
+    std::vector<Timer> timers_;  // Min-heap on deadline
+    std::vector<Reader> readers_;
+    std::unordered_set<void*> roots_;  // Frames of spawned coroutines still running
+
+    void run();
+    void wake();
+    void add_timer(int64_t deadline, std::coroutine_handle<> handle);
+    void add_reader(int fd, std::coroutine_handle<> handle);
+    void run_ready();
+    void fire_timers();
+    int poll_timeout_ms() const;
+    void poll_once(int timeout_ms);
+
+    struct Root;
+    Root run_root(Task<void> task);
+};
+
+// Bounded multi-producer queue with an awaitable pop(). A suspended consumer
+// is resumed on the executor it was running on when it called pop().
+template<typename T>
+class AsyncQueue {
+public:
+    explicit AsyncQueue(size_t capacity = 65536) : capacity_(capacity) {}
+
+    // False when the queue is full or closed
+    bool try_push(T value) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (closed_) {
+            return false;
+        }
+        if (!waiters_.empty()) {
+            Waiter* waiter = waiters_.front();
+            waiters_.pop_front();
+            lock.unlock();
+            waiter->result.emplace(std::move(value));
+            waiter->executor->post(waiter->handle);
+            return true;
+        }
+        if (items_.size() >= capacity_) {
+            return false;
+        }
+        items_.push_back(std::move(value));
+        return true;
+    }
+
+    // Wakes every waiting consumer; pop() yields the remaining items, then nullopt
+    void close() {
+        std::deque<Waiter*> waiters;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+            waiters.swap(waiters_);
+        }
+        for (Waiter* waiter : waiters) {
+            waiter->executor->post(waiter->handle);
+        }
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return items_.size();
+    }
+
+private:
+    struct Waiter {
+        AsyncQueue* queue;
+        Executor* executor = nullptr;
+        std::coroutine_handle<> handle = nullptr;
+        std::optional<T> result = std::nullopt;
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> h) {
+            std::lock_guard<std::mutex> lock(queue->mutex_);
+            if (!queue->items_.empty()) {
+                result.emplace(std::move(queue->items_.front()));
+                queue->items_.pop_front();
+                return false;
+            }
+            if (queue->closed_) {
+                return false;
+            }
+            executor = Executor::current();
+            handle = h;
+            queue->waiters_.push_back(this);
+            return true;
+        }
+        std::optional<T> await_resume() { return std::move(result); }
+    };
+
+public:
+    // Must be awaited from a coroutine running on an Executor
+    Waiter pop() { return Waiter{this}; }
+
+private:
+    mutable std::mutex mutex_;
+    std::deque<T> items_;
+    std::deque<Waiter*> waiters_;
+    size_t capacity_;
+    bool closed_ = false;
+};
+
+} // namespace winter::core
@@ -0,0 +1,67 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "winter/core/engine.hpp"
+
+namespace winter::core {
+
+// Periodic engine checkpoints written by a background thread.
+//
+// Each checkpoint quiesces the engine only long enough to copy its state into
+// a memory buffer; the file write and fsync happen after the engine resumes.
+// Files are replaced atomically (write to <path>.tmp, then rename), so a crash
+// mid-write leaves the previous checkpoint intact.
+class Checkpointer {
+public:
+    // Extra state saved next to the engine snapshot while the engine is paused
+    using SaveHook = std::function<void(utils::BinaryWriter&)>;
+    using LoadHook = std::function<bool(utils::BinaryReader&)>;
+
+private:
+    Engine& engine_;
+    std::string path_;
+    std::chrono::milliseconds interval_;
+
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+    std::condition_variable cv_;
+    std::mutex cv_mutex_;
+    std::atomic<size_t> checkpoints_written_{0};
+    SaveHook save_hook_;
+
+    void run();
+
+public:
+    Checkpointer(Engine& engine, std::string path, std::chrono::milliseconds interval);
+    ~Checkpointer();
+
+    Checkpointer(const Checkpointer&) = delete;
+    Checkpointer& operator=(const Checkpointer&) = delete;
+
+    // Must be set before start()
+    void set_save_hook(SaveHook hook) { save_hook_ = std::move(hook); }
+
+    // core >= 0 pins the checkpoint thread (a housekeeping core)
+    void start(int core = -1);
+    // Stops the thread and writes a final checkpoint
+    void stop();
+
+    bool checkpoint_now();
+    size_t checkpoints_written() const { return checkpoints_written_; }
+    const std::string& path() const { return path_; }
+
+    // Checkpoint file format: magic, version, payload size, payload, FNV-1a checksum
+    static bool write_file(const std::string& path, const utils::BinaryWriter& payload);
+    static bool read_file(const std::string& path, std::vector<char>& payload);
+
+    // Loads a checkpoint file into a stopped engine; load_hook reads what the save hook wrote
+    static bool restore(Engine& engine, const std::string& path, const LoadHook& load_hook = nullptr);
+};
+
+} // namespace winter::core
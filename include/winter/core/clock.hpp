@@ -0,0 +1,52 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace winter::core {
+
+// Time source for engine components and strategy timers.
+//
+// Live sessions use the real clock. Backtests and replays use a SimulatedClock
+// that the engine moves to each tick's timestamp before the strategies see it,
+// so time-dependent logic follows the data instead of the machine's speed.
+class Clock {
+public:
+    virtual ~Clock() = default;
+
+    // Nanoseconds since the Unix epoch (or since the start of the data for
+    // feeds whose timestamps are sequence numbers)
+    virtual int64_t now_ns() const = 0;
+
+    int64_t now_us() const { return now_ns() / 1000; }
+};
+
+using ClockPtr = std::shared_ptr<Clock>;
+
+// Wall-clock time from the TSC-calibrated timestamp source (utils/tsc_clock.hpp)
+class RealClock : public Clock {
+public:
+    int64_t now_ns() const override;
+};
+
+// Event-time clock; only moves when told to
+class SimulatedClock : public Clock {
+private:
+    std::atomic<int64_t> now_ns_;
+
+public:
+    explicit SimulatedClock(int64_t start_ns = 0) : now_ns_(start_ns) {}
+
+    int64_t now_ns() const override { return now_ns_.load(std::memory_order_acquire); }
+    void set(int64_t ns) { now_ns_.store(ns, std::memory_order_release); }
+    void set_us(int64_t us) { set(us * 1000); }
+};
+
+// Shared real clock used by default everywhere
+ClockPtr real_clock();
+
+// "HH:MM:SS" in local time, as used for trade records
+std::string format_time_of_day(int64_t ns);
+
+} // namespace winter::core
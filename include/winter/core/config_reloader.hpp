@@ -0,0 +1,46 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include "winter/core/async.hpp"
+#include "winter/core/engine.hpp"
+#include "winter/utils/config_parser.hpp"
+#include "winter/utils/file_watcher.hpp"
+
+namespace winter::core {
+
+// Re-reads a winter_config.yaml while the engine trades. Each reload parses
+// the file, validates the parameters of every running strategy it covers and
+// hands the changed ones to Engine::reconfigure_strategies, which applies them
+// at the next batch boundary. Changes are logged per key; a file that does not
+// parse or validate is rejected as a whole and the running parameters stay.
+// Strategies are matched by name, which for factory-created ones is the type.
+class ConfigReloader {
+private:
+    Engine& engine_;
+    std::string path_;
+    utils::WinterConfig current_;  // Last configuration accepted
+    utils::FileWatcher watcher_;
+    std::atomic<uint64_t> reloads_{0};
+    std::atomic<uint64_t> rejected_{0};
+
+public:
+    // `current` is the configuration the engine's strategies were built from
+    ConfigReloader(Engine& engine, std::string path, utils::WinterConfig current);
+
+    ConfigReloader(const ConfigReloader&) = delete;
+    ConfigReloader& operator=(const ConfigReloader&) = delete;
+
+    // False when the file was rejected; the running parameters are kept
+    bool reload();
+
+    // Reloads whenever the file is written, until the executor stops.
+    // Returns at once when the file cannot be watched.
+    Task<void> watch(Executor& executor);
+
+    const utils::WinterConfig& current() const { return current_; }
+    uint64_t reloads() const { return reloads_.load(); }    // Accepted, changes or not
+    uint64_t rejected() const { return rejected_.load(); }
+};
+
+} // namespace winter::core
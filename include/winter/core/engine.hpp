@@ -6,25 +6,57 @@
 #include <atomic>
 #include <mutex>
 #include <condition_variable>
+#include <span>
+#include "winter/core/clock.hpp"
 #include "winter/core/market_data.hpp"
 #include "winter/core/order.hpp"
+#include "winter/core/overflow_queue.hpp"
 #include "winter/core/portfolio.hpp"
 #include "winter/strategy/strategy_base.hpp"
-#include "winter/utils/lock_free_queue.hpp"
+#include "winter/strategy/strategy_plugin.hpp"
+#include "winter/utils/spsc_ring.hpp"
+#include "winter/utils/binary_io.hpp"
 #include <functional>
+#include <unordered_map>
 
 namespace winter {
 namespace core {
 
 // Engine configuration structure
 struct EngineConfiguration {
-    // Queue sizes
-    size_t market_data_queue_size = 1000000;
-    size_t order_queue_size = 500000;
+    // Queue sizes, rounded up to a power of two when the queues are allocated.
+    // Every slot (72 bytes) is committed up front, so size these for a burst
+    // rather than a whole session: the defaults take under 5MB and 1.2MB.
+    size_t market_data_queue_size = 1 << 16;
+    size_t order_queue_size = 1 << 14;
+    // Back queue storage with huge pages when the system provides them
+    bool use_huge_pages = false;
+    
+    // What producers do when a queue is full. DEFAULT follows the execution
+    // mode: backtests block (lossless); for market data, paper trading
+    // rejects and live trading drops the oldest queued tick. Orders are never
+    // dropped silently: outside backtests they are rejected with an error
+    // logged, and DROP_OLDEST or CONFLATE on the order queue fall back to
+    // REJECT.
+    OverflowPolicy market_data_overflow = OverflowPolicy::DEFAULT;
+    OverflowPolicy order_overflow = OverflowPolicy::DEFAULT;
     
     // Processing
     size_t batch_size = 10000;
     
+    // Walk each batch tick by tick across all strategies and wait for a tick's
+    // orders to fill before the next tick, so decisions depend only on the tick
+    // sequence and not on thread timing (needed for exact journal replay)
+    bool sequential_fills = false;
+    
+    // Realtime: lock the process's memory, pre-fault thread stacks and batch
+    // buffers, and run the strategy and execution threads SCHED_FIFO. Only
+    // threads pinned to a core of their own are raised, since their loops
+    // spin. Steps the process lacks privileges for are skipped and reported
+    // by realtime_status().
+    bool realtime = false;
+    int realtime_priority = 80;
+    
     // Logging
     bool enable_logging = true;
     std::string log_level = "info";
@@ -34,18 +66,59 @@ struct EngineConfiguration {
     ExecutionMode execution_mode = ExecutionMode::BACKTEST;
 };
 
+// What realtime mode actually applied at the last start()
+struct RealtimeStatus {
+    bool requested = false;
+    bool memory_locked = false;
+    bool strategy_fifo = false;   // Strategy thread runs SCHED_FIFO
+    bool execution_fifo = false;
+    std::vector<std::string> problems;  // Why each skipped step was skipped
+    
+    bool fully_applied() const { return requested && memory_locked && strategy_fifo && execution_fifo; }
+};
+
 class Engine {
 private:
-    // Strategies
-    std::vector<strategy::StrategyPtr> strategies_;
-    std::mutex strategies_mutex_;
+    // Strategies, published RCU-style: the strategy thread reads the current
+    // set with one atomic load per batch and never locks. Writers, serialized
+    // by strategies_mutex_, publish a modified copy and retire the old set
+    // until the strategy thread has passed a batch boundary.
+    using StrategySet = std::vector<strategy::StrategyPtr>;
+    std::atomic<const StrategySet*> strategies_;
+    mutable std::mutex strategies_mutex_;
+    struct RetiredStrategySet {
+        const StrategySet* set;
+        uint64_t epoch;  // strategy_epoch_ when it was replaced
+    };
+    std::vector<RetiredStrategySet> retired_strategy_sets_;  // Guarded by strategies_mutex_
+    // Batch boundaries passed by the strategy thread; the RCU grace period
+    std::atomic<uint64_t> strategy_epoch_{0};
+    std::atomic<bool> strategy_reader_active_{false};
+    // Plugin each plugin-backed strategy came from, by strategy name
+    std::unordered_map<std::string, strategy::StrategyPluginPtr> strategy_plugins_;
+    // Validated parameter updates for the strategy thread's next batch boundary,
+    // by name so an update queued before a swap reaches the replacement
+    struct PendingConfig {
+        std::string strategy_name;
+        utils::ConfigValues values;
+    };
+    std::vector<PendingConfig> pending_configs_;  // Guarded by pending_configs_mutex_
+    std::mutex pending_configs_mutex_;
+    std::atomic<bool> configs_pending_{false};
     
     // Portfolio
     Portfolio portfolio_;
     
     // Queues
-    utils::LockFreeQueue<MarketData> market_data_queue_; 
-    utils::LockFreeQueue<Order> order_queue_;
+    // Sized from the configuration by allocate_queues()
+    OverflowQueue<MarketData> market_data_queue_; 
+    OverflowQueue<Order> order_queue_;
+    bool queues_stale_ = false;  // Sizes changed while running
+    
+    // Zero-copy hand-off: descriptors of ticks that stay in the caller's store.
+    // The queue is single-producer, so concurrent submitters take the mutex.
+    utils::SpscRing<std::span<const MarketData>> tick_view_queue_{1024};
+    std::mutex tick_view_push_mutex_;
     
     // Threads
     std::thread strategy_thread_;
@@ -55,28 +128,126 @@ private:
     std::atomic<bool> running_{false};
     std::condition_variable cv_;
     std::mutex cv_mutex_;
+    
+    // Quiesce support for snapshots: both loops park at a batch boundary
+    std::atomic<bool> pause_requested_{false};
+    bool strategy_parked_ = false;   // Guarded by cv_mutex_
+    bool execution_parked_ = false;  // Guarded by cv_mutex_
+    int pause_depth_ = 0;            // Nested pause() calls; guarded by cv_mutex_
+    
+    // Ticks fully processed by the strategies; the resume offset for replays
+    std::atomic<uint64_t> ticks_processed_{0};
+    
+    // Order hand-off counters used by sequential_fills; every submitted order
+    // is eventually filled or accounted for in the order queue's overflow stats
+    std::atomic<uint64_t> orders_submitted_{0};
+    std::atomic<uint64_t> orders_filled_{0};
+    
+    // Heap allocations made by each engine thread since start(); stay zero
+    // unless the winter_alloc_hooks library is linked in
+    std::atomic<uint64_t> strategy_loop_allocations_{0};
+    std::atomic<uint64_t> execution_loop_allocations_{0};
+    
+    // Filled in by start() and the engine threads as they enter realtime mode
+    RealtimeStatus realtime_status_;  // Guarded by realtime_mutex_
+    mutable std::mutex realtime_mutex_;
+    std::atomic<int> realtime_pending_{0};  // Threads still setting up
+    
+    // Strategy thread only: signals for the current tick, reused across ticks
+    std::vector<Signal> signal_buffer_;
+    
     // Callback for order processing
     std::function<void(const Order&)> order_callback_;
 
     // Configuration
     EngineConfiguration config_;
     
+    // Time source shared with the portfolio and strategies. An event-time clock
+    // is moved to each tick's timestamp before the strategies see the tick.
+    ClockPtr clock_ = real_clock();
+    std::shared_ptr<SimulatedClock> event_clock_;
+    
     // Thread functions
     void strategy_loop();
     void execution_loop();
+    void park(bool& parked_flag);
+    void enter_realtime(const char* role, bool dedicated_core, bool RealtimeStatus::*applied);
+    void report_realtime_status();
+    void submit_signals(strategy::StrategyBase& strategy, const MarketData& data);
+    void run_strategies(const StrategySet& strategies, std::span<const MarketData> ticks);
+    // Callers hold strategies_mutex_
+    const StrategySet& current_strategies() const { return *strategies_.load(); }
+    void publish_strategies(StrategySet next);
+    void reclaim_strategy_sets();
+    // Strategy thread, or any other caller holding strategies_mutex_
+    void apply_pending_configs();
+    void allocate_queues();
+    void apply_overflow_policies();
+    uint64_t orders_settled() const;
 
 public:
     Engine();
     ~Engine();
     
-    // Configuration
+    // Configuration; queue sizes and overflow policies take effect immediately
+    // when stopped, else at the next start
     void configure(const EngineConfiguration& config);
     
-    // Strategy management
+    // Effective queue capacities (the configured sizes rounded up)
+    size_t market_data_queue_capacity() const { return market_data_queue_.capacity(); }
+    size_t order_queue_capacity() const { return order_queue_.capacity(); }
+    
+    // Policy DEFAULT resolves to for a given execution mode
+    static OverflowPolicy default_overflow_policy(EngineConfiguration::ExecutionMode mode);
+    static OverflowPolicy default_order_overflow_policy(EngineConfiguration::ExecutionMode mode);
+    OverflowStats market_data_overflow_stats() const { return market_data_queue_.stats(); }
+    OverflowStats order_overflow_stats() const { return order_queue_.stats(); }
+    OverflowPolicy order_overflow_policy() const { return order_queue_.policy(); }
+    
+    // Heap allocations by the strategy and execution threads since start()
+    uint64_t strategy_loop_allocations() const { return strategy_loop_allocations_.load(std::memory_order_relaxed); }
+    uint64_t execution_loop_allocations() const { return execution_loop_allocations_.load(std::memory_order_relaxed); }
+    
+    // Outcome of realtime mode; requested is false when it is off
+    RealtimeStatus realtime_status() const;
+    
+    // Applies to the portfolio and to current and future strategies
+    void set_clock(ClockPtr clock);
+    const ClockPtr& clock() const { return clock_; }
+    
+    // Strategy management; safe while running and free for the strategy
+    // thread. Enable or disable a strategy through get_strategy(name).
     void add_strategy(strategy::StrategyPtr strategy);
     void remove_strategy(const std::string& name);
-    strategy::StrategyPtr get_strategy(const std::string& name);
-    // Add this to process market data in batches
+    strategy::StrategyPtr get_strategy(const std::string& name) const;
+    size_t strategy_count() const;
+    
+    // Swaps `replacement` in for strategy `name`. A running engine is paused
+    // at a batch boundary for the change. With transfer_state the old
+    // instance's serialize() output is restored into the new one, and a
+    // failed restore leaves the old strategy in place.
+    bool replace_strategy(const std::string& name, strategy::StrategyPtr replacement, bool transfer_state = true);
+    
+    // New parameters for strategies by name. Every update is validated first
+    // and none is applied unless all pass. A running engine applies them on
+    // the strategy thread between batches, so no batch sees a mix of old and
+    // new values; a stopped one applies them before returning.
+    bool reconfigure_strategies(const std::vector<std::pair<std::string, utils::ConfigValues>>& updates,
+                                std::vector<std::string>& errors);
+    
+    // Strategy plugins (see strategy_plugin.hpp), usable while running.
+    // A swap carries the strategy's configuration and, when the plugins'
+    // state versions match, its state over to the new build.
+    // Returns the new instance, or nullptr when the plugin was rejected
+    strategy::StrategyPtr load_strategy_plugin(const std::string& path, const std::string& instance_name = "");
+    bool swap_strategy_plugin(const std::string& name, const std::string& path);
+    // The library is unloaded once nothing references the strategy
+    bool unload_strategy_plugin(const std::string& name);
+    
+    // Copies a batch into the tick queue in order. A full queue is handled per
+    // tick by market_data_overflow: BLOCK waits for room, DROP_OLDEST and
+    // CONFLATE make room by discarding or merging queued ticks, and REJECT
+    // drops the incoming tick with an error logged.
     void process_market_data_batch(const std::vector<MarketData>& batch);
 
     // Update the start method to accept core affinity parameters
@@ -85,8 +256,15 @@ public:
     // Add callback functionality
     void set_order_callback(std::function<void(const Order&)> callback);
 
-    // Market data processing
+    // Market data processing; a full queue is handled by market_data_overflow
     void process_market_data(const MarketData& data);
+    // Policy-free variant for ordered producers: returns false when the tick was not queued
+    bool try_process_market_data(const MarketData& data) { return market_data_queue_.try_push(data); }
+    // Enqueues one descriptor; the strategy thread reads the ticks in place. They
+    // must stay alive and unmodified until ticks_processed() has moved past them.
+    // Returns false when the descriptor queue is full. Ticks submitted this way
+    // are not ordered relative to ticks from the copying calls above.
+    bool try_process_market_data_view(std::span<const MarketData> ticks);
     
     // Engine control
     void stop();
@@ -94,6 +272,17 @@ public:
     
     // Portfolio access
     Portfolio& portfolio() { return portfolio_; }
+    
+    // Quiesce: returns once no tick or order is in flight; no-op when stopped.
+    // Pauses nest, so the engine runs again after the last matching resume().
+    void pause();
+    void resume();
+    uint64_t ticks_processed() const { return ticks_processed_.load(std::memory_order_acquire); }
+    
+    // State snapshots (portfolio, strategies, tick offset). A running engine
+    // must be paused around save_snapshot.
+    void save_snapshot(utils::BinaryWriter& out) const;
+    bool restore_snapshot(utils::BinaryReader& in);
 };
 
 } // namespace core
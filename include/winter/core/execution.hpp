@@ -0,0 +1,25 @@
+#pragma once
+#include <optional>
+#include "winter/core/order.hpp"
+#include "winter/core/portfolio.hpp"
+#include "winter/core/signal.hpp"
+
+namespace winter::core {
+
+// Signal -> order and order -> fill rules shared by the threaded Engine and
+// the synchronous backtest runners, so every path sizes and fills the same way.
+
+// Fraction of available cash committed to a single BUY signal
+constexpr double MAX_POSITION_FRACTION = 0.1;
+
+// Builds an order for a signal against the portfolio's current cash and positions.
+// BUY uses MAX_POSITION_FRACTION of cash, SELL closes the whole position.
+// Returns nothing for NEUTRAL/EXIT signals or when the order would be empty.
+std::optional<Order> order_from_signal(const Signal& signal, const Portfolio& portfolio);
+
+// Fills an order against the portfolio. SELL orders larger than the position are
+// reduced to the available quantity. Returns the executed order, or nothing if
+// the order was rejected (insufficient cash or no position).
+std::optional<Order> execute_order(const Order& order, Portfolio& portfolio);
+
+} // namespace winter::core
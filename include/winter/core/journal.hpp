@@ -0,0 +1,90 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "winter/core/market_data.hpp"
+#include "winter/core/order.hpp"
+#include "winter/utils/binary_io.hpp"
+
+namespace winter::core {
+
+// Input journal for live sessions: every received tick (with its arrival time
+// and ingest seq), written before the engine sees it, and every fill with the
+// seq of the tick that produced it. Replaying the ticks through an Engine with
+// sequential_fills, clocked by arrival time, must reproduce the journaled
+// fills exactly, down to the producing tick.
+enum class JournalEventType : uint8_t {
+    TICK = 1,
+    FILL = 2
+};
+
+struct JournalEvent {
+    JournalEventType type = JournalEventType::TICK;
+    int64_t arrival_ns = 0;
+    MarketData tick;      // TICK only
+    Order fill;           // FILL only; fill.tick_seq names the producing tick
+};
+
+// Append-only journal writer. append_*() only encodes into an in-memory
+// buffer; a background thread swaps buffers and does the sequential write,
+// with one fsync per flush interval.
+class JournalWriter {
+private:
+    FILE* file_ = nullptr;
+    std::chrono::milliseconds flush_interval_;
+
+    utils::BinaryWriter active_;
+    utils::BinaryWriter flushing_;
+    std::mutex buffer_mutex_;
+
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+    std::condition_variable cv_;
+    std::atomic<uint64_t> events_written_{0};
+    uint64_t events_buffered_ = 0;  // Guarded by buffer_mutex_
+
+    void run();
+    void flush();
+
+public:
+    explicit JournalWriter(const std::string& path,
+                           std::chrono::milliseconds flush_interval = std::chrono::milliseconds(100));
+    ~JournalWriter();
+
+    JournalWriter(const JournalWriter&) = delete;
+    JournalWriter& operator=(const JournalWriter&) = delete;
+
+    bool is_open() const { return file_ != nullptr; }
+
+    void append_tick(const MarketData& data, int64_t arrival_ns);
+    void append_fill(const Order& order, int64_t arrival_ns);
+
+    // Flushes everything appended so far and stops the writer thread
+    void close();
+
+    uint64_t events_written() const { return events_written_; }
+};
+
+// Sequential journal reader; a torn record at the end of a crashed session
+// is treated as end of journal.
+class JournalReader {
+private:
+    FILE* file_ = nullptr;
+    std::vector<char> record_;
+
+public:
+    explicit JournalReader(const std::string& path);
+    ~JournalReader();
+
+    JournalReader(const JournalReader&) = delete;
+    JournalReader& operator=(const JournalReader&) = delete;
+
+    bool is_open() const { return file_ != nullptr; }
+    bool next(JournalEvent& event);
+};
+
+} // namespace winter::core
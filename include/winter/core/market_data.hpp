@@ -9,6 +9,7 @@ struct MarketData {
     double price;
     int volume;
     int64_t timestamp; // microseconds since epoch
+    uint64_t seq;      // ingest sequence number, 0 if unassigned
     
     MarketData();
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 namespace winter::core {
@@ -20,6 +21,7 @@ struct Order {
     OrderType type;
     int quantity;
     double price;
+    uint64_t tick_seq;  // seq of the tick that produced the order, 0 if none
     
     Order();
     Order(const std::string& sym, OrderSide s, int qty, double p);
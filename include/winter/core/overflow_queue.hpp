@@ -0,0 +1,201 @@
+#pragma once
+
+#include <winter/utils/spsc_ring.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace winter::core {
+
+// What a producer does when an engine queue is full
+enum class OverflowPolicy {
+    DEFAULT,      // Chosen from the execution mode
+    BLOCK,        // Wait with backoff until there is room (lossless)
+    DROP_OLDEST,  // Evict the oldest queued item to make room
+    CONFLATE,     // Keep only the newest pending item per symbol until the queue drains
+    REJECT        // Refuse the new item
+};
+
+inline const char* to_string(OverflowPolicy policy) {
+    switch (policy) {
+    case OverflowPolicy::DEFAULT: return "default";
+    case OverflowPolicy::BLOCK: return "block";
+    case OverflowPolicy::DROP_OLDEST: return "drop-oldest";
+    case OverflowPolicy::CONFLATE: return "conflate";
+    case OverflowPolicy::REJECT: return "reject";
+    }
+    return "unknown";
+}
+
+// How often each overflow path was taken
+struct OverflowStats {
+    uint64_t blocked = 0;         // Pushes that had to wait for room
+    uint64_t dropped_oldest = 0;  // Queued items evicted
+    uint64_t conflated = 0;       // Pending items replaced by a newer one for the same symbol
+    uint64_t rejected = 0;        // New items refused
+};
+
+// Single-producer/single-consumer engine queue with an overflow policy. T must
+// have a `symbol` member, which is the conflation key.
+//
+// Conflation parks items in a side buffer once the ring is full; while that
+// buffer is non-empty every new item goes there too, so per-symbol order is
+// kept. The consumer takes the whole buffer once the ring has drained.
+template<typename T>
+class OverflowQueue {
+private:
+    utils::SpscRing<T> ring_;
+    OverflowPolicy policy_ = OverflowPolicy::BLOCK;
+
+    // Conflation side buffer, in arrival order of the first item per symbol
+    std::mutex pending_mutex_;
+    std::vector<T> pending_;
+    std::unordered_map<std::string, size_t> pending_index_;
+    std::atomic<bool> has_pending_{false};
+
+    // Consumer-owned copy of a drained side buffer
+    std::vector<T> drained_;
+    size_t drained_pos_ = 0;
+
+    std::atomic<uint64_t> blocked_{0};
+    std::atomic<uint64_t> dropped_oldest_{0};
+    std::atomic<uint64_t> conflated_{0};
+    std::atomic<uint64_t> rejected_{0};
+
+    void conflate(const T& item) {
+        std::lock_guard<std::mutex> lock(pending_mutex_);
+        auto [it, inserted] = pending_index_.try_emplace(item.symbol, pending_.size());
+        if (inserted) {
+            pending_.push_back(item);
+        } else {
+            pending_[it->second] = item;
+            conflated_.fetch_add(1, std::memory_order_relaxed);
+        }
+        has_pending_.store(true, std::memory_order_release);
+    }
+
+public:
+    enum class Outcome { QUEUED, DROPPED_OLDEST, CONFLATED, REJECTED };
+
+    void reset(size_t requested_capacity, bool use_huge_pages) {
+        ring_.reset(requested_capacity, use_huge_pages);
+        pending_.clear();
+        pending_index_.clear();
+        has_pending_ = false;
+        drained_.clear();
+        drained_pos_ = 0;
+    }
+
+    void set_policy(OverflowPolicy policy) { policy_ = policy; }
+    OverflowPolicy policy() const { return policy_; }
+
+    // Plain push that never waits or evicts; false when the item was not queued
+    bool try_push(const T& item) {
+        if (has_pending_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        return ring_.push(item);
+    }
+
+    // Applies the overflow policy; BLOCK waits only while `active` holds and
+    // rejects once it clears, so a stopped consumer cannot hang the producer
+    Outcome push(const T& item, const std::atomic<bool>& active) {
+        if (policy_ == OverflowPolicy::CONFLATE && has_pending_.load(std::memory_order_acquire)) {
+            conflate(item);
+            return Outcome::CONFLATED;
+        }
+        if (ring_.push(item)) {
+            return Outcome::QUEUED;
+        }
+
+        switch (policy_) {
+        case OverflowPolicy::DEFAULT:
+        case OverflowPolicy::BLOCK: {
+            blocked_.fetch_add(1, std::memory_order_relaxed);
+            for (uint32_t spins = 0; active.load(std::memory_order_acquire); ++spins) {
+                if (ring_.push(item)) {
+                    return Outcome::QUEUED;
+                }
+                if (spins < 64) {
+                    continue;
+                } else if (spins < 1024) {
+                    std::this_thread::yield();
+                } else {
+                    std::this_thread::sleep_for(std::chrono::microseconds(50));
+                }
+            }
+            break;
+        }
+        case OverflowPolicy::DROP_OLDEST: {
+            T evicted;
+            while (!ring_.push(item)) {
+                if (ring_.pop(evicted)) {
+                    dropped_oldest_.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            return Outcome::DROPPED_OLDEST;
+        }
+        case OverflowPolicy::CONFLATE:
+            conflate(item);
+            return Outcome::CONFLATED;
+        case OverflowPolicy::REJECT:
+            break;
+        }
+
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return Outcome::REJECTED;
+    }
+
+    // Consumer only
+    bool pop(T& item) {
+        if (drained_pos_ < drained_.size()) {
+            item = std::move(drained_[drained_pos_++]);
+            return true;
+        }
+        if (ring_.pop(item)) {
+            return true;
+        }
+        if (!has_pending_.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        // The ring is empty, so everything in the side buffer is next in line
+        {
+            std::lock_guard<std::mutex> lock(pending_mutex_);
+            drained_.swap(pending_);
+            pending_.clear();
+            pending_index_.clear();
+            has_pending_.store(false, std::memory_order_release);
+        }
+        drained_pos_ = 0;
+        if (drained_.empty()) {
+            return false;
+        }
+        item = std::move(drained_[drained_pos_++]);
+        return true;
+    }
+
+    // Consumer only
+    bool empty() const {
+        return ring_.empty() && !has_pending_.load(std::memory_order_acquire) && drained_pos_ >= drained_.size();
+    }
+
+    size_t capacity() const { return ring_.capacity(); }
+    bool on_huge_pages() const { return ring_.on_huge_pages(); }
+
+    OverflowStats stats() const {
+        OverflowStats stats;
+        stats.blocked = blocked_.load(std::memory_order_relaxed);
+        stats.dropped_oldest = dropped_oldest_.load(std::memory_order_relaxed);
+        stats.conflated = conflated_.load(std::memory_order_relaxed);
+        stats.rejected = rejected_.load(std::memory_order_relaxed);
+        return stats;
+    }
+};
+
+} // namespace winter::core
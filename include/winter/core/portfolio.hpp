@@ -2,6 +2,8 @@
 #include <string>
 #include <unordered_map>
 #include <vector>
+#include "winter/core/clock.hpp"
+#include "winter/utils/binary_io.hpp"
 
 namespace winter::core {
 
@@ -27,10 +29,13 @@ private:
     std::unordered_map<std::string, Position> positions_;
     int trade_count_;
     std::vector<Trade> trades_;  // Add this member variable
+    ClockPtr clock_;             // Stamps trade records
     
 public:
     Portfolio();
     
+    void set_clock(ClockPtr clock) { clock_ = std::move(clock); }
+    
     void set_cash(double amount);
     double cash() const;
     void add_cash(double amount);
@@ -48,6 +53,13 @@ public:
     const std::vector<Trade>& get_trades() const {
         return trades_;
     }
+    
+    // Pre-sizes the trade log so recording fills does not reallocate
+    void reserve_trades(size_t count) { trades_.reserve(count); }
+    
+    // State snapshots for checkpoint/resume
+    void serialize(utils::BinaryWriter& out) const;
+    bool deserialize(utils::BinaryReader& in);
 };
 
 } // namespace winter::core
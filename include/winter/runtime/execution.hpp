@@ -0,0 +1,91 @@
+#pragma once
+
+#include <winter/core/market_data.hpp>
+#include <winter/core/order.hpp>
+#include <winter/core/portfolio.hpp>
+#include <winter/utils/rolling_window.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace winter::runtime {
+
+// One fill as reported to the user: average-cost P&L on sells and the
+// symbol's price z-score when it filled
+struct TradeRecord {
+    std::string timestamp;   // Display time (wall clock live, event time in replays)
+    int64_t event_us = 0;    // Event time of the tick the fill belongs to
+    std::string symbol;
+    std::string side;
+    int quantity = 0;
+    double price = 0.0;
+    double value = 0.0;
+    double profit_loss = 0.0;
+    double z_score = 0.0;
+};
+
+// Z-score of each symbol's latest price against its last `window` prices
+// (the latest included, population deviation). Running sums make every
+// update O(1); values are kept relative to the symbol's first price so the
+// sums do not lose precision at typical price levels. Not thread-safe.
+class ZScoreTracker {
+public:
+    explicit ZScoreTracker(size_t window = 20) : window_(window < 2 ? 2 : window) {}
+
+    // Adds a price and returns the symbol's new z-score (0 until two prices are known)
+    double update(const std::string& symbol, double price);
+    // Z-score from the symbol's latest update, 0 for unseen symbols
+    double last(const std::string& symbol) const;
+
+    size_t window() const { return window_; }
+    void clear() { symbols_.clear(); }
+
+private:
+    struct State {
+        explicit State(size_t window, double first) : prices(window), anchor(first) {}
+        utils::RollingWindow<double> prices;  // Relative to anchor
+        double anchor;
+        double sum = 0.0;
+        double sum_sq = 0.0;
+        double z_score = 0.0;
+        uint32_t updates = 0;
+    };
+
+    size_t window_;
+    std::unordered_map<std::string, State> symbols_;
+};
+
+// Turns executed orders into TradeRecords, tracking each symbol's position
+// at average cost so sells report realized P&L. Not thread-safe; feed it
+// from one thread (the engine's execution thread or a backtest lane).
+class TradeLedger {
+public:
+    const TradeRecord& record_fill(const winter::core::Order& order, std::string timestamp, int64_t event_us,
+                                   double z_score = 0.0);
+
+    const std::vector<TradeRecord>& trades() const { return trades_; }
+    double realized_pnl() const { return realized_pnl_; }
+    void clear();
+
+private:
+    struct Position {
+        int quantity = 0;
+        double total_cost = 0.0;
+    };
+
+    std::unordered_map<std::string, Position> positions_;
+    std::vector<TradeRecord> trades_;
+    double realized_pnl_ = 0.0;
+};
+
+// Closing trades (sells) with their realized P&L, as BacktestEngine::compute_metrics expects
+std::vector<winter::core::Trade> closed_trades(const std::vector<TradeRecord>& trades);
+
+// Fills in z_score for trades recorded during a replay of `ticks`, as an
+// inline ZScoreTracker would have seen them. Both must be in event-time order.
+void annotate_z_scores(std::vector<TradeRecord>& trades, const std::vector<winter::core::MarketData>& ticks,
+                       size_t window = 20);
+
+} // namespace winter::runtime
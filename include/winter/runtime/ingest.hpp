@@ -0,0 +1,21 @@
+#pragma once
+
+#include <winter/core/market_data.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace winter::runtime {
+
+// Decodes one feed message, {"Symbol": "AAPL", "Price": 132.69, "Size": 100, ...}.
+// Numbers may be quoted; other fields are ignored. The timestamp is left to the
+// caller. Returns false without touching data when a field is missing or malformed.
+bool decode_json_tick(std::string_view json, winter::core::MarketData& data);
+
+// Loads and concatenates data files (CSV tapes or binary tick stores) in order.
+// Tape timestamps are times of day that restart in every file, so a later
+// file that would start before the previous one ends is moved on by whole
+// days, keeping event time increasing across the whole replay.
+bool load_ticks(const std::vector<std::string>& files, std::vector<winter::core::MarketData>& ticks);
+
+} // namespace winter::runtime
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <winter/runtime/execution.hpp>
+#include <string>
+#include <vector>
+
+namespace winter::runtime {
+
+// Trade journal (winter_trades.csv): one row per fill with P&L and z-score,
+// then a balance summary
+bool write_trade_journal(const std::string& csv_file, const std::vector<TradeRecord>& trades,
+                         double initial_balance, double final_balance);
+
+// Equity, P&L, z-score and per-symbol charts; chart data goes to a .data.js
+// file next to the page
+bool write_trade_graphs(const std::string& html_file, const std::vector<TradeRecord>& trades,
+                        double initial_balance, double final_balance);
+
+} // namespace winter::runtime
@@ -7,7 +7,7 @@
 #include <vector>
 #include <string>
 #include <unordered_map>
-#include <deque>
+#include "winter/utils/rolling_window.hpp"
 
 namespace winter {
 namespace strategy {
@@ -32,6 +32,15 @@ public:
      * @return Vector of trading signals
      */
     std::vector<core::Signal> process_tick(const core::MarketData& data) override {
+        std::vector<core::Signal> signals;
+        append_signals(data, signals);
+        return signals;
+    }
+    
+    /**
+     * @brief Update prices and history, then append the strategy's signals
+     */
+    void append_signals(const core::MarketData& data, std::vector<core::Signal>& signals) override {
         // Store the latest price
         latest_prices_[data.symbol] = data.price;
         
@@ -39,7 +48,7 @@ public:
         update_price_history(data.symbol, data.price);
         
         // Call the user's strategy logic
-        return generate_signals(data);
+        generate_signals_into(data, signals);
     }
     
     /**
@@ -51,6 +60,49 @@ public:
         // Override this method to implement your strategy logic
         return {};
     }
+    
+    /**
+     * @brief Allocation-free form of generate_signals(); appends to `signals`
+     *
+     * Override this instead of generate_signals() to reuse the engine's
+     * signal buffer. The default forwards to generate_signals().
+     */
+    virtual void generate_signals_into(const core::MarketData& data, std::vector<core::Signal>& signals) {
+        auto generated = generate_signals(data);
+        signals.insert(signals.end(), generated.begin(), generated.end());
+    }
+    
+    /**
+     * @brief Save positions, latest prices and price history
+     */
+    void serialize(utils::BinaryWriter& out) const override {
+        StrategyBase::serialize(out);
+        out.write_map(positions_);
+        out.write_map(latest_prices_);
+        out.write<uint64_t>(price_history_.size());
+        for (const auto& [symbol, history] : price_history_) {
+            out.write_string(symbol);
+            out.write_window(history);
+        }
+    }
+    
+    /**
+     * @brief Restore state written by serialize()
+     */
+    bool deserialize(utils::BinaryReader& in) override {
+        if (!StrategyBase::deserialize(in)) {
+            return false;
+        }
+        positions_ = in.read_map<int>();
+        latest_prices_ = in.read_map<double>();
+        price_history_.clear();
+        uint64_t count = in.read<uint64_t>();
+        for (uint64_t i = 0; i < count && in.ok(); ++i) {
+            std::string symbol = in.read_string();
+            in.read_window(history_for(symbol));
+        }
+        return in.ok();
+    }
 
 protected:
     // Helper methods for strategy implementation
@@ -114,7 +166,7 @@ protected:
      */
     double calculate_sma(const std::string& symbol, int period) const {
         auto it = price_history_.find(symbol);
-        if (it == price_history_.end() || it->second.size() < period) {
+        if (it == price_history_.end() || period <= 0 || it->second.size() < static_cast<size_t>(period)) {
             return 0.0;
         }
         
@@ -138,19 +190,23 @@ private:
     // Internal state
     std::unordered_map<std::string, int> positions_;
     std::unordered_map<std::string, double> latest_prices_;
-    std::unordered_map<std::string, std::deque<double>> price_history_;
-    const int MAX_HISTORY_SIZE = 1000;
+    std::unordered_map<std::string, utils::RollingWindow<double>> price_history_;
+    static constexpr size_t MAX_HISTORY_SIZE = 1000;
     
     void initialize_common() {
         // Common initialization for all strategies
     }
     
-    void update_price_history(const std::string& symbol, double price) {
-        auto& history = price_history_[symbol];
-        history.push_back(price);
-        if (history.size() > MAX_HISTORY_SIZE) {
-            history.pop_front();
+    utils::RollingWindow<double>& history_for(const std::string& symbol) {
+        auto it = price_history_.find(symbol);
+        if (it == price_history_.end()) {
+            it = price_history_.emplace(symbol, utils::RollingWindow<double>(MAX_HISTORY_SIZE)).first;
         }
+        return it->second;
+    }
+    
+    void update_price_history(const std::string& symbol, double price) {
+        history_for(symbol).push_back(price);
     }
 };
 
@@ -1,11 +1,16 @@
 // include/winter/strategy/strategy_base.hpp
 #pragma once
+#include <atomic>
 #include <string>
 #include <vector>
 #include <memory>
 #include <unordered_map>
+#include "winter/core/clock.hpp"
 #include "winter/core/market_data.hpp"
 #include "winter/core/signal.hpp"
+#include "winter/utils/binary_io.hpp"
+#include "winter/utils/logger.hpp"
+#include "winter/utils/typed_config.hpp"
 
 namespace winter {
 namespace strategy {
@@ -13,8 +18,12 @@ namespace strategy {
 class StrategyBase {
 protected:
     std::string name_;
-    bool enabled_ = true;
+    // Flipped by any thread while the strategy thread reads it every batch
+    std::atomic<bool> enabled_{true};
     std::unordered_map<std::string, std::string> config_;
+    
+    // Time source for strategy timers; event time in backtests and replays
+    core::ClockPtr clock_ = core::real_clock();
 
 public:
     explicit StrategyBase(std::string name) : name_(std::move(name)) {}
@@ -23,17 +32,51 @@ public:
     // Core method that must be implemented by all strategies
     virtual std::vector<core::Signal> process_tick(const core::MarketData& data) = 0;
     
+    // Appends this tick's signals to `signals`. The engine calls this with a
+    // buffer it reuses across ticks, so strategies that override it (and
+    // forward process_tick to it) generate signals without allocating.
+    virtual void append_signals(const core::MarketData& data, std::vector<core::Signal>& signals) {
+        auto produced = process_tick(data);
+        signals.insert(signals.end(), produced.begin(), produced.end());
+    }
+    
     // Lifecycle methods
     virtual void initialize() {}
     virtual void on_day_start() {}
     virtual void on_day_end() {}
     virtual void shutdown() {}
     
-    // Configuration
-    virtual void configure(const std::unordered_map<std::string, std::string>& config) {
+    // State snapshots for checkpoint/resume. Overrides should call the base
+    // version first and restore fields in the same order they were written.
+    virtual void serialize(utils::BinaryWriter& out) const {
+        out.write<uint8_t>(enabled_ ? 1 : 0);
+    }
+    virtual bool deserialize(utils::BinaryReader& in) {
+        enabled_ = in.read<uint8_t>() != 0;
+        return in.ok();
+    }
+    
+    // Configuration. Returns false, keeping the previous parameters, when the
+    // values do not validate. Strategies with per-tick parameters should parse
+    // them once into a ConfigSnapshot (see configure_params) rather than call
+    // get_config on the hot path.
+    virtual bool configure(const std::unordered_map<std::string, std::string>& config) {
         config_ = config;
+        return true;
+    }
+    
+    // Dry run of configure(): true if `config` would be accepted. Lets a
+    // caller check a whole set of strategies before changing any of them.
+    virtual bool validate_config(const std::unordered_map<std::string, std::string>& config,
+                                 std::vector<std::string>& errors) const {
+        (void)config;
+        (void)errors;
+        return true;
     }
     
+    const std::unordered_map<std::string, std::string>& config() const { return config_; }
+    
+    // String lookup; fine for setup, too slow for every tick
     std::string get_config(const std::string& key, const std::string& default_value = "") const {
         auto it = config_.find(key);
         return it != config_.end() ? it->second : default_value;
@@ -41,8 +84,36 @@ public:
 
     // Accessors
     const std::string& name() const { return name_; }
-    bool is_enabled() const { return enabled_; }
-    void set_enabled(bool enabled) { enabled_ = enabled; }
+    bool is_enabled() const { return enabled_.load(std::memory_order_relaxed); }
+    void set_enabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+    
+    void set_clock(core::ClockPtr clock) { clock_ = std::move(clock); }
+    const core::Clock& clock() const { return *clock_; }
+
+protected:
+    // Parses `config` against P::schema() and publishes it to `params`. On
+    // errors they are logged and both `params` and config() stay as they were.
+    template<typename P>
+    bool configure_params(utils::ConfigSnapshot<P>& params,
+                          const std::unordered_map<std::string, std::string>& config) {
+        std::vector<std::string> errors;
+        if (!params.update(config, errors)) {
+            for (const auto& error : errors) {
+                utils::Logger::error() << "Strategy " << name_ << ": " << error << utils::Logger::endl;
+            }
+            return false;
+        }
+        config_ = config;
+        return true;
+    }
+    
+    // validate_config() for strategies whose parameters are a P
+    template<typename P>
+    static bool validate_params(const std::unordered_map<std::string, std::string>& config,
+                                std::vector<std::string>& errors) {
+        P parsed;
+        return P::schema().parse(config, parsed, errors);
+    }
 };
 
 using StrategyPtr = std::shared_ptr<StrategyBase>;
@@ -6,6 +6,7 @@
 #include <functional>
 #include <mutex>
 #include "winter/strategy/strategy_base.hpp"
+#include "winter/utils/config_parser.hpp"
 
 namespace winter {
 namespace strategy {
@@ -13,35 +14,46 @@ namespace strategy {
 class StrategyFactory {
 private:
     using StrategyCreator = std::function<StrategyPtr()>;
-    static std::unordered_map<std::string, StrategyCreator> creators_;
-    static std::mutex factory_mutex_;
+    
+    // Function-local statics: strategies register from static initializers in
+    // other translation units, which may run before this one's globals exist
+    static std::unordered_map<std::string, StrategyCreator>& creators();
+    static std::mutex& factory_mutex();
 
 public:
     // Register a strategy type with the factory
     template<typename T>
     static void register_type(const std::string& type_name) {
-        std::lock_guard<std::mutex> lock(factory_mutex_);
+        std::lock_guard<std::mutex> lock(factory_mutex());
         // Capture type_name by value in the lambda
-        creators_[type_name] = [type_name]() -> StrategyPtr { 
+        creators()[type_name] = [type_name]() -> StrategyPtr { 
             return std::make_shared<T>(type_name); 
         };
     }
     
     // Create a strategy instance by type name
     static StrategyPtr create_strategy(const std::string& type_name) {
-        std::lock_guard<std::mutex> lock(factory_mutex_);
-        auto it = creators_.find(type_name);
-        if (it != creators_.end()) {
+        std::lock_guard<std::mutex> lock(factory_mutex());
+        auto it = creators().find(type_name);
+        if (it != creators().end()) {
             return it->second();
         }
         return nullptr;
     }
     
+    // Creates a strategy and configures it; nullptr (logged) when the type is
+    // unknown or the parameters are rejected
+    static StrategyPtr create_configured(const std::string& type_name, const utils::ConfigValues& parameters);
+    
+    // One configured strategy per enabled_strategies entry, in file order.
+    // All or nothing: returns an empty list if any entry fails.
+    static std::vector<StrategyPtr> create_from_config(const utils::WinterConfig& config);
+    
     // Get all registered strategy types
     static std::vector<std::string> get_registered_types() {
-        std::lock_guard<std::mutex> lock(factory_mutex_);
+        std::lock_guard<std::mutex> lock(factory_mutex());
         std::vector<std::string> types;
-        for (const auto& [type, _] : creators_) {
+        for (const auto& [type, _] : creators()) {
             types.push_back(type);
         }
         return types;
@@ -0,0 +1,95 @@
+// include/winter/strategy/strategy_plugin.hpp
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "winter/strategy/strategy_base.hpp"
+
+// Strategy plugins are shared libraries exporting one C entry point,
+// winter_strategy_plugin(), that describes the strategy type they hold. The
+// strategy classes still cross the boundary as C++ objects, so the host only
+// accepts plugins built against the same StrategyBase and C++ ABI; bump
+// WINTER_STRATEGY_PLUGIN_ABI whenever StrategyBase or this struct changes.
+// Plugins resolve winter symbols (real_clock() and friends) from the host
+// executable, which must export them.
+
+#define WINTER_STRATEGY_PLUGIN_ABI 4  // 4: StrategyBase::validate_config
+#define WINTER_STRATEGY_PLUGIN_ENTRY "winter_strategy_plugin"
+
+#ifdef __GXX_ABI_VERSION
+#define WINTER_CXX_ABI __GXX_ABI_VERSION
+#else
+#define WINTER_CXX_ABI 0
+#endif
+
+#ifdef _WIN32
+#define WINTER_PLUGIN_EXPORT __declspec(dllexport)
+#else
+#define WINTER_PLUGIN_EXPORT __attribute__((visibility("default")))
+#endif
+
+extern "C" {
+
+struct WinterStrategyPluginInfo {
+    uint32_t abi_version;    // WINTER_STRATEGY_PLUGIN_ABI at build time
+    uint32_t base_size;      // sizeof(StrategyBase) at build time
+    uint32_t cxx_abi;        // WINTER_CXX_ABI at build time
+    uint32_t state_version;  // Layout of serialize() output; state only moves between equal versions
+    const char* type_name;
+    const char* version;     // Free-form, for logs
+    winter::strategy::StrategyBase* (*create)(const char* instance_name);
+    void (*destroy)(winter::strategy::StrategyBase* strategy);
+};
+
+typedef const WinterStrategyPluginInfo* (*WinterStrategyPluginEntry)();
+
+}
+
+// Defines the entry point of a plugin holding strategy `Type`, which must be
+// constructible from its instance name
+#define WINTER_STRATEGY_PLUGIN(Type, type_name, version, state_version)                                    \
+    extern "C" WINTER_PLUGIN_EXPORT const WinterStrategyPluginInfo* winter_strategy_plugin() {              \
+        static const WinterStrategyPluginInfo info = {                                                     \
+            WINTER_STRATEGY_PLUGIN_ABI, sizeof(::winter::strategy::StrategyBase), WINTER_CXX_ABI,           \
+            state_version, type_name, version,                                                             \
+            [](const char* name) -> ::winter::strategy::StrategyBase* { return new Type(name); },          \
+            [](::winter::strategy::StrategyBase* strategy) { delete strategy; }};                          \
+        return &info;                                                                                      \
+    }
+
+namespace winter {
+namespace utils {
+class PluginLoader;
+}
+
+namespace strategy {
+
+// A loaded strategy plugin. Instances it creates keep the library mapped, so
+// it is unloaded once the plugin object and the last instance are gone.
+class StrategyPlugin {
+private:
+    std::string path_;
+    std::shared_ptr<utils::PluginLoader> library_;
+    const WinterStrategyPluginInfo* info_ = nullptr;
+
+    StrategyPlugin() = default;
+
+public:
+    // Loads the library and checks its ABI; nullptr (with the reason logged)
+    // when it cannot be used. Every call maps a private copy of the file, so a
+    // rebuild at the same path loads as new code while old instances run on.
+    static std::shared_ptr<StrategyPlugin> load(const std::string& path);
+
+    // Instance name defaults to the type name
+    StrategyPtr create(const std::string& instance_name = "") const;
+
+    const std::string& path() const { return path_; }
+    std::string type_name() const { return info_->type_name; }
+    std::string version() const { return info_->version; }
+    uint32_t state_version() const { return info_->state_version; }
+};
+
+using StrategyPluginPtr = std::shared_ptr<StrategyPlugin>;
+
+} // namespace strategy
+} // namespace winter
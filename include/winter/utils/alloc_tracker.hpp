@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace winter::utils {
+
+struct AllocStats {
+    uint64_t allocations = 0;
+    uint64_t deallocations = 0;
+    uint64_t bytes = 0;  // Bytes requested from operator new
+
+    AllocStats operator-(const AllocStats& other) const {
+        return AllocStats{allocations - other.allocations, deallocations - other.deallocations, bytes - other.bytes};
+    }
+};
+
+// Heap allocation counters, per thread and for the whole process.
+//
+// The counters are fed by the global operator new/delete replacements in the
+// opt-in winter_alloc_hooks library. Without it linked in, hooks_installed()
+// is false and every count stays zero.
+class AllocTracker {
+public:
+    static bool hooks_installed();
+
+    // Counts for the calling thread since it started
+    static AllocStats thread_stats();
+    // Counts across all threads since the process started
+    static AllocStats process_stats();
+
+    // Called from the hooks only; must not allocate
+    static void record_allocation(size_t bytes) noexcept;
+    static void record_deallocation() noexcept;
+    static void mark_hooks_installed() noexcept;
+};
+
+// Counts the allocations made by the calling thread while the scope is alive.
+// With log_on_exit set, a non-zero count is logged as a warning on destruction.
+class AllocScope {
+public:
+    explicit AllocScope(std::string name = "", bool log_on_exit = false);
+    ~AllocScope();
+
+    AllocScope(const AllocScope&) = delete;
+    AllocScope& operator=(const AllocScope&) = delete;
+
+    AllocStats stats() const;
+    const std::string& name() const { return name_; }
+
+private:
+    std::string name_;
+    bool log_on_exit_;
+    AllocStats start_;
+};
+
+} // namespace winter::utils
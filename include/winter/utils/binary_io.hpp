@@ -0,0 +1,204 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#include "winter/utils/rolling_window.hpp"
+
+namespace winter::utils {
+
+// Compact binary encoding used for state snapshots and journals.
+// Values are written in native byte order and layout; snapshots are not meant
+// to move between architectures.
+class BinaryWriter {
+private:
+    std::vector<char> buffer_;
+
+public:
+    BinaryWriter() { buffer_.reserve(4096); }
+
+    const std::vector<char>& buffer() const { return buffer_; }
+    const char* data() const { return buffer_.data(); }
+    size_t size() const { return buffer_.size(); }
+    void clear() { buffer_.clear(); }
+
+    void write_bytes(const void* data, size_t size) {
+        const char* bytes = static_cast<const char*>(data);
+        buffer_.insert(buffer_.end(), bytes, bytes + size);
+    }
+
+    template<typename T>
+    void write(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "write() requires a trivially copyable type");
+        write_bytes(&value, sizeof(T));
+    }
+
+    void write_string(std::string_view value) {
+        write<uint32_t>(static_cast<uint32_t>(value.size()));
+        write_bytes(value.data(), value.size());
+    }
+
+    template<typename T>
+    void write_vector(const std::vector<T>& values) {
+        write<uint64_t>(values.size());
+        if (!values.empty()) {
+            write_bytes(values.data(), values.size() * sizeof(T));
+        }
+    }
+
+    template<typename T>
+    void write_deque(const std::deque<T>& values) {
+        write<uint64_t>(values.size());
+        for (const auto& value : values) {
+            write(value);
+        }
+    }
+
+    // Same layout as write_deque(), oldest value first
+    template<typename T>
+    void write_window(const RollingWindow<T>& values) {
+        write<uint64_t>(values.size());
+        for (const auto& value : values) {
+            write(value);
+        }
+    }
+
+    template<typename V>
+    void write_map(const std::unordered_map<std::string, V>& values) {
+        write<uint64_t>(values.size());
+        for (const auto& [key, value] : values) {
+            write_string(key);
+            write(value);
+        }
+    }
+
+    // Overwrites a value written earlier, e.g. a length prefix once the body is known
+    template<typename T>
+    void patch(size_t offset, const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "patch() requires a trivially copyable type");
+        std::memcpy(buffer_.data() + offset, &value, sizeof(T));
+    }
+
+    // Nested blob with a length prefix, so readers can skip unknown sections
+    void write_blob(const BinaryWriter& nested) {
+        write<uint64_t>(nested.size());
+        write_bytes(nested.data(), nested.size());
+    }
+};
+
+// Bounds-checked reader; any short read sets the failure flag and yields
+// zero-initialized values, so callers check ok() once at the end.
+class BinaryReader {
+private:
+    const char* data_;
+    size_t size_;
+    size_t pos_ = 0;
+    bool ok_ = true;
+
+    bool ensure(size_t bytes) {
+        if (!ok_ || size_ - pos_ < bytes) {
+            ok_ = false;
+            return false;
+        }
+        return true;
+    }
+
+public:
+    BinaryReader(const char* data, size_t size) : data_(data), size_(size) {}
+    explicit BinaryReader(const std::vector<char>& buffer) : BinaryReader(buffer.data(), buffer.size()) {}
+
+    bool ok() const { return ok_; }
+    bool at_end() const { return pos_ == size_; }
+    size_t position() const { return pos_; }
+    size_t remaining() const { return size_ - pos_; }
+
+    bool read_bytes(void* out, size_t size) {
+        if (!ensure(size)) {
+            std::memset(out, 0, size);
+            return false;
+        }
+        std::memcpy(out, data_ + pos_, size);
+        pos_ += size;
+        return true;
+    }
+
+    template<typename T>
+    T read() {
+        static_assert(std::is_trivially_copyable_v<T>, "read() requires a trivially copyable type");
+        T value{};
+        read_bytes(&value, sizeof(T));
+        return value;
+    }
+
+    std::string read_string() {
+        uint32_t size = read<uint32_t>();
+        if (!ensure(size)) {
+            return {};
+        }
+        std::string value(data_ + pos_, size);
+        pos_ += size;
+        return value;
+    }
+
+    template<typename T>
+    std::vector<T> read_vector() {
+        uint64_t count = read<uint64_t>();
+        if (count > remaining() / sizeof(T)) {
+            ok_ = false;
+            return {};
+        }
+        std::vector<T> values(count);
+        read_bytes(values.data(), count * sizeof(T));
+        return values;
+    }
+
+    template<typename T>
+    std::deque<T> read_deque() {
+        uint64_t count = read<uint64_t>();
+        std::deque<T> values;
+        for (uint64_t i = 0; i < count && ok_; ++i) {
+            values.push_back(read<T>());
+        }
+        return values;
+    }
+
+    // Refills a window in place, keeping its capacity (and so its newest values)
+    template<typename T>
+    void read_window(RollingWindow<T>& values) {
+        uint64_t count = read<uint64_t>();
+        values.clear();
+        for (uint64_t i = 0; i < count && ok_; ++i) {
+            values.push_back(read<T>());
+        }
+    }
+
+    template<typename V>
+    std::unordered_map<std::string, V> read_map() {
+        uint64_t count = read<uint64_t>();
+        std::unordered_map<std::string, V> values;
+        for (uint64_t i = 0; i < count && ok_; ++i) {
+            std::string key = read_string();
+            values[key] = read<V>();
+        }
+        return values;
+    }
+
+    // Returns a reader over the next length-prefixed blob and skips past it
+    BinaryReader read_blob() {
+        uint64_t size = read<uint64_t>();
+        if (!ensure(size)) {
+            BinaryReader failed(nullptr, 0);
+            failed.ok_ = false;
+            return failed;
+        }
+        BinaryReader nested(data_ + pos_, size);
+        pos_ += size;
+        return nested;
+    }
+};
+
+} // namespace winter::utils
@@ -0,0 +1,46 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+
+namespace winter::utils {
+
+// Append-only file writer with a fixed user-space buffer.
+// Numbers are formatted with std::to_chars so large reports never go
+// through iostreams or intermediate std::string allocations.
+class BufferedWriter {
+private:
+    std::FILE* file_ = nullptr;
+    std::vector<char> buffer_;
+    size_t pos_ = 0;
+    size_t bytes_written_ = 0;
+
+    void flush_buffer();
+
+public:
+    explicit BufferedWriter(const std::string& path, size_t buffer_size = 1 << 20);
+    ~BufferedWriter();
+
+    BufferedWriter(const BufferedWriter&) = delete;
+    BufferedWriter& operator=(const BufferedWriter&) = delete;
+
+    bool is_open() const { return file_ != nullptr; }
+    size_t bytes_written() const { return bytes_written_ + pos_; }
+
+    void write(std::string_view text);
+    void write(char c);
+
+    // Shortest round-trip representation when precision < 0, fixed otherwise
+    void write_double(double value, int precision = -1);
+    void write_int(int64_t value);
+
+    // Writes text as a JSON string literal, escaping quotes and control characters
+    void write_json_string(std::string_view text);
+
+    void flush();
+    void close();
+};
+
+} // namespace winter::utils
@@ -10,6 +10,9 @@
 namespace winter {
 namespace utils {
 
+// Process-wide key=value settings. get<T> locks and re-parses on every call;
+// code on the tick path should parse once into a ConfigSnapshot
+// (typed_config.hpp) using values() instead.
 class Config {
 private:
     std::unordered_map<std::string, std::string> values_;
@@ -89,6 +92,12 @@ public:
         return (it != values_.end()) ? it->second : default_value;
     }
     
+    // Copy of every raw value, e.g. for ConfigSchema::parse
+    std::unordered_map<std::string, std::string> values() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return values_;
+    }
+    
     // Set a value
     template<typename T>
     void set(const std::string& key, const T& value) {
@@ -0,0 +1,75 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <winter/utils/typed_config.hpp>
+
+namespace winter::utils {
+
+// A parsed YAML value: a scalar, a mapping (in file order) or a sequence
+class ConfigNode {
+public:
+    enum class Kind { Scalar, Map, Sequence };
+
+    ConfigNode() = default;
+    explicit ConfigNode(std::string scalar) : scalar_(std::move(scalar)) {}
+    explicit ConfigNode(Kind kind) : kind_(kind) {}
+
+    Kind kind() const { return kind_; }
+    bool is_scalar() const { return kind_ == Kind::Scalar; }
+    bool is_map() const { return kind_ == Kind::Map; }
+    bool is_sequence() const { return kind_ == Kind::Sequence; }
+
+    const std::string& scalar() const { return scalar_; }
+    const std::vector<std::pair<std::string, ConfigNode>>& entries() const { return entries_; }
+    const std::vector<ConfigNode>& items() const { return items_; }
+
+    // nullptr when this is not a map or has no such key
+    const ConfigNode* find(std::string_view key) const;
+
+    void add(std::string key, ConfigNode value) { entries_.emplace_back(std::move(key), std::move(value)); }
+    void append(ConfigNode item) { items_.push_back(std::move(item)); }
+
+private:
+    Kind kind_ = Kind::Scalar;
+    std::string scalar_;
+    std::vector<std::pair<std::string, ConfigNode>> entries_;
+    std::vector<ConfigNode> items_;
+};
+
+// Parser for the YAML subset Winter's config files use: block mappings and
+// sequences nested by indentation, flow sequences ([a, b]), plain and quoted
+// scalars, comments and a leading "---". Anchors, tags, multi-line scalars
+// and mappings inside sequences are rejected with a line number rather than
+// misread.
+class ConfigParser {
+public:
+    static bool parse(std::string_view text, ConfigNode& root, std::string& error);
+    static bool parse_file(const std::string& path, ConfigNode& root, std::string& error);
+};
+
+// winter_config.yaml:
+//
+//   enabled_strategies:
+//     - StatArbitrage
+//   strategy_parameters:
+//     StatArbitrage:
+//       entry_threshold: 1.3
+struct WinterConfig {
+    std::vector<std::string> enabled_strategies;  // Factory type names, in file order
+    std::unordered_map<std::string, ConfigValues> strategy_parameters;
+
+    // Parameters for a strategy type; empty when the file lists none
+    const ConfigValues& parameters_for(const std::string& type) const;
+
+    static bool from_node(const ConfigNode& root, WinterConfig& out, std::string& error);
+    static bool load(const std::string& path, WinterConfig& out, std::string& error);
+};
+
+// "key: old -> new" lines, sorted by key; "(default)" marks an unset side
+std::vector<std::string> diff_config_values(const ConfigValues& before, const ConfigValues& after);
+
+} // namespace winter::utils
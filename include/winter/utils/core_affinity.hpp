@@ -35,6 +35,14 @@ public:
 #endif
     }
     
+    static bool pin_current_thread(int core_id) {
+#ifdef _WIN32
+        return SetThreadAffinityMask(GetCurrentThread(), 1ULL << core_id) != 0;
+#else
+        return pin_thread_to_core(pthread_self(), core_id);
+#endif
+    }
+    
     template<typename T, typename... A>
     static std::unique_ptr<std::thread> create_pinned_thread(int core_id, T&& fn, A&&... args) {
         std::atomic<bool> running{false};
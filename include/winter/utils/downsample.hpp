@@ -0,0 +1,85 @@
+#pragma once
+#include <cstddef>
+#include <cmath>
+
+namespace winter::utils {
+
+// Largest-Triangle-Three-Buckets downsampling (Steinarsson, 2013).
+//
+// Selects at most `threshold` indices out of `n` points, always keeping the
+// first and last point. Within every bucket the point forming the largest
+// triangle with the previously selected point and the average of the next
+// bucket is kept, so spikes and drawdown troughs survive the reduction.
+//
+// Points are read through accessors and selected indices are reported through
+// `emit(index)` in ascending order, which keeps memory use constant regardless
+// of the input size.
+template<typename XFn, typename YFn, typename EmitFn>
+void lttb_downsample(size_t n, size_t threshold, XFn&& x, YFn&& y, EmitFn&& emit) {
+    if (n == 0) {
+        return;
+    }
+
+    // Nothing to reduce
+    if (threshold >= n || threshold < 3) {
+        size_t step = (threshold >= n || threshold == 0) ? 1 : (n + threshold - 1) / threshold;
+        for (size_t i = 0; i < n; i += step) {
+            emit(i);
+        }
+        if (step > 1 && (n - 1) % step != 0) {
+            emit(n - 1);
+        }
+        return;
+    }
+
+    // Bucket size excluding the fixed first and last points
+    const double bucket_size = static_cast<double>(n - 2) / (threshold - 2);
+
+    size_t a = 0;
+    emit(a);
+
+    for (size_t bucket = 0; bucket < threshold - 2; ++bucket) {
+        // Average of the next bucket (or the last point for the final bucket)
+        size_t next_start = static_cast<size_t>((bucket + 1) * bucket_size) + 1;
+        size_t next_end = static_cast<size_t>((bucket + 2) * bucket_size) + 1;
+        if (next_end > n) next_end = n;
+        if (next_start >= next_end) next_start = next_end - 1;
+
+        double avg_x = 0.0;
+        double avg_y = 0.0;
+        for (size_t i = next_start; i < next_end; ++i) {
+            avg_x += static_cast<double>(x(i));
+            avg_y += static_cast<double>(y(i));
+        }
+        const double count = static_cast<double>(next_end - next_start);
+        avg_x /= count;
+        avg_y /= count;
+
+        // Current bucket range
+        size_t start = static_cast<size_t>(bucket * bucket_size) + 1;
+        size_t end = static_cast<size_t>((bucket + 1) * bucket_size) + 1;
+        if (end > n - 1) end = n - 1;
+
+        const double ax = static_cast<double>(x(a));
+        const double ay = static_cast<double>(y(a));
+
+        double max_area = -1.0;
+        size_t selected = start;
+        for (size_t i = start; i < end; ++i) {
+            // Twice the triangle area; the constant factor does not affect the argmax
+            double area = std::abs((ax - avg_x) * (static_cast<double>(y(i)) - ay) -
+                                   (ax - static_cast<double>(x(i))) * (avg_y - ay));
+            if (area > max_area) {
+                max_area = area;
+                selected = i;
+            }
+        }
+
+        emit(selected);
+        a = selected;
+    }
+
+    emit(n - 1);
+}
+
+} // namespace winter::utils
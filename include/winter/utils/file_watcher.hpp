@@ -0,0 +1,33 @@
+#pragma once
+#include <string>
+
+namespace winter::utils {
+
+// Reports writes to one file through inotify. The file's directory is
+// watched rather than the file itself, so saves that write a new file and
+// rename it over the old one are seen as well. Only completed writes
+// (close after writing, rename into place) count, never partial ones.
+// Linux only; elsewhere ok() is false.
+class FileWatcher {
+public:
+    explicit FileWatcher(std::string path);
+    ~FileWatcher();
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    // False when inotify is unavailable or the directory cannot be watched
+    bool ok() const { return fd_ >= 0; }
+    // Non-blocking descriptor, readable while events are pending
+    int fd() const { return fd_; }
+    const std::string& path() const { return path_; }
+
+    // Drains pending events without blocking; true if any was for the file
+    bool changed();
+
+private:
+    std::string path_;
+    std::string name_;  // File name within the watched directory
+    int fd_ = -1;
+};
+
+} // namespace winter::utils
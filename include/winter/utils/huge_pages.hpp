@@ -0,0 +1,18 @@
+#pragma once
+#include <cstddef>
+
+namespace winter::utils {
+
+// Anonymous, page-aligned memory for large long-lived buffers such as queue
+// storage. With use_huge_pages it tries explicit huge pages first and falls
+// back to normal pages with a transparent-huge-page hint.
+struct PageAllocation {
+    void* data = nullptr;
+    size_t size = 0;
+    bool huge_pages = false;  // Backed by explicit huge pages
+};
+
+PageAllocation allocate_pages(size_t bytes, bool use_huge_pages);
+void free_pages(PageAllocation& allocation);
+
+} // namespace winter::utils
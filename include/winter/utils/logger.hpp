@@ -23,9 +23,12 @@ public:
     static Logger& warn();
     static Logger& error();
 
+    // Filtered messages are not formatted, so disabled log lines cost a compare
     template<typename T>
     constexpr Logger& operator<<(const T& value) {
-        stream_ << value;
+        if (level_ >= current_level_) {
+            stream_ << value;
+        }
         return *this;
     }
 
@@ -37,7 +37,8 @@ public:
             throw std::runtime_error("Failed to load plugin: " + path);
         }
 #else
-        handle_ = dlopen(path.c_str(), RTLD_LAZY);
+        // Resolve everything now so a missing symbol fails the load, not a later call
+        handle_ = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
         if (!handle_) {
             throw std::runtime_error("Failed to load plugin: " + std::string(dlerror()));
         }
@@ -0,0 +1,94 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+
+namespace winter::utils {
+
+// Philox4x32-10 counter-based random number generator (Salmon et al., 2011).
+//
+// Every (seed, stream) pair identifies an independent sequence and the state is
+// just a counter, so parallel jobs can derive their own stream from a job index
+// and produce identical results regardless of how work is split across threads.
+// Satisfies UniformRandomBitGenerator for use with <random> and <algorithm>.
+class Philox4x32 {
+private:
+    static constexpr uint32_t M0 = 0xD2511F53;
+    static constexpr uint32_t M1 = 0xCD9E8D57;
+    static constexpr uint32_t W0 = 0x9E3779B9;
+    static constexpr uint32_t W1 = 0xBB67AE85;
+
+    uint32_t key_[2];
+    uint32_t counter_[4];
+    uint32_t output_[4];
+    int index_ = 4;
+
+    static void round(uint32_t* ctr, const uint32_t* key) {
+        uint64_t p0 = static_cast<uint64_t>(M0) * ctr[0];
+        uint64_t p1 = static_cast<uint64_t>(M1) * ctr[2];
+        uint32_t hi0 = static_cast<uint32_t>(p0 >> 32), lo0 = static_cast<uint32_t>(p0);
+        uint32_t hi1 = static_cast<uint32_t>(p1 >> 32), lo1 = static_cast<uint32_t>(p1);
+        uint32_t c1 = ctr[1], c3 = ctr[3];
+        ctr[0] = hi1 ^ c1 ^ key[0];
+        ctr[1] = lo1;
+        ctr[2] = hi0 ^ c3 ^ key[1];
+        ctr[3] = lo0;
+    }
+
+    void generate_block() {
+        uint32_t ctr[4] = {counter_[0], counter_[1], counter_[2], counter_[3]};
+        uint32_t key[2] = {key_[0], key_[1]};
+        for (int r = 0; r < 10; ++r) {
+            round(ctr, key);
+            key[0] += W0;
+            key[1] += W1;
+        }
+        for (int i = 0; i < 4; ++i) output_[i] = ctr[i];
+
+        // Advance the 64-bit block counter; the upper half of the counter holds the stream id
+        if (++counter_[0] == 0) ++counter_[1];
+        index_ = 0;
+    }
+
+public:
+    using result_type = uint32_t;
+
+    explicit Philox4x32(uint64_t seed = 0, uint64_t stream = 0) {
+        key_[0] = static_cast<uint32_t>(seed);
+        key_[1] = static_cast<uint32_t>(seed >> 32);
+        counter_[0] = 0;
+        counter_[1] = 0;
+        counter_[2] = static_cast<uint32_t>(stream);
+        counter_[3] = static_cast<uint32_t>(stream >> 32);
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() {
+        if (index_ == 4) generate_block();
+        return output_[index_++];
+    }
+
+    // Uniform double in [0, 1) with 53 bits of randomness
+    double uniform() {
+        uint64_t hi = (*this)() >> 5;
+        uint64_t lo = (*this)() >> 6;
+        return (hi * 67108864.0 + lo) * (1.0 / 9007199254740992.0);
+    }
+
+    // Uniform integer in [0, n) without modulo bias (Lemire's method)
+    uint32_t below(uint32_t n) {
+        uint64_t m = static_cast<uint64_t>((*this)()) * n;
+        uint32_t low = static_cast<uint32_t>(m);
+        if (low < n) {
+            uint32_t threshold = static_cast<uint32_t>(-n) % n;
+            while (low < threshold) {
+                m = static_cast<uint64_t>((*this)()) * n;
+                low = static_cast<uint32_t>(m);
+            }
+        }
+        return static_cast<uint32_t>(m >> 32);
+    }
+};
+
+} // namespace winter::utils
@@ -0,0 +1,25 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+namespace winter::utils {
+
+// Helpers for running latency-critical threads without page faults or
+// preemption by ordinary tasks. Each returns false and sets `error` when the
+// step is not possible; callers are expected to carry on without it.
+
+// Locks current and future mappings into RAM (mlockall) and stops malloc from
+// returning freed memory to the kernel, so the heap never faults again.
+// Needs CAP_IPC_LOCK or a large enough RLIMIT_MEMLOCK.
+bool lock_process_memory(std::string& error);
+
+// SCHED_FIFO at `priority` (clamped to the valid range) for the calling
+// thread. Needs CAP_SYS_NICE or RLIMIT_RTPRIO.
+bool set_realtime_priority(int priority, std::string& error);
+
+// Writes `bytes` of the calling thread's stack so its pages are resident
+// before the hot loop runs
+constexpr size_t DEFAULT_STACK_PREFAULT = 256 * 1024;
+void prefault_stack(size_t bytes = DEFAULT_STACK_PREFAULT);
+
+} // namespace winter::utils
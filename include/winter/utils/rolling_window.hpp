@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace winter::utils {
+
+// Fixed-capacity window over the most recent values, oldest first.
+//
+// Storage is allocated once at construction; push_back() on a full window
+// overwrites the oldest value, so a rolling indicator never touches the heap
+// after warm-up (unlike std::deque, which frees and allocates nodes as it
+// slides).
+template<typename T>
+class RollingWindow {
+private:
+    std::vector<T> data_;
+    size_t head_ = 0;  // Index of the oldest value
+    size_t size_ = 0;
+
+public:
+    class const_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator() = default;
+        const_iterator(const RollingWindow* window, size_t index) : window_(window), index_(index) {}
+
+        reference operator*() const { return (*window_)[index_]; }
+        reference operator[](difference_type n) const { return (*window_)[index_ + n]; }
+        const_iterator& operator++() { ++index_; return *this; }
+        const_iterator operator++(int) { auto copy = *this; ++index_; return copy; }
+        const_iterator& operator--() { --index_; return *this; }
+        const_iterator operator--(int) { auto copy = *this; --index_; return copy; }
+        const_iterator& operator+=(difference_type n) { index_ += n; return *this; }
+        const_iterator& operator-=(difference_type n) { index_ -= n; return *this; }
+        const_iterator operator+(difference_type n) const { return const_iterator(window_, index_ + n); }
+        const_iterator operator-(difference_type n) const { return const_iterator(window_, index_ - n); }
+        friend const_iterator operator+(difference_type n, const const_iterator& it) { return it + n; }
+        difference_type operator-(const const_iterator& other) const {
+            return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+        }
+        bool operator==(const const_iterator& other) const { return index_ == other.index_; }
+        auto operator<=>(const const_iterator& other) const { return index_ <=> other.index_; }
+
+    private:
+        const RollingWindow* window_ = nullptr;
+        size_t index_ = 0;
+    };
+
+private:
+    // Physical slot of logical index i (< capacity); a compare beats a modulo
+    size_t slot(size_t i) const {
+        size_t index = head_ + i;
+        return index >= data_.size() ? index - data_.size() : index;
+    }
+
+public:
+    RollingWindow() = default;
+    explicit RollingWindow(size_t capacity) : data_(capacity) {}
+
+    size_t capacity() const { return data_.size(); }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    bool full() const { return size_ == data_.size(); }
+
+    // Appends a value, dropping the oldest one when the window is full
+    void push_back(const T& value) {
+        if (data_.empty()) {
+            return;
+        }
+        if (full()) {
+            data_[head_] = value;
+            head_ = slot(1);
+        } else {
+            data_[slot(size_)] = value;
+            ++size_;
+        }
+    }
+
+    void clear() {
+        head_ = 0;
+        size_ = 0;
+    }
+
+    // Index 0 is the oldest value
+    const T& operator[](size_t index) const { return data_[slot(index)]; }
+    const T& front() const { return (*this)[0]; }
+    const T& back() const { return (*this)[size_ - 1]; }
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, size_); }
+};
+
+} // namespace winter::utils
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <winter/utils/huge_pages.hpp>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <new>
+
+namespace winter::utils {
+
+// Single-producer ring buffer sized at runtime.
+//
+// The requested capacity is rounded up to a power of two so indices wrap with
+// a mask, and every slot is usable. Each slot carries a sequence number that
+// hands it between writer and reader, so pop() may also be called from the
+// producer thread, e.g. to evict the oldest item when the ring is full.
+// Storage comes from allocate_pages(), optionally on huge pages.
+template<typename T>
+class SpscRing {
+private:
+    static constexpr size_t CACHE_LINE = 64;
+
+    struct Slot {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    Slot* slots_ = nullptr;
+    size_t capacity_ = 0;
+    size_t mask_ = 0;
+    size_t requested_capacity_ = 0;
+    PageAllocation storage_;
+
+    alignas(CACHE_LINE) std::atomic<size_t> head_{0};
+    alignas(CACHE_LINE) std::atomic<size_t> tail_{0};
+
+    void release() {
+        for (size_t i = 0; i < capacity_; ++i) {
+            slots_[i].~Slot();
+        }
+        free_pages(storage_);
+        slots_ = nullptr;
+        capacity_ = 0;
+        mask_ = 0;
+    }
+
+public:
+    SpscRing() = default;
+    SpscRing(size_t requested_capacity, bool use_huge_pages = false) {
+        reset(requested_capacity, use_huge_pages);
+    }
+    ~SpscRing() { release(); }
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    // Reallocates empty storage; no producer or consumer may be active
+    void reset(size_t requested_capacity, bool use_huge_pages = false) {
+        release();
+        requested_capacity_ = requested_capacity;
+        size_t capacity = std::bit_ceil(requested_capacity < 2 ? size_t{2} : requested_capacity);
+
+        storage_ = allocate_pages(capacity * sizeof(Slot), use_huge_pages);
+        slots_ = static_cast<Slot*>(storage_.data);
+        for (size_t i = 0; i < capacity; ++i) {
+            new (&slots_[i]) Slot{};
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        capacity_ = capacity;
+        mask_ = capacity - 1;
+        head_.store(0, std::memory_order_relaxed);
+        tail_.store(0, std::memory_order_relaxed);
+    }
+
+    // Producer only; false when full or when the slot is still being read
+    bool push(const T& item) {
+        if (capacity_ == 0) {
+            return false;
+        }
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[tail & mask_];
+        if (slot.sequence.load(std::memory_order_acquire) != tail) {
+            return false;
+        }
+        slot.value = item;
+        slot.sequence.store(tail + 1, std::memory_order_release);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer, or the producer evicting; readers claim a slot before copying it
+    bool pop(T& item) {
+        if (capacity_ == 0) {
+            return false;
+        }
+        size_t head = head_.load(std::memory_order_relaxed);
+        while (true) {
+            Slot& slot = slots_[head & mask_];
+            size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            if (sequence != head + 1) {
+                if (static_cast<std::ptrdiff_t>(sequence - (head + 1)) < 0) {
+                    return false;  // Empty
+                }
+                head = head_.load(std::memory_order_relaxed);  // Another reader took it
+                continue;
+            }
+            if (head_.compare_exchange_weak(head, head + 1, std::memory_order_relaxed)) {
+                item = slot.value;
+                slot.sequence.store(head + capacity_, std::memory_order_release);
+                return true;
+            }
+        }
+    }
+
+    bool empty() const {
+        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+    }
+
+    size_t size() const {
+        size_t head = head_.load(std::memory_order_acquire);
+        size_t tail = tail_.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    size_t capacity() const { return capacity_; }
+    size_t requested_capacity() const { return requested_capacity_; }
+    bool on_huge_pages() const { return storage_.huge_pages; }
+};
+
+} // namespace winter::utils
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace winter::utils {
+
+struct CpuInfo {
+    int cpu = 0;
+    int core_id = 0;
+    int package = 0;
+    int node = 0;
+    bool isolated = false;   // isolcpus
+    bool nohz_full = false;  // Tickless when running a single task
+};
+
+// A physical core and its SMT siblings, lowest cpu first
+struct PhysicalCore {
+    std::vector<int> cpus;
+    int node = 0;
+    bool isolated = false;   // Every sibling is isolated
+    bool nohz_full = false;
+};
+
+// CPU layout as reported by sysfs (cpu topology, isolated and nohz_full lists,
+// NUMA node cpulists). Without sysfs every hardware thread is its own core.
+class CpuTopology {
+public:
+    static CpuTopology detect(const std::string& sysfs_root = "/sys/devices/system");
+    // Builds the topology from explicit data (mainly for tests)
+    explicit CpuTopology(std::vector<CpuInfo> cpus);
+
+    const std::vector<CpuInfo>& cpus() const { return cpus_; }
+    const std::vector<PhysicalCore>& cores() const { return cores_; }
+    size_t node_count() const;
+
+    // "0-3,8,10-11" style lists, as used throughout sysfs
+    static std::vector<int> parse_cpu_list(const std::string& list);
+    static std::string format_cpu_list(std::vector<int> cpus);
+
+private:
+    std::vector<CpuInfo> cpus_;
+    std::vector<PhysicalCore> cores_;
+};
+
+// Cores chosen for each thread role; -1 leaves a role unpinned
+struct PlacementPlan {
+    int feed = -1;
+    int strategy = -1;
+    int execution = -1;
+    int logger = -1;          // Logger and other housekeeping threads
+    std::vector<int> pool;    // ThreadPool workers
+    std::vector<std::string> notes;
+
+    std::string describe(const CpuTopology& topology) const;
+};
+
+// Assigns the latency-critical threads (feed, strategy, execution) to their
+// own physical cores, preferring isolated and nohz_full cores on a single NUMA
+// node and keeping cpu 0 for housekeeping. Only one hardware thread of each
+// chosen core is used; no thread of ours goes on its SMT siblings, though
+// the OS may still schedule other work there. The pool gets the remaining
+// non-isolated cores, or shares the housekeeping core when none are left.
+class PlacementPlanner {
+public:
+    explicit PlacementPlanner(CpuTopology topology) : topology_(std::move(topology)) {}
+
+    // pool_workers == 0 gives the pool every core left over
+    PlacementPlan plan(size_t pool_workers = 0) const;
+    const CpuTopology& topology() const { return topology_; }
+
+private:
+    CpuTopology topology_;
+};
+
+} // namespace winter::utils
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace winter::utils {
+
+// Work-stealing task scheduler shared by the backtester, the loaders and the
+// strategies.
+//
+// Every worker owns a deque: it pushes and pops its own tasks at the back and
+// idle workers steal from the front of the others. Tasks posted from outside
+// the pool are spread round-robin. A thread waiting in parallel_for() runs
+// queued tasks instead of blocking, so nested parallel calls from inside a
+// task cannot deadlock the pool.
+class ThreadPool {
+public:
+    // workers == 0 uses one worker per hardware thread. With first_core >= 0,
+    // worker i is pinned to core (first_core + i) modulo the core count.
+    explicit ThreadPool(size_t workers = 0, int first_core = -1);
+    // One worker per entry, pinned to that core (-1 leaves it unpinned)
+    explicit ThreadPool(const std::vector<int>& cores);
+    // Runs every task still queued, then joins the workers
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    size_t size() const { return workers_.size(); }
+    // True when called from one of this pool's workers
+    bool in_worker() const;
+
+    // Fire-and-forget; exceptions escaping the task are logged and dropped
+    void post(std::function<void()> task);
+
+    template<typename F>
+    auto submit(F&& fn) -> std::future<std::invoke_result_t<std::decay_t<F>>> {
+        using R = std::invoke_result_t<std::decay_t<F>>;
+        auto task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(fn));
+        auto future = task->get_future();
+        post([task]() { (*task)(); });
+        return future;
+    }
+
+    // Calls body(chunk_begin, chunk_end) over [begin, end) in chunks of at most
+    // grain items (0 picks a grain giving each worker a few chunks). Returns
+    // once every chunk has run; the first exception thrown is rethrown here.
+    void parallel_for(size_t begin, size_t end, size_t grain,
+                      const std::function<void(size_t, size_t)>& body);
+
+    // Maps every chunk to a partial result, then folds the partials in chunk
+    // order, so the result does not depend on which worker ran what
+    template<typename T, typename Map, typename Combine>
+    T parallel_reduce(size_t begin, size_t end, size_t grain, T identity, Map map, Combine combine) {
+        if (begin >= end) {
+            return identity;
+        }
+        grain = resolve_grain(end - begin, grain);
+        size_t chunks = (end - begin + grain - 1) / grain;
+        std::vector<T> partials(chunks, identity);
+        parallel_for(0, chunks, 1, [&](size_t first, size_t last) {
+            for (size_t c = first; c < last; ++c) {
+                size_t chunk_begin = begin + c * grain;
+                partials[c] = map(chunk_begin, std::min(chunk_begin + grain, end));
+            }
+        });
+        T result = std::move(identity);
+        for (auto& partial : partials) {
+            result = combine(std::move(result), std::move(partial));
+        }
+        return result;
+    }
+
+    // Process-wide pool, created on first use
+    static ThreadPool& shared();
+    // Sets the shared pool's size and pinning; fails once it has been created
+    static bool configure_shared(size_t workers, int first_core = -1);
+    static bool configure_shared(const std::vector<int>& cores);
+
+private:
+    struct Worker {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+        std::thread thread;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::atomic<size_t> next_worker_{0};
+    std::atomic<size_t> pending_{0};  // Tasks queued but not yet taken
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_;
+    std::atomic<bool> stopping_{false};
+
+    void worker_loop(size_t index);
+    // Runs one queued task, preferring the back of home's deque; false if none
+    bool run_one(size_t home);
+    void run_task(std::function<void()>& task);
+    size_t resolve_grain(size_t count, size_t grain) const;
+};
+
+} // namespace winter::utils
@@ -0,0 +1,88 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define WINTER_HAS_RDTSCP 1
+#elif defined(_M_X64)
+#include <intrin.h>
+#define WINTER_HAS_RDTSCP 1
+#else
+#include <chrono>
+#endif
+
+namespace winter::utils {
+
+// Raw timestamp for hot-path instrumentation: one rdtscp (~10 cycles), no
+// syscall and no conversion. Convert with TscClock when the value is reported.
+// Platforms without an invariant TSC fall back to steady_clock nanoseconds.
+inline uint64_t tsc_now() {
+#ifdef WINTER_HAS_RDTSCP
+    unsigned int aux;
+    return __rdtscp(&aux);
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+// Converts TSC stamps to nanoseconds.
+//
+// Calibrated against the monotonic clock once at first use (~10ms spin), then
+// re-anchored lazily whenever a conversion finds the anchor older than the
+// recalibration interval. The tick rate is always measured from the very first
+// anchor, so the longer the process runs the more precise it gets. Conversion
+// parameters are published through a seqlock; readers never block.
+class TscClock {
+private:
+    // Seqlock-protected calibration
+    std::atomic<uint32_t> seq_{0};
+    std::atomic<uint64_t> base_ticks_{0};
+    std::atomic<int64_t> base_ns_{0};
+    std::atomic<int64_t> epoch_offset_ns_{0};  // CLOCK_REALTIME - CLOCK_MONOTONIC
+    std::atomic<double> ns_per_tick_{1.0};
+
+    // First anchor, the baseline for the rate
+    uint64_t origin_ticks_ = 0;
+    int64_t origin_ns_ = 0;
+
+    uint64_t recalibrate_interval_ticks_ = 0;
+    std::atomic<bool> recalibrating_{false};
+
+    TscClock();
+
+    struct Sample {
+        uint64_t ticks;
+        int64_t monotonic_ns;
+        int64_t realtime_ns;
+    };
+    static Sample sample();
+    void publish(const Sample& anchor, double ns_per_tick);
+    void load(uint64_t& base_ticks, int64_t& base_ns, double& ns_per_tick, int64_t& epoch_offset) const;
+
+public:
+    static constexpr int64_t RECALIBRATE_INTERVAL_NS = 1000000000;  // 1s
+
+    static TscClock& instance();
+
+    TscClock(const TscClock&) = delete;
+    TscClock& operator=(const TscClock&) = delete;
+
+    // Stamp -> monotonic nanoseconds
+    int64_t to_ns(uint64_t ticks);
+    // Stamp -> nanoseconds since the Unix epoch
+    int64_t to_epoch_ns(uint64_t ticks);
+    // Difference of two stamps in nanoseconds; never triggers recalibration
+    double elapsed_ns(uint64_t start, uint64_t end) const {
+        return static_cast<double>(end - start) * ns_per_tick_.load(std::memory_order_relaxed);
+    }
+
+    int64_t now_ns() { return to_ns(tsc_now()); }
+    int64_t now_epoch_ns() { return to_epoch_ns(tsc_now()); }
+
+    double ns_per_tick() const { return ns_per_tick_.load(std::memory_order_relaxed); }
+    void recalibrate();
+};
+
+} // namespace winter::utils
@@ -0,0 +1,216 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace winter::utils {
+
+using ConfigValues = std::unordered_map<std::string, std::string>;
+
+namespace config_detail {
+
+// Whole-string conversions; false on trailing garbage or overflow
+bool parse_value(std::string_view text, double& out);
+bool parse_value(std::string_view text, int& out);
+bool parse_value(std::string_view text, int64_t& out);
+bool parse_value(std::string_view text, size_t& out);
+bool parse_value(std::string_view text, bool& out);  // true/false, yes/no, on/off, 1/0
+bool parse_value(std::string_view text, std::string& out);
+
+std::string format_value(double value);
+std::string format_value(int value);
+std::string format_value(int64_t value);
+std::string format_value(size_t value);
+std::string format_value(bool value);
+std::string format_value(const std::string& value);
+
+} // namespace config_detail
+
+// Declares the fields of a parameter struct T: names, types, optional ranges
+// and cross-field rules. parse() turns string key/value pairs into a T once,
+// starting from T's defaults, so nothing downstream looks strings up again.
+//
+//   struct Params {
+//       double entry = 2.0;
+//       static const ConfigSchema<Params>& schema() {
+//           static const auto s = ConfigSchema<Params>().field("entry", &Params::entry, 0.0, 10.0);
+//           return s;
+//       }
+//   };
+template<typename T>
+class ConfigSchema {
+private:
+    struct Field {
+        std::string name;
+        std::function<bool(std::string_view, T&, std::string&)> parse;
+        std::function<std::string(const T&)> format;
+    };
+    struct Rule {
+        std::string description;
+        std::function<bool(const T&)> holds;
+    };
+
+    std::vector<Field> fields_;
+    std::vector<Rule> rules_;
+
+public:
+    template<typename V>
+    ConfigSchema& field(std::string name, V T::*member) {
+        fields_.push_back(Field{
+            std::move(name),
+            [member](std::string_view text, T& out, std::string& error) {
+                if (!config_detail::parse_value(text, out.*member)) {
+                    error = "cannot parse '" + std::string(text) + "'";
+                    return false;
+                }
+                return true;
+            },
+            [member](const T& value) { return config_detail::format_value(value.*member); }});
+        return *this;
+    }
+
+    // Inclusive range
+    template<typename V>
+    ConfigSchema& field(std::string name, V T::*member, V min, V max) {
+        fields_.push_back(Field{
+            std::move(name),
+            [member, min, max](std::string_view text, T& out, std::string& error) {
+                V value{};
+                if (!config_detail::parse_value(text, value)) {
+                    error = "cannot parse '" + std::string(text) + "'";
+                    return false;
+                }
+                if (value < min || value > max) {
+                    error = config_detail::format_value(value) + " outside [" + config_detail::format_value(min) +
+                            ", " + config_detail::format_value(max) + "]";
+                    return false;
+                }
+                out.*member = value;
+                return true;
+            },
+            [member](const T& value) { return config_detail::format_value(value.*member); }});
+        return *this;
+    }
+
+    // Rule over the parsed struct, e.g. exit threshold below entry threshold
+    ConfigSchema& check(std::string description, std::function<bool(const T&)> holds) {
+        rules_.push_back(Rule{std::move(description), std::move(holds)});
+        return *this;
+    }
+
+    // T's defaults overridden by `values`. Unknown keys, unparsable or
+    // out-of-range values and broken rules are all errors; on any error `out`
+    // is left untouched.
+    bool parse(const ConfigValues& values, T& out, std::vector<std::string>& errors) const {
+        T parsed{};
+        const size_t first_error = errors.size();
+        for (const auto& [key, text] : values) {
+            const Field* field = find(key);
+            if (!field) {
+                errors.push_back("unknown parameter '" + key + "'");
+                continue;
+            }
+            std::string error;
+            if (!field->parse(text, parsed, error)) {
+                errors.push_back(key + ": " + error);
+            }
+        }
+        if (errors.size() == first_error) {
+            for (const auto& rule : rules_) {
+                if (!rule.holds(parsed)) {
+                    errors.push_back("violates rule: " + rule.description);
+                }
+            }
+        }
+        if (errors.size() != first_error) {
+            return false;
+        }
+        out = std::move(parsed);
+        return true;
+    }
+
+    // Every field as name/value text, in declaration order
+    std::vector<std::pair<std::string, std::string>> describe(const T& value) const {
+        std::vector<std::pair<std::string, std::string>> out;
+        out.reserve(fields_.size());
+        for (const auto& field : fields_) {
+            out.emplace_back(field.name, field.format(value));
+        }
+        return out;
+    }
+
+private:
+    const Field* find(const std::string& name) const {
+        for (const auto& field : fields_) {
+            if (field.name == name) {
+                return &field;
+            }
+        }
+        return nullptr;
+    }
+};
+
+// Immutable snapshots of a parameter struct behind an atomic pointer. get()
+// is one acquire load, after which fields are plain member reads; update()
+// validates and publishes a new snapshot and releases the old one.
+//
+// get() is for the thread that also publishes, i.e. the strategy thread (the
+// engine applies configs there, or while that thread is paused): the
+// reference stays valid until that thread's next publish. Work running on
+// other threads, such as pool tasks, takes snapshot() once and keeps it for
+// as long as it reads parameters; a snapshot outlives any later publish.
+// T must provide a static schema().
+template<typename T>
+class ConfigSnapshot {
+private:
+    std::atomic<const T*> current_{nullptr};
+    mutable std::mutex publish_mutex_;
+    std::shared_ptr<const T> current_owner_;  // Guarded by publish_mutex_
+    std::atomic<uint64_t> version_{0};
+
+public:
+    ConfigSnapshot() { publish(T{}); }
+    ConfigSnapshot(const ConfigSnapshot&) = delete;
+    ConfigSnapshot& operator=(const ConfigSnapshot&) = delete;
+
+    const T& get() const { return *current_.load(std::memory_order_acquire); }
+    const T* operator->() const { return &get(); }
+    // Shared ownership of the current snapshot, safe from any thread
+    std::shared_ptr<const T> snapshot() const {
+        std::lock_guard<std::mutex> lock(publish_mutex_);
+        return current_owner_;
+    }
+    // Bumped on every publish
+    uint64_t version() const { return version_.load(std::memory_order_acquire); }
+
+    void publish(T value) {
+        auto next = std::make_shared<const T>(std::move(value));
+        std::shared_ptr<const T> released;
+        {
+            std::lock_guard<std::mutex> lock(publish_mutex_);
+            current_.store(next.get(), std::memory_order_release);
+            released = std::exchange(current_owner_, std::move(next));
+            version_.fetch_add(1, std::memory_order_acq_rel);
+        }
+        // Freed here unless a snapshot() holder still has it
+    }
+
+    // Parses and publishes; on errors the current snapshot stays
+    bool update(const ConfigValues& values, std::vector<std::string>& errors) {
+        T parsed{};
+        if (!T::schema().parse(values, parsed, errors)) {
+            return false;
+        }
+        publish(std::move(parsed));
+        return true;
+    }
+};
+
+} // namespace winter::utils
@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+"""Compare microbenchmark results against a stored baseline.
+
+Usage:
+    compare_benchmarks.py BASELINE.json CURRENT.json [--tolerance PCT]
+                          [--min-delta-ns NS] [--filter SUBSTRING]
+
+Both files are written by `microbenchmarks --output`. A benchmark regresses
+when its median ns/op is more than PCT percent above the baseline and also
+more than NS nanoseconds slower, so nanosecond-scale cases are not flagged on
+noise. Exits with status 1 if anything regressed, 0 otherwise.
+
+Timings only mean something against a baseline from the same kind of
+machine: runs whose context (hardware threads, CPU model) differs are not
+compared, and the script exits with status 2.
+"""
+
+import argparse
+import json
+import sys
+
+
+CONTEXT_KEYS = ("hardware_concurrency", "cpu_model")
+
+
+def load(path):
+    with open(path) as f:
+        data = json.load(f)
+    return data.get("context", {}), {b["name"]: b for b in data["benchmarks"]}
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Flag microbenchmark regressions against a baseline")
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--tolerance", type=float, default=10.0,
+                        help="allowed slowdown in percent (default 10)")
+    parser.add_argument("--min-delta-ns", type=float, default=1.0,
+                        help="ignore slowdowns smaller than this many ns/op (default 1)")
+    parser.add_argument("--filter", default="", help="only compare benchmarks whose name contains this")
+    args = parser.parse_args()
+
+    baseline_context, baseline = load(args.baseline)
+    current_context, current = load(args.current)
+
+    mismatched = [key for key in CONTEXT_KEYS if baseline_context.get(key) != current_context.get(key)]
+    if mismatched:
+        print("Not comparable: the runs come from different machines")
+        for key in mismatched:
+            print(f"  {key}: baseline {baseline_context.get(key)!r}, current {current_context.get(key)!r}")
+        print("Record a baseline on this machine with `microbenchmarks --output`.")
+        return 2
+
+    regressions = 0
+    print(f"{'Benchmark':<48}{'baseline':>12}{'current':>12}{'change':>10}")
+    for name, result in current.items():
+        if args.filter not in name:
+            continue
+        base = baseline.get(name)
+        if base is None:
+            print(f"{name:<48}{'-':>12}{result['ns_per_op']:>12.2f}{'new':>10}")
+            continue
+
+        before = base["ns_per_op"]
+        after = result["ns_per_op"]
+        change = (after - before) / before * 100.0 if before > 0 else 0.0
+        regressed = change > args.tolerance and after - before > args.min_delta_ns
+        regressions += regressed
+        marker = "  REGRESSION" if regressed else ""
+        print(f"{name:<48}{before:>12.2f}{after:>12.2f}{change:>+9.1f}%{marker}")
+
+    for name in baseline:
+        if args.filter in name and name not in current:
+            print(f"{name:<48}{baseline[name]['ns_per_op']:>12.2f}{'-':>12}{'missing':>10}")
+
+    if regressions:
+        print(f"\n{regressions} benchmark(s) regressed by more than {args.tolerance}%")
+        return 1
+    print(f"\nNo regressions beyond {args.tolerance}%")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
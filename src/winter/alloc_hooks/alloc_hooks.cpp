@@ -0,0 +1,73 @@
+#include <winter/utils/alloc_tracker.hpp>
+#include <cstdlib>
+#include <new>
+
+// Global operator new/delete replacements feeding AllocTracker. Built as the
+// separate winter_alloc_hooks object library and linked only into the
+// executables that want allocation counts; the winter library never pulls it in.
+
+using winter::utils::AllocTracker;
+
+namespace {
+
+const bool hooks_registered = (AllocTracker::mark_hooks_installed(), true);
+
+void* allocate(size_t size) {
+    AllocTracker::record_allocation(size);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* allocate_aligned(size_t size, std::align_val_t alignment) {
+    AllocTracker::record_allocation(size);
+    size_t align = static_cast<size_t>(alignment);
+    // aligned_alloc wants a size that is a multiple of the alignment
+    size_t rounded = (size == 0 ? align : (size + align - 1) / align * align);
+    if (void* p = std::aligned_alloc(align, rounded)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void release(void* p) noexcept {
+    if (p) {
+        AllocTracker::record_deallocation();
+        std::free(p);
+    }
+}
+
+} // namespace
+
+void* operator new(size_t size) { return allocate(size); }
+void* operator new[](size_t size) { return allocate(size); }
+void* operator new(size_t size, std::align_val_t alignment) { return allocate_aligned(size, alignment); }
+void* operator new[](size_t size, std::align_val_t alignment) { return allocate_aligned(size, alignment); }
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return allocate(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return allocate(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void operator delete(void* p) noexcept { release(p); }
+void operator delete[](void* p) noexcept { release(p); }
+void operator delete(void* p, size_t) noexcept { release(p); }
+void operator delete[](void* p, size_t) noexcept { release(p); }
+void operator delete(void* p, std::align_val_t) noexcept { release(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { release(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { release(p); }
+void operator delete[](void* p, size_t, std::align_val_t) noexcept { release(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { release(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { release(p); }
@@ -1,12 +1,18 @@
 #include <winter/backtest/backtest_engine.hpp>
+#include <winter/backtest/report.hpp>
+#include <winter/backtest/csv_loader.hpp>
+#include <winter/core/checkpoint.hpp>
+#include <winter/utils/thread_placement.hpp>
+#include <winter/utils/thread_pool.hpp>
+#include <winter/utils/tsc_clock.hpp>
 #include <iomanip>
 #include <ctime>
 #include <numeric>
 #include <cmath>
 #include <cstring>
 #include <memory>
+#include <span>
 #include <thread>
-#include <execution>
 #include <csignal>
 #include <filesystem>
 #include <iostream>
@@ -23,7 +29,11 @@ BacktestEngine::BacktestEngine() : running_(false), processed_count_(0) {
     config_.engine_config.order_queue_size = 50000;
     config_.engine_config.batch_size = 1000;
     
+    // Decisions follow tick time and tick order, not machine speed
+    config_.engine_config.sequential_fills = true;
+    
     engine_.configure(config_.engine_config);
+    engine_.set_clock(std::make_shared<winter::core::SimulatedClock>());
     
     // Register signal handler
     std::signal(SIGINT, [](int signal) {
@@ -58,161 +68,26 @@ bool BacktestEngine::initialize(double initial_capital) {
     return true;
 }
 
-bool BacktestEngine::load_data(const std::string& csv_file) {
-    return load_csv_data(csv_file);
-}
-
-bool BacktestEngine::add_strategy(std::shared_ptr<winter::strategy::StrategyBase> strategy) {
-    engine_.add_strategy(strategy);
+bool BacktestEngine::load_data(const std::string& data_file) {
+    std::vector<winter::core::MarketData> data;
+    if (!load_market_data(data_file, data)) {
+        return false;
+    }
+    set_data(std::move(data));
     return true;
 }
 
-bool BacktestEngine::load_csv_data(const std::string& csv_file) {
-    auto start_time = std::chrono::high_resolution_clock::now();
-    
-    // Check if file exists
-    if (!std::filesystem::exists(csv_file)) {
-        winter::utils::Logger::error() << "CSV file does not exist: " << csv_file << winter::utils::Logger::endl;
-        return false;
-    }
-    
-    // Get file size for progress reporting
-    size_t file_size = std::filesystem::file_size(csv_file);
-    
-    // Open file
-    std::ifstream file(csv_file);
-    if (!file.is_open()) {
-        winter::utils::Logger::error() << "Failed to open CSV file: " << csv_file << winter::utils::Logger::endl;
-        return false;
-    }
-    
-    // Clear existing data
-    historical_data_.clear();
-    
-    // Reserve memory based on estimated line count (assume average line length of 100 bytes)
-    size_t estimated_lines = file_size / 100;
-    historical_data_.reserve(estimated_lines);
-    
-    std::string line;
-    // Skip header line
-    std::getline(file, line);
-    
-    // Read all lines into a buffer for parallel processing
-    std::vector<std::string> lines;
-    lines.reserve(estimated_lines);
-    
-    winter::utils::Logger::info() << "Reading CSV file..." << winter::utils::Logger::endl;
-    
-    while (std::getline(file, line)) {
-        lines.push_back(line);
-    }
-    
-    winter::utils::Logger::info() << "Read " << lines.size() << " lines from CSV file" << winter::utils::Logger::endl;
-    
-    // Define a lambda for parsing a single line
-    auto parse_line = [](const std::string& line) -> std::optional<winter::core::MarketData> {
-        std::stringstream ss(line);
-        std::string time, symbol, market_center, price_str, size_str;
-        std::string cum_bats_vol, cum_sip_vol, sip_complete, last_sale;
-        
-        // Parse CSV columns: Time,Symbol,Market Center,Price,Size,...
-        std::getline(ss, time, ',');
-        std::getline(ss, symbol, ',');
-        std::getline(ss, market_center, ',');
-        std::getline(ss, price_str, ',');
-        std::getline(ss, size_str, ',');
-        std::getline(ss, cum_bats_vol, ',');
-        std::getline(ss, cum_sip_vol, ',');
-        std::getline(ss, sip_complete, ',');
-        std::getline(ss, last_sale, ',');
-        
-        if (time.empty() || symbol.empty() || price_str.empty() || size_str.empty()) {
-            return std::nullopt;
-        }
-        
-        try {
-            double price = std::stod(price_str);
-            int volume = std::stoi(size_str);
-            
-            winter::core::MarketData data;
-            data.symbol = symbol;
-            data.price = price;
-            data.volume = volume;
-            
-            // Use line index as timestamp for simplicity
-            static std::atomic<int64_t> timestamp_counter(0);
-            data.timestamp = timestamp_counter++;
-            
-            return data;
-        } catch (const std::exception& e) {
-            // Don't log every parsing error to avoid flooding the console
-            return std::nullopt;
-        }
-    };
-    
-    winter::utils::Logger::info() << "Parsing CSV data in parallel..." << winter::utils::Logger::endl;
-    
-    // Process lines in batches to avoid excessive memory usage
-    const size_t BATCH_SIZE = 100000;
-    size_t total_processed = 0;
-    
-    for (size_t batch_start = 0; batch_start < lines.size(); batch_start += BATCH_SIZE) {
-        size_t batch_end = std::min(batch_start + BATCH_SIZE, lines.size());
-        size_t batch_size = batch_end - batch_start;
-        
-        std::vector<std::optional<winter::core::MarketData>> results(batch_size);
-        
-        // Parse lines in parallel
-        std::transform(
-            std::execution::par_unseq,
-            lines.begin() + batch_start, 
-            lines.begin() + batch_end,
-            results.begin(),
-            parse_line
-        );
-        
-        // Reserve space for valid results
-        size_t valid_count = 0;
-        for (const auto& result : results) {
-            if (result) valid_count++;
-        }
-        
-        // Add valid results to historical data
-        historical_data_.reserve(historical_data_.size() + valid_count);
-        for (auto& result : results) {
-            if (result) {
-                historical_data_.push_back(*result);
-                total_processed++;
-            }
-        }
-        
-        // Report progress
-        double progress = static_cast<double>(batch_end) / lines.size() * 100.0;
-        winter::utils::Logger::info() << "Parsing progress: " << std::fixed << std::setprecision(1) 
-                                     << progress << "% (" << total_processed << " valid data points)" 
-                                     << winter::utils::Logger::endl;
-    }
-    
-    winter::utils::Logger::info() << "Sorting data by timestamp..." << winter::utils::Logger::endl;
-    
-    // Sort data by timestamp to ensure chronological order
-    std::sort(std::execution::par_unseq, historical_data_.begin(), historical_data_.end(),
-              [](const winter::core::MarketData& a, const winter::core::MarketData& b) {
-                  return a.timestamp < b.timestamp;
-              });
-    
-    auto end_time = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time).count();
-    
-    winter::utils::Logger::info() << "Loaded " << historical_data_.size() << " data points from " 
-                                 << lines.size() << " total lines in " << csv_file 
-                                 << " (" << duration << "ms)" << winter::utils::Logger::endl;
+void BacktestEngine::set_data(std::vector<winter::core::MarketData> data) {
+    historical_data_ = std::move(data);
     
     // Set date range (placeholder - in a real implementation, extract from data)
     start_date_ = "2021-01-01";
     end_date_ = "2021-12-31";
-    
-    return !historical_data_.empty();
+}
+
+bool BacktestEngine::add_strategy(std::shared_ptr<winter::strategy::StrategyBase> strategy) {
+    engine_.add_strategy(strategy);
+    return true;
 }
 
 void BacktestEngine::process_data_chunk(size_t start, size_t end) {
@@ -229,14 +104,11 @@ void BacktestEngine::process_data_chunk(size_t start, size_t end) {
         size_t batch_end = std::min(batch_start + BATCH_SIZE, end);
         size_t batch_size = batch_end - batch_start;
         
-        // Create a batch of market data
-        std::vector<winter::core::MarketData> batch(
-            historical_data_.begin() + batch_start,
-            historical_data_.begin() + batch_end
-        );
-        
-        // Process the batch
-        engine_.process_market_data_batch(batch);
+        // Hand the engine a view of the batch; the strategy thread reads it in place
+        std::span<const winter::core::MarketData> batch(historical_data_.data() + batch_start, batch_size);
+        while (!engine_.try_process_market_data_view(batch) && running_) {
+            std::this_thread::yield();
+        }
         
         // Update equity curve (thread-safe)
         {
@@ -268,20 +140,93 @@ void BacktestEngine::process_data_chunk(size_t start, size_t end) {
                                  << processed_in_this_chunk << " data points" << winter::utils::Logger::endl;
 }
 
+void BacktestEngine::process_data_ordered(size_t start, size_t end) {
+    const size_t BATCH_SIZE = std::max<size_t>(1, config_.batch_size);
+    
+    for (size_t batch_start = start; batch_start < end && running_; batch_start += BATCH_SIZE) {
+        size_t batch_end = std::min(batch_start + BATCH_SIZE, end);
+        
+        std::span<const winter::core::MarketData> batch(historical_data_.data() + batch_start, batch_end - batch_start);
+        while (!engine_.try_process_market_data_view(batch)) {
+            std::this_thread::yield();
+        }
+        
+        // Wait for the strategies to consume the batch so every recorded equity
+        // point lies at or before the engine's tick offset
+        while (engine_.ticks_processed() < batch_end && engine_.is_running()) {
+            std::this_thread::yield();
+        }
+        
+        {
+            std::lock_guard<std::mutex> lock(equity_mutex_);
+            EquityPoint point;
+            point.timestamp = historical_data_[batch_end - 1].timestamp;
+            point.equity = engine_.portfolio().total_value();
+            equity_curve_.push_back(point);
+        }
+        
+        processed_count_ = batch_end;
+    }
+}
+
+void BacktestEngine::save_checkpoint_state(winter::utils::BinaryWriter& out) {
+    std::lock_guard<std::mutex> lock(equity_mutex_);
+    out.write(initial_balance_);
+    out.write<uint64_t>(equity_curve_.size());
+    for (const auto& point : equity_curve_) {
+        out.write(point.timestamp);
+        out.write(point.equity);
+        out.write_string(point.symbol);
+        out.write_string(point.trade_type);
+    }
+}
+
+bool BacktestEngine::load_checkpoint_state(winter::utils::BinaryReader& in) {
+    std::lock_guard<std::mutex> lock(equity_mutex_);
+    initial_balance_ = in.read<double>();
+    equity_curve_.clear();
+    uint64_t count = in.read<uint64_t>();
+    for (uint64_t i = 0; i < count && in.ok(); ++i) {
+        EquityPoint point;
+        point.timestamp = in.read<int64_t>();
+        point.equity = in.read<double>();
+        point.symbol = in.read_string();
+        point.trade_type = in.read_string();
+        equity_curve_.push_back(std::move(point));
+    }
+    return in.ok();
+}
+
+bool BacktestEngine::resume_from_checkpoint(const std::string& checkpoint_file) {
+    bool restored = winter::core::Checkpointer::restore(engine_, checkpoint_file,
+        [this](winter::utils::BinaryReader& in) { return load_checkpoint_state(in); });
+    if (!restored) {
+        return false;
+    }
+    
+    resume_offset_ = engine_.ticks_processed();
+    winter::utils::Logger::info() << "Resuming backtest from tick " << resume_offset_ 
+                                 << " (" << equity_curve_.size() << " equity points restored)" << winter::utils::Logger::endl;
+    return true;
+}
+
 bool BacktestEngine::run_backtest() {
     if (historical_data_.empty()) {
         winter::utils::Logger::error() << "No historical data loaded for backtest" << winter::utils::Logger::endl;
         return false;
     }
     
-    auto start_time = std::chrono::high_resolution_clock::now();
+    uint64_t start_tsc = winter::utils::tsc_now();
     
-    // Start the engine
-    engine_.start(0, 1);
+    // Start the engine on the cores the placement planner picks
+    winter::utils::CpuTopology topology = winter::utils::CpuTopology::detect();
+    winter::utils::PlacementPlan placement = winter::utils::PlacementPlanner(topology).plan();
+    winter::utils::Logger::info() << placement.describe(topology) << winter::utils::Logger::endl;
+    engine_.start(placement.strategy, placement.execution);
     
     // Set running flag
     running_ = true;
-    processed_count_ = 0;
+    processed_count_ = resume_offset_;
     
     // Setup order callback to record trades in equity curve
     engine_.set_order_callback([&](const winter::core::Order& order) {
@@ -294,34 +239,44 @@ bool BacktestEngine::run_backtest() {
         point.symbol = order.symbol;
         point.trade_type = order.side == winter::core::OrderSide::BUY ? "BUY" : "SELL";
         equity_curve_.push_back(point);
+        
+        if (fill_callback_) {
+            fill_callback_(order, engine_.clock()->now_us());
+        }
     });
     
     // Determine optimal chunk size and thread count
     size_t data_size = historical_data_.size();
-    size_t thread_count = config_.thread_count;
+    size_t thread_count = std::max<size_t>(1, config_.thread_count);
     size_t chunk_size = data_size / thread_count;
     
-    winter::utils::Logger::info() << "Starting backtest with " << thread_count << " threads, processing " 
+    winter::utils::Logger::info() << "Starting backtest with " << thread_count << " chunks on "
+                                 << winter::utils::ThreadPool::shared().size() << " pool workers, processing " 
                                  << data_size << " data points in chunks of " << chunk_size << winter::utils::Logger::endl;
     
     // Setup progress reporting thread
     std::thread progress_thread([&]() {
-        size_t last_processed = 0;
-        auto start_time = std::chrono::high_resolution_clock::now();
+        size_t last_processed = processed_count_;
+        uint64_t last_tsc = winter::utils::tsc_now();
         
         while (running_ && processed_count_ < historical_data_.size()) {
-            std::this_thread::sleep_for(std::chrono::seconds(1));
+            // Report once a second, but notice the end of a short run promptly
+            for (int slice = 0; slice < 20 && running_; ++slice) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            }
             
+            // Rate over the measured interval rather than the nominal second
             size_t current_processed = processed_count_;
-            size_t points_per_second = current_processed - last_processed;
+            uint64_t now_tsc = winter::utils::tsc_now();
+            double interval_seconds = winter::utils::TscClock::instance().elapsed_ns(last_tsc, now_tsc) / 1e9;
+            size_t points_per_second = interval_seconds > 0.0 ?
+                static_cast<size_t>((current_processed - last_processed) / interval_seconds) : 0;
             last_processed = current_processed;
+            last_tsc = now_tsc;
             
             double progress = static_cast<double>(current_processed) / historical_data_.size() * 100.0;
             
             // Calculate estimated time remaining
-            auto elapsed = std::chrono::high_resolution_clock::now() - start_time;
-            auto elapsed_seconds = std::chrono::duration_cast<std::chrono::seconds>(elapsed).count();
-            
             double points_remaining = historical_data_.size() - current_processed;
             double estimated_seconds_remaining = (points_per_second > 0) ? 
                                                points_remaining / points_per_second : 0;
@@ -335,20 +290,31 @@ bool BacktestEngine::run_backtest() {
         std::cout << "\rProgress: 100.0% (Complete)" << std::endl;
     });
     
-    // Process data in parallel chunks
-    std::vector<std::future<void>> futures;
-    for (size_t t = 0; t < thread_count; ++t) {
-        size_t start = t * chunk_size;
-        size_t end = (t == thread_count - 1) ? data_size : (t + 1) * chunk_size;
+    if (config_.ordered_feed || !config_.checkpoint_path.empty() || resume_offset_ > 0) {
+        // Checkpoints need a contiguous tick offset, so feed the engine in order
+        std::unique_ptr<winter::core::Checkpointer> checkpointer;
+        if (!config_.checkpoint_path.empty()) {
+            checkpointer = std::make_unique<winter::core::Checkpointer>(
+                engine_, config_.checkpoint_path,
+                std::chrono::milliseconds(static_cast<int64_t>(config_.checkpoint_interval_seconds * 1000.0)));
+            checkpointer->set_save_hook([this](winter::utils::BinaryWriter& out) { save_checkpoint_state(out); });
+            checkpointer->start(placement.logger);
+        }
         
-        futures.push_back(std::async(std::launch::async, 
-            [this, start, end]() { this->process_data_chunk(start, end); }
-        ));
-    }
-    
-    // Wait for all threads to complete or for interruption
-    for (auto& future : futures) {
-        future.wait();
+        process_data_ordered(std::min(resume_offset_, data_size), data_size);
+        
+        if (checkpointer) {
+            checkpointer->stop();
+        }
+    } else {
+        // Process data in parallel chunks on the shared pool
+        winter::utils::ThreadPool::shared().parallel_for(0, data_size, std::max<size_t>(1, chunk_size),
+            [this](size_t start, size_t end) { process_data_chunk(start, end); });
+        
+        // The engine reads the tick store in place, so let it drain before stopping
+        while (running_ && engine_.ticks_processed() < data_size && engine_.is_running()) {
+            std::this_thread::yield();
+        }
     }
     
     // Set running flag to false to stop progress thread
@@ -361,9 +327,10 @@ bool BacktestEngine::run_backtest() {
     
     // Stop the engine
     engine_.stop();
+    resume_offset_ = 0;
     
-    auto end_time = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time).count();
+    auto duration = static_cast<int64_t>(
+        winter::utils::TscClock::instance().elapsed_ns(start_tsc, winter::utils::tsc_now()) / 1e6);
     
     winter::utils::Logger::info() << "Backtest completed in " << duration << "ms" << winter::utils::Logger::endl;
     
@@ -372,14 +339,6 @@ bool BacktestEngine::run_backtest() {
 
 void BacktestEngine::stop_backtest() {
     running_ = false;
-    
-    // Wait for all worker threads to finish
-    for (auto& thread : worker_threads_) {
-        if (thread.joinable()) {
-            thread.join();
-        }
-    }
-    worker_threads_.clear();
 }
 
 double BacktestEngine::get_progress() const {
@@ -388,11 +347,17 @@ double BacktestEngine::get_progress() const {
 }
 
 PerformanceMetrics BacktestEngine::calculate_performance_metrics() {
+    return compute_metrics(equity_curve_, engine_.portfolio().get_trades(), initial_balance_);
+}
+
+PerformanceMetrics BacktestEngine::compute_metrics(const std::vector<EquityPoint>& equity_curve,
+                                                   const std::vector<winter::core::Trade>& trades,
+                                                   double initial_capital) {
     PerformanceMetrics metrics;
     
     // Basic metrics
-    metrics.initial_capital = initial_balance_;
-    metrics.final_capital = equity_curve_.empty() ? initial_balance_ : equity_curve_.back().equity;
+    metrics.initial_capital = initial_capital;
+    metrics.final_capital = equity_curve.empty() ? initial_capital : equity_curve.back().equity;
     metrics.total_return = metrics.final_capital - metrics.initial_capital;
     metrics.total_return_pct = (metrics.initial_capital != 0) ? 
                               (metrics.total_return / metrics.initial_capital) * 100.0 : 0.0;
@@ -407,31 +372,19 @@ PerformanceMetrics BacktestEngine::calculate_performance_metrics() {
                                std::pow((metrics.final_capital / metrics.initial_capital), (1.0 / years)) - 1.0 : 0.0;
     
     // Extract daily returns
-    // In a real implementation, group equity points by day and calculate daily returns
-    std::vector<double> returns;
-    double prev_equity = initial_balance_;
-    for (size_t i = 1; i < equity_curve_.size(); ++i) {
-        // Only consider points at day boundaries
-        if (i % 1000 == 0) {  // Simplified - use actual day boundaries in real implementation
-            double current_equity = equity_curve_[i].equity;
-            double daily_return = (current_equity / prev_equity) - 1.0;
-            returns.push_back(daily_return);
-            prev_equity = current_equity;
-        }
-    }
+    std::vector<double> returns = extract_period_returns(equity_curve, initial_capital);
     
     // Sharpe ratio
     metrics.sharpe_ratio = calculate_sharpe_ratio(returns);
     
     // Maximum drawdown
     double duration = 0.0;
-    metrics.max_drawdown = calculate_max_drawdown(equity_curve_, duration);
+    metrics.max_drawdown = calculate_max_drawdown(equity_curve, duration);
     metrics.max_drawdown_duration = duration;
     metrics.max_drawdown_pct = (metrics.initial_capital != 0) ?
                               (metrics.max_drawdown / metrics.initial_capital) * 100.0 : 0.0;
     
     // Trade statistics
-    auto& trades = engine_.portfolio().get_trades();
     metrics.total_trades = trades.size();
     
     double total_profit = 0.0;
@@ -480,6 +433,49 @@ PerformanceMetrics BacktestEngine::calculate_performance_metrics() {
     return metrics;
 }
 
+std::vector<double> BacktestEngine::extract_period_returns(const std::vector<EquityPoint>& equity_curve, double initial_capital) {
+    // In a real implementation, group equity points by day and calculate daily returns
+    std::vector<double> returns;
+    double prev_equity = initial_capital;
+    for (size_t i = 1; i < equity_curve.size(); ++i) {
+        // Only consider points at day boundaries
+        if (i % 1000 == 0) {  // Simplified - use actual day boundaries in real implementation
+            double current_equity = equity_curve[i].equity;
+            double daily_return = (current_equity / prev_equity) - 1.0;
+            returns.push_back(daily_return);
+            prev_equity = current_equity;
+        }
+    }
+    return returns;
+}
+
+MonteCarloResult BacktestEngine::run_monte_carlo(const MonteCarloConfiguration& config, bool resample_trades) {
+    MonteCarloEngine monte_carlo(config);
+    MonteCarloResult result;
+    
+    if (resample_trades) {
+        // Realized P&L is recorded on closing trades only
+        std::vector<double> trade_pnl;
+        for (const auto& trade : engine_.portfolio().get_trades()) {
+            if (trade.side == "SELL") {
+                trade_pnl.push_back(trade.profit);
+            }
+        }
+        result = monte_carlo.run_on_trades(trade_pnl, initial_balance_);
+    } else {
+        result = monte_carlo.run_on_returns(extract_period_returns(equity_curve_, initial_balance_), initial_balance_);
+    }
+    
+    double pct = config.confidence_level * 100.0;
+    winter::utils::Logger::info()
+        << "Monte Carlo " << pct << "% CI - Sharpe: [" << result.sharpe_ratio.lower << ", " << result.sharpe_ratio.upper
+        << "], Max DD %: [" << result.max_drawdown_pct.lower << ", " << result.max_drawdown_pct.upper
+        << "], Terminal equity: [" << result.terminal_equity.lower << ", " << result.terminal_equity.upper
+        << "], P(loss): " << result.probability_of_loss << winter::utils::Logger::endl;
+    
+    return result;
+}
+
 double BacktestEngine::calculate_sharpe_ratio(const std::vector<double>& returns, double risk_free_rate) {
     if (returns.empty()) {
         return 0.0;
@@ -549,336 +545,11 @@ bool BacktestEngine::generate_report(const std::string& output_file) {
 }
 
 void BacktestEngine::export_trades_to_csv(const std::string& csv_file) {
-    std::ofstream file(csv_file);
-    if (!file.is_open()) {
-        winter::utils::Logger::error() << "Failed to create CSV file: " << csv_file << winter::utils::Logger::endl;
-        return;
-    }
-    
-    // Write header
-    file << "Timestamp,Symbol,Side,Quantity,Price,Value,Profit/Loss" << std::endl;
-    
-    // Write trades
-    auto& trades = engine_.portfolio().get_trades();
-    for (const auto& trade : trades) {
-        file << trade.timestamp << ","
-             << trade.symbol << ","
-             << trade.side << ","
-             << trade.quantity << ","
-             << std::fixed << std::setprecision(2) << trade.price << ","
-             << std::fixed << std::setprecision(2) << (trade.quantity * trade.price) << ",";
-        
-        if (trade.side == "SELL") {
-            file << std::fixed << std::setprecision(2) << trade.profit;
-        }
-        file << std::endl;
-    }
-    
-    file.close();
-    winter::utils::Logger::info() << "Exported trades to CSV: " << csv_file << winter::utils::Logger::endl;
+    write_trades_csv(csv_file, engine_.portfolio().get_trades());
 }
 
 void BacktestEngine::generate_html_report(const std::string& output_file, const PerformanceMetrics& metrics) {
-    std::ofstream html_file(output_file);
-    if (!html_file.is_open()) {
-        winter::utils::Logger::error() << "Failed to create HTML report file: " << output_file << winter::utils::Logger::endl;
-        return;
-    }
-    
-    // Generate equity curve data for the chart
-    std::stringstream timestamps_json, equity_json, trades_json;
-    timestamps_json << "[";
-    equity_json << "[";
-    trades_json << "[";
-    
-    // Use a subset of points for the chart to keep it manageable
-    size_t step = std::max(size_t(1), equity_curve_.size() / 1000);
-    
-    // Buy and sell markers
-    std::stringstream buy_points, sell_points;
-    buy_points << "[";
-    sell_points << "[";
-    
-    bool first_buy = true;
-    bool first_sell = true;
-    
-    for (size_t i = 0; i < equity_curve_.size(); i += step) {
-        if (i > 0) {
-            timestamps_json << ",";
-            equity_json << ",";
-        }
-        
-        timestamps_json << "\"" << equity_curve_[i].timestamp << "\"";
-        equity_json << equity_curve_[i].equity;
-        
-        // Add trade markers
-        if (!equity_curve_[i].trade_type.empty()) {
-            if (equity_curve_[i].trade_type == "BUY") {
-                if (!first_buy) buy_points << ",";
-                buy_points << "{x:" << equity_curve_[i].timestamp 
-                          << ",y:" << equity_curve_[i].equity 
-                          << ",symbol:'" << equity_curve_[i].symbol << "'}";
-                first_buy = false;
-            } else if (equity_curve_[i].trade_type == "SELL") {
-                if (!first_sell) sell_points << ",";
-                sell_points << "{x:" << equity_curve_[i].timestamp 
-                           << ",y:" << equity_curve_[i].equity 
-                           << ",symbol:'" << equity_curve_[i].symbol << "'}";
-                first_sell = false;
-            }
-        }
-    }
-    
-    timestamps_json << "]";
-    equity_json << "]";
-    buy_points << "]";
-    sell_points << "]";
-    
-    // Write HTML with embedded Chart.js
-    html_file << R"(
-<!DOCTYPE html>
-<html>
-<head>
-    <title>Winter Backtest Results</title>
-    <script src="https://cdn.jsdelivr.net/npm/chart.js"></script>
-    <script src="https://cdn.jsdelivr.net/npm/chartjs-plugin-annotation@1.0.2"></script>
-    <style>
-        body {
-            font-family: Arial, sans-serif;
-            margin: 20px;
-            background-color: #f5f5f5;
-        }
-        .container {
-            max-width: 1200px;
-            margin: 0 auto;
-            background-color: white;
-            padding: 20px;
-            border-radius: 5px;
-            box-shadow: 0 0 10px rgba(0,0,0,0.1);
-        }
-        .header {
-            text-align: center;
-            margin-bottom: 30px;
-        }
-        .chart-container {
-            height: 500px;
-            margin-bottom: 30px;
-        }
-        .metrics-container {
-            display: flex;
-            flex-wrap: wrap;
-            justify-content: space-between;
-        }
-        .metric-box {
-            width: 30%;
-            margin-bottom: 20px;
-            padding: 15px;
-            border-radius: 5px;
-            background-color: #f9f9f9;
-            box-shadow: 0 0 5px rgba(0,0,0,0.05);
-        }
-        .metric-title {
-            font-weight: bold;
-            margin-bottom: 5px;
-            color: #333;
-        }
-        .metric-value {
-            font-size: 20px;
-            color: #0066cc;
-        }
-        .positive {
-            color: #00aa00;
-        }
-        .negative {
-            color: #cc0000;
-        }
-        .trade-markers {
-            margin-top: 20px;
-        }
-        .buy-marker {
-            display: inline-block;
-            width: 12px;
-            height: 12px;
-            background-color: #00aa00;
-            border-radius: 50%;
-            margin-right: 5px;
-        }
-        .sell-marker {
-            display: inline-block;
-            width: 12px;
-            height: 12px;
-            background-color: #cc0000;
-            border-radius: 50%;
-            margin-right: 5px;
-        }
-    </style>
-</head>
-<body>
-    <div class="container">
-        <div class="header">
-            <h1>Winter Backtest Results</h1>
-            <p>Period: )" << start_date_ << R"( to )" << end_date_ << R"(</p>
-        </div>
-        
-        <div class="chart-container">
-            <canvas id="equityChart"></canvas>
-        </div>
-        
-        <div class="trade-markers">
-            <p><span class="buy-marker"></span> Buy Trade &nbsp;&nbsp; <span class="sell-marker"></span> Sell Trade</p>
-        </div>
-        
-        <div class="metrics-container">
-            <div class="metric-box">
-                <div class="metric-title">Initial Capital</div>
-                <div class="metric-value">$)" << std::fixed << std::setprecision(2) << metrics.initial_capital << R"(</div>
-            </div>
-            <div class="metric-box">
-                <div class="metric-title">Final Capital</div>
-                <div class="metric-value">$)" << std::fixed << std::setprecision(2) << metrics.final_capital << R"(</div>
-            </div>
-            <div class="metric-box">
-                <div class="metric-title">Total Return</div>
-                <div class="metric-value )" << (metrics.total_return >= 0 ? "positive" : "negative") << R"(">
-                    $)" << std::fixed << std::setprecision(2) << metrics.total_return << 
-                    " (" << std::setprecision(2) << metrics.total_return_pct << "%)" << R"(
-                </div>
-            </div>
-            <div class="metric-box">
-                <div class="metric-title">Annualized Return</div>
-                <div class="metric-value )" << (metrics.annualized_return >= 0 ? "positive" : "negative") << R"(">
-                    )" << std::fixed << std::setprecision(2) << (metrics.annualized_return * 100) << R"(%
-                </div>
-            </div>
-            <div class="metric-box">
-                <div class="metric-title">Sharpe Ratio</div>
-                <div class="metric-value">)" << std::fixed << std::setprecision(2) << metrics.sharpe_ratio << R"(</div>
-            </div>
-            <div class="metric-box">
-                <div class="metric-title">Max Drawdown</div>
-                <div class="metric-value negative">
-                    $)" << std::fixed << std::setprecision(2) << metrics.max_drawdown << 
-                    " (" << std::setprecision(2) << metrics.max_drawdown_pct << "%)" << R"(
-                </div>
-            </div>
-            <div class="metric-box">
-                <div class="metric-title">Max Drawdown Duration</div>
-                <div class="metric-value">)" << std::fixed << std::setprecision(1) << metrics.max_drawdown_duration << R"( days</div>
-            </div>
-            <div class="metric-box">
-                <div class="metric-title">Total Trades</div>
-                <div class="metric-value">)" << metrics.total_trades << R"(</div>
-            </div>
-            <div class="metric-box">
-                <div class="metric-title">Win Rate</div>
-                <div class="metric-value">)" << std::fixed << std::setprecision(2) << (metrics.win_rate * 100) << R"(%</div>
-            </div>
-            <div class="metric-box">
-                <div class="metric-title">Profit Factor</div>
-                <div class="metric-value">)" << std::fixed << std::setprecision(2) << metrics.profit_factor << R"(</div>
-            </div>
-            <div class="metric-box">
-                <div class="metric-title">Max Consecutive Wins</div>
-                <div class="metric-value">)" << metrics.max_consecutive_wins << R"(</div>
-            </div>
-            <div class="metric-box">
-                <div class="metric-title">Max Consecutive Losses</div>
-                <div class="metric-value">)" << metrics.max_consecutive_losses << R"(</div>
-            </div>
-            <div class="metric-box">
-                <div class="metric-title">Avg Profit Per Trade</div>
-                <div class="metric-value positive">$)" << std::fixed << std::setprecision(2) << metrics.avg_profit_per_trade << R"(</div>
-            </div>
-        </div>
-    </div>
-
-    <script>
-        const ctx = document.getElementById("equityChart").getContext("2d");
-        
-        // Buy and sell points
-        const buyPoints = )" << buy_points.str() << R"(;
-        const sellPoints = )" << sell_points.str() << R"(;
-        
-        const equityChart = new Chart(ctx, {
-            type: "line",
-            data: {
-                labels: )" << timestamps_json.str() << R"(,
-                datasets: [{
-                    label: "Equity Curve",
-                    data: )" << equity_json.str() << R"(,
-                    borderColor: "#0066cc",
-                    backgroundColor: 'rgba(0, 102, 204, 0.1)',
-                    borderWidth: 2,
-                    fill: true,
-                    tension: 0.1
-                },
-                {
-                    label: "Buy Points",
-                    data: buyPoints,
-                    backgroundColor: "#00aa00",
-                    borderColor: "#00aa00",
-                    pointRadius: 5,
-                    pointHoverRadius: 8,
-                    showLine: false
-                },
-                {
-                    label: "Sell Points",
-                    data: sellPoints,
-                    backgroundColor: "#cc0000",
-                    borderColor: "#cc0000",
-                    pointRadius: 5,
-                    pointHoverRadius: 8,
-                    showLine: false
-                }]
-            },
-            options: {
-                responsive: true,
-                maintainAspectRatio: false,
-                plugins: {
-                    title: {
-                        display: true,
-                        text: "Equity Curve with Trade Markers"
-                    },
-                    tooltip: {
-                        mode: "index",
-                        intersect: false,
-                        callbacks: {
-                            label: function(context) {
-                                if (context.dataset.label === "Equity Curve") {
-                                    return "Equity: $" + context.raw.toFixed(2);
-                                } else if (context.dataset.label === "Buy Points") {
-                                    return "Buy: " + context.raw.symbol + " at $" + context.raw.y.toFixed(2);
-                                } else if (context.dataset.label === "Sell Points") {
-                                    return "Sell: " + context.raw.symbol + " at $" + context.raw.y.toFixed(2);
-                                }
-                            }
-                        }
-                    }
-                },
-                scales: {
-                    y: {
-                        beginAtZero: false,
-                        title: {
-                            display: true,
-                            text: 'Equity ($)'
-                        }
-                    },
-                    x: {
-                        title: {
-                            display: true,
-                            text: "Time"
-                        }
-                    }
-                }
-            }
-        });
-    </script>
-</body>
-</html>
-)";
-    
-    html_file.close();
-    winter::utils::Logger::info() << "Generated HTML report: " << output_file << winter::utils::Logger::endl;
+    write_html_report(output_file, metrics, equity_curve_, start_date_ + " to " + end_date_);
 }
 
 } // namespace winter::backtest
@@ -0,0 +1,298 @@
+#include <winter/backtest/csv_loader.hpp>
+#include <winter/utils/binary_io.hpp>
+#include <winter/utils/logger.hpp>
+#include <winter/utils/thread_pool.hpp>
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <unordered_map>
+
+namespace winter::backtest {
+
+namespace {
+
+constexpr char TICK_STORE_MAGIC[4] = {'W', 'T', 'K', 'S'};
+constexpr uint32_t TICK_STORE_VERSION = 1;
+constexpr char PARQUET_MAGIC[4] = {'P', 'A', 'R', '1'};
+
+// Two-digit clock field followed by `separator` (or the end, when 0)
+bool parse_clock_field(std::string_view text, size_t pos, char separator, int max, int64_t& out) {
+    if (pos + 2 > text.size() || (separator && (pos + 2 == text.size() || text[pos + 2] != separator))) {
+        return false;
+    }
+    int value = 0;
+    auto [end, ec] = std::from_chars(text.data() + pos, text.data() + pos + 2, value);
+    if (ec != std::errc() || end != text.data() + pos + 2 || value > max) {
+        return false;
+    }
+    out = value;
+    return true;
+}
+
+} // namespace
+
+bool parse_tape_time(std::string_view text, int64_t& us) {
+    int64_t hours = 0, minutes = 0, seconds = 0;
+    if (!parse_clock_field(text, 0, ':', 23, hours) || !parse_clock_field(text, 3, ':', 59, minutes) ||
+        !parse_clock_field(text, 6, 0, 60, seconds)) {
+        return false;
+    }
+    int64_t fraction_us = 0;
+    if (text.size() > 8) {
+        // Up to microseconds; finer digits are dropped
+        if (text[8] != '.' || text.size() == 9) {
+            return false;
+        }
+        int64_t scale = 100000;
+        for (size_t i = 9; i < text.size(); ++i) {
+            if (text[i] < '0' || text[i] > '9') {
+                return false;
+            }
+            fraction_us += (text[i] - '0') * scale;
+            scale /= 10;
+        }
+    } else if (text.size() != 8) {
+        return false;
+    }
+    us = ((hours * 60 + minutes) * 60 + seconds) * 1000000 + fraction_us;
+    return true;
+}
+
+std::string format_tape_time(int64_t us) {
+    us %= TAPE_DAY_US;
+    char buffer[16];
+    std::snprintf(buffer, sizeof(buffer), "%02d:%02d:%02d.%06d", static_cast<int>(us / 3600000000),
+                  static_cast<int>(us / 60000000 % 60), static_cast<int>(us / 1000000 % 60),
+                  static_cast<int>(us % 1000000));
+    return buffer;
+}
+
+std::optional<winter::core::MarketData> parse_market_data_line(const std::string& line) {
+    std::stringstream ss(line);
+    std::string time, symbol, market_center, price_str, size_str;
+
+    // Parse CSV columns: Time,Symbol,Market Center,Price,Size,...
+    std::getline(ss, time, ',');
+    std::getline(ss, symbol, ',');
+    std::getline(ss, market_center, ',');
+    std::getline(ss, price_str, ',');
+    std::getline(ss, size_str, ',');
+
+    if (symbol.empty() || price_str.empty() || size_str.empty()) {
+        return std::nullopt;
+    }
+
+    try {
+        winter::core::MarketData data;
+        if (!parse_tape_time(time, data.timestamp)) {
+            return std::nullopt;
+        }
+        data.symbol = symbol;
+        data.price = std::stod(price_str);
+        data.volume = std::stoi(size_str);
+        return data;
+    } catch (const std::exception&) {
+        // Don't log every parsing error to avoid flooding the console
+        return std::nullopt;
+    }
+}
+
+bool load_market_data_csv(const std::string& csv_file, std::vector<winter::core::MarketData>& data) {
+    auto start_time = std::chrono::steady_clock::now();
+
+    // Check if file exists
+    if (!std::filesystem::exists(csv_file)) {
+        winter::utils::Logger::error() << "CSV file does not exist: " << csv_file << winter::utils::Logger::endl;
+        return false;
+    }
+
+    // Get file size for progress reporting
+    size_t file_size = std::filesystem::file_size(csv_file);
+
+    std::ifstream file(csv_file);
+    if (!file.is_open()) {
+        winter::utils::Logger::error() << "Failed to open CSV file: " << csv_file << winter::utils::Logger::endl;
+        return false;
+    }
+
+    data.clear();
+
+    // Reserve memory based on estimated line count (assume average line length of 100 bytes)
+    size_t estimated_lines = file_size / 100;
+    data.reserve(estimated_lines);
+
+    std::string line;
+    // Skip header line
+    std::getline(file, line);
+
+    // Read all lines into a buffer for parallel processing
+    std::vector<std::string> lines;
+    lines.reserve(estimated_lines);
+
+    winter::utils::Logger::info() << "Reading CSV file..." << winter::utils::Logger::endl;
+
+    while (std::getline(file, line)) {
+        lines.push_back(std::move(line));
+    }
+
+    winter::utils::Logger::info() << "Read " << lines.size() << " lines from CSV file" << winter::utils::Logger::endl;
+    winter::utils::Logger::info() << "Parsing CSV data in parallel..." << winter::utils::Logger::endl;
+
+    // Process lines in batches to avoid excessive memory usage
+    const size_t BATCH_SIZE = 100000;
+    std::vector<std::optional<winter::core::MarketData>> results(BATCH_SIZE);
+
+    for (size_t batch_start = 0; batch_start < lines.size(); batch_start += BATCH_SIZE) {
+        size_t batch_end = std::min(batch_start + BATCH_SIZE, lines.size());
+        size_t batch_size = batch_end - batch_start;
+
+        // Parse lines in parallel; results stay in file order
+        winter::utils::ThreadPool::shared().parallel_for(batch_start, batch_end, 0, [&](size_t first, size_t last) {
+            for (size_t row = first; row < last; ++row) {
+                results[row - batch_start] = parse_market_data_line(lines[row]);
+            }
+        });
+
+        for (size_t i = 0; i < batch_size; ++i) {
+            if (results[i]) {
+                // Rows stay in file order; one printed out of order takes the
+                // previous row's time so event time never runs backwards
+                if (!data.empty() && results[i]->timestamp < data.back().timestamp) {
+                    results[i]->timestamp = data.back().timestamp;
+                }
+                data.push_back(std::move(*results[i]));
+            }
+        }
+
+        // Report progress
+        double progress = static_cast<double>(batch_end) / lines.size() * 100.0;
+        winter::utils::Logger::info() << "Parsing progress: " << progress << "% (" << data.size()
+                                     << " valid data points)" << winter::utils::Logger::endl;
+    }
+
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start_time).count();
+
+    winter::utils::Logger::info() << "Loaded " << data.size() << " data points from "
+                                 << lines.size() << " total lines in " << csv_file
+                                 << " (" << duration << "ms)" << winter::utils::Logger::endl;
+
+    return !data.empty();
+}
+
+bool save_market_data_binary(const std::string& file, const std::vector<winter::core::MarketData>& data) {
+    // Symbols are stored once; records refer to them by index
+    std::unordered_map<std::string, uint32_t> symbol_ids;
+    std::vector<const std::string*> symbols;
+    for (const auto& tick : data) {
+        auto [it, inserted] = symbol_ids.try_emplace(tick.symbol, static_cast<uint32_t>(symbols.size()));
+        if (inserted) {
+            symbols.push_back(&it->first);
+        }
+    }
+
+    winter::utils::BinaryWriter out;
+    out.write_bytes(TICK_STORE_MAGIC, sizeof(TICK_STORE_MAGIC));
+    out.write(TICK_STORE_VERSION);
+    out.write<uint32_t>(static_cast<uint32_t>(symbols.size()));
+    for (const auto* symbol : symbols) {
+        out.write_string(*symbol);
+    }
+    out.write<uint64_t>(data.size());
+    for (const auto& tick : data) {
+        out.write(symbol_ids[tick.symbol]);
+        out.write(tick.price);
+        out.write<int32_t>(tick.volume);
+        out.write(tick.timestamp);
+    }
+
+    std::ofstream stream(file, std::ios::binary | std::ios::trunc);
+    if (!stream.write(out.data(), static_cast<std::streamsize>(out.size()))) {
+        winter::utils::Logger::error() << "Failed to write tick store: " << file << winter::utils::Logger::endl;
+        return false;
+    }
+    return true;
+}
+
+bool load_market_data_binary(const std::string& file, std::vector<winter::core::MarketData>& data) {
+    auto start_time = std::chrono::steady_clock::now();
+
+    std::ifstream stream(file, std::ios::binary | std::ios::ate);
+    if (!stream.is_open()) {
+        winter::utils::Logger::error() << "Failed to open tick store: " << file << winter::utils::Logger::endl;
+        return false;
+    }
+    std::vector<char> buffer(static_cast<size_t>(stream.tellg()));
+    stream.seekg(0);
+    if (!stream.read(buffer.data(), static_cast<std::streamsize>(buffer.size()))) {
+        winter::utils::Logger::error() << "Failed to read tick store: " << file << winter::utils::Logger::endl;
+        return false;
+    }
+
+    winter::utils::BinaryReader in(buffer);
+    char magic[4];
+    in.read_bytes(magic, sizeof(magic));
+    uint32_t version = in.read<uint32_t>();
+    if (!in.ok() || std::memcmp(magic, TICK_STORE_MAGIC, sizeof(magic)) != 0 || version != TICK_STORE_VERSION) {
+        winter::utils::Logger::error() << "Not a tick store (or unsupported version): " << file << winter::utils::Logger::endl;
+        return false;
+    }
+
+    std::vector<std::string> symbols(in.read<uint32_t>());
+    for (auto& symbol : symbols) {
+        symbol = in.read_string();
+    }
+
+    uint64_t count = in.read<uint64_t>();
+    constexpr size_t RECORD_SIZE = sizeof(uint32_t) + sizeof(double) + sizeof(int32_t) + sizeof(int64_t);
+    if (!in.ok() || count > in.remaining() / RECORD_SIZE) {
+        winter::utils::Logger::error() << "Truncated tick store: " << file << winter::utils::Logger::endl;
+        return false;
+    }
+
+    data.clear();
+    data.resize(count);
+    for (auto& tick : data) {
+        uint32_t symbol_id = in.read<uint32_t>();
+        tick.symbol = symbol_id < symbols.size() ? symbols[symbol_id] : std::string();
+        tick.price = in.read<double>();
+        tick.volume = in.read<int32_t>();
+        tick.timestamp = in.read<int64_t>();
+    }
+
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start_time).count();
+    winter::utils::Logger::info() << "Loaded " << data.size() << " data points from " << file
+                                 << " (" << duration << "ms)" << winter::utils::Logger::endl;
+    return in.ok();
+}
+
+bool load_market_data(const std::string& file, std::vector<winter::core::MarketData>& data) {
+    std::ifstream probe(file, std::ios::binary);
+    if (!probe.is_open()) {
+        winter::utils::Logger::error() << "Failed to open data file: " << file << winter::utils::Logger::endl;
+        return false;
+    }
+    char magic[4] = {};
+    probe.read(magic, sizeof(magic));
+    bool full = probe.gcount() == sizeof(magic);
+    probe.close();
+
+    if (full && std::memcmp(magic, TICK_STORE_MAGIC, sizeof(magic)) == 0) {
+        return load_market_data_binary(file, data);
+    }
+    if (full && std::memcmp(magic, PARQUET_MAGIC, sizeof(magic)) == 0) {
+        winter::utils::Logger::error() << "Parquet input is not supported in this build; convert " << file
+                                     << " to CSV or a binary tick store" << winter::utils::Logger::endl;
+        return false;
+    }
+    return load_market_data_csv(file, data);
+}
+
+} // namespace winter::backtest
@@ -0,0 +1,202 @@
+#include <winter/backtest/monte_carlo.hpp>
+#include <winter/utils/random.hpp>
+#include <winter/utils/logger.hpp>
+#include <winter/utils/thread_pool.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+
+namespace winter::backtest {
+
+namespace {
+
+struct PathStats {
+    double sharpe = 0.0;
+    double max_drawdown_pct = 0.0;
+    double terminal_equity = 0.0;
+};
+
+// Walks one resampled path without materializing it
+class PathAccumulator {
+private:
+    double equity_;
+    double peak_;
+    double max_dd_ = 0.0;
+    double sum_ = 0.0;
+    double sum_sq_ = 0.0;
+    size_t count_ = 0;
+    bool samples_are_pnl_;
+
+public:
+    PathAccumulator(double initial_capital, bool samples_are_pnl)
+        : equity_(initial_capital), peak_(initial_capital), samples_are_pnl_(samples_are_pnl) {}
+
+    void add(double sample) {
+        double r;
+        if (samples_are_pnl_) {
+            r = equity_ != 0.0 ? sample / equity_ : 0.0;
+            equity_ += sample;
+        } else {
+            r = sample;
+            equity_ *= (1.0 + sample);
+        }
+
+        sum_ += r;
+        sum_sq_ += r * r;
+        ++count_;
+
+        if (equity_ > peak_) {
+            peak_ = equity_;
+        } else if (peak_ > 0.0) {
+            max_dd_ = std::max(max_dd_, (peak_ - equity_) / peak_);
+        }
+    }
+
+    PathStats finish(int periods_per_year) const {
+        PathStats stats;
+        stats.terminal_equity = equity_;
+        stats.max_drawdown_pct = max_dd_ * 100.0;
+        if (count_ > 1) {
+            double mean = sum_ / count_;
+            double var = (sum_sq_ - count_ * mean * mean) / (count_ - 1);
+            double std_dev = var > 0.0 ? std::sqrt(var) : 0.0;
+            stats.sharpe = std_dev > 0.0 ? (mean / std_dev) * std::sqrt(static_cast<double>(periods_per_year)) : 0.0;
+        }
+        return stats;
+    }
+};
+
+ConfidenceInterval summarize(std::vector<double>& values, double confidence_level) {
+    ConfidenceInterval ci;
+    if (values.empty()) {
+        return ci;
+    }
+
+    std::sort(values.begin(), values.end());
+    auto quantile = [&](double q) {
+        double pos = q * (values.size() - 1);
+        size_t lo = static_cast<size_t>(pos);
+        size_t hi = std::min(lo + 1, values.size() - 1);
+        double frac = pos - lo;
+        return values[lo] * (1.0 - frac) + values[hi] * frac;
+    };
+
+    double tail = (1.0 - confidence_level) / 2.0;
+    ci.lower = quantile(tail);
+    ci.median = quantile(0.5);
+    ci.upper = quantile(1.0 - tail);
+    ci.mean = std::accumulate(values.begin(), values.end(), 0.0) / values.size();
+    return ci;
+}
+
+} // namespace
+
+MonteCarloEngine::MonteCarloEngine(const MonteCarloConfiguration& config) : config_(config) {}
+
+MonteCarloResult MonteCarloEngine::run_on_returns(const std::vector<double>& returns, double initial_capital) {
+    return run(returns, initial_capital, false);
+}
+
+MonteCarloResult MonteCarloEngine::run_on_trades(const std::vector<double>& trade_pnl, double initial_capital) {
+    return run(trade_pnl, initial_capital, true);
+}
+
+MonteCarloResult MonteCarloEngine::run(const std::vector<double>& samples, double initial_capital, bool samples_are_pnl) {
+    MonteCarloResult result;
+    result.confidence_level = config_.confidence_level;
+
+    if (samples.empty() || config_.simulations == 0) {
+        winter::utils::Logger::warn() << "Monte Carlo: nothing to resample" << winter::utils::Logger::endl;
+        return result;
+    }
+
+    auto start_time = std::chrono::steady_clock::now();
+
+    const size_t simulations = config_.simulations;
+    const size_t n = samples.size();
+    const size_t block_size = std::clamp<size_t>(config_.block_size, 1, n);
+    const uint32_t sample_count = static_cast<uint32_t>(n);
+
+    std::vector<double> sharpe(simulations);
+    std::vector<double> drawdown(simulations);
+    std::vector<double> terminal(simulations);
+
+    auto simulate_range = [&](size_t begin, size_t end) {
+        // Reshuffling permutes a private copy; bootstraps index the shared input
+        std::vector<double> scratch;
+        if (config_.method == ResamplingMethod::RESHUFFLE) {
+            scratch = samples;
+        }
+
+        for (size_t sim = begin; sim < end; ++sim) {
+            winter::utils::Philox4x32 rng(config_.seed, sim);
+            PathAccumulator path(initial_capital, samples_are_pnl);
+
+            switch (config_.method) {
+                case ResamplingMethod::BOOTSTRAP:
+                    for (size_t i = 0; i < n; ++i) {
+                        path.add(samples[rng.below(sample_count)]);
+                    }
+                    break;
+
+                case ResamplingMethod::BLOCK_BOOTSTRAP: {
+                    const uint32_t block_starts = static_cast<uint32_t>(n - block_size + 1);
+                    size_t produced = 0;
+                    while (produced < n) {
+                        size_t offset = rng.below(block_starts);
+                        for (size_t j = 0; j < block_size && produced < n; ++j, ++produced) {
+                            path.add(samples[offset + j]);
+                        }
+                    }
+                    break;
+                }
+
+                case ResamplingMethod::RESHUFFLE:
+                    // Restore the original order so every simulation permutes the same input
+                    std::copy(samples.begin(), samples.end(), scratch.begin());
+                    for (size_t i = n - 1; i > 0; --i) {
+                        std::swap(scratch[i], scratch[rng.below(static_cast<uint32_t>(i + 1))]);
+                    }
+                    for (double sample : scratch) {
+                        path.add(sample);
+                    }
+                    break;
+            }
+
+            PathStats stats = path.finish(config_.periods_per_year);
+            sharpe[sim] = stats.sharpe;
+            drawdown[sim] = stats.max_drawdown_pct;
+            terminal[sim] = stats.terminal_equity;
+        }
+    };
+
+    size_t thread_count = std::clamp<size_t>(config_.thread_count, 1, simulations);
+    size_t per_thread = (simulations + thread_count - 1) / thread_count;
+    winter::utils::ThreadPool::shared().parallel_for(0, simulations, per_thread, simulate_range);
+
+    result.simulations = simulations;
+    result.probability_of_loss = static_cast<double>(
+        std::count_if(terminal.begin(), terminal.end(), [&](double e) { return e < initial_capital; })) / simulations;
+    result.sharpe_ratio = summarize(sharpe, config_.confidence_level);
+    result.max_drawdown_pct = summarize(drawdown, config_.confidence_level);
+    result.terminal_equity = summarize(terminal, config_.confidence_level);
+    result.elapsed_ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start_time).count();
+
+    winter::utils::Logger::info() << "Monte Carlo (" << to_string(config_.method) << "): "
+                                  << simulations << " paths of " << n << " samples in "
+                                  << result.elapsed_ms << "ms" << winter::utils::Logger::endl;
+    return result;
+}
+
+std::string MonteCarloEngine::to_string(ResamplingMethod method) {
+    switch (method) {
+        case ResamplingMethod::BOOTSTRAP: return "bootstrap";
+        case ResamplingMethod::BLOCK_BOOTSTRAP: return "block-bootstrap";
+        case ResamplingMethod::RESHUFFLE: return "reshuffle";
+    }
+    return "unknown";
+}
+
+} // namespace winter::backtest
@@ -0,0 +1,188 @@
+#include <winter/backtest/multi_strategy_backtest.hpp>
+#include <winter/backtest/csv_loader.hpp>
+#include <winter/core/execution.hpp>
+#include <winter/utils/logger.hpp>
+#include <winter/utils/thread_pool.hpp>
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+namespace winter::backtest {
+
+bool MultiStrategyBacktest::initialize(double initial_capital) {
+    initial_capital_ = initial_capital;
+    for (auto& lane : lanes_) {
+        lane->portfolio = winter::core::Portfolio();
+        lane->portfolio.set_clock(lane->clock);
+        lane->portfolio.set_cash(initial_capital);
+        lane->equity_curve.clear();
+        lane->equity_curve.push_back(EquityPoint{0, initial_capital, "", ""});
+        lane->signals = 0;
+        lane->orders_executed = 0;
+        lane->orders_rejected = 0;
+    }
+    return true;
+}
+
+bool MultiStrategyBacktest::add_strategy(winter::strategy::StrategyPtr strategy, FillCallback on_fill) {
+    if (!strategy) {
+        return false;
+    }
+
+    for (const auto& lane : lanes_) {
+        if (lane->strategy == strategy) {
+            winter::utils::Logger::error() << "Strategy instance already added: " << strategy->name() << winter::utils::Logger::endl;
+            return false;
+        }
+    }
+
+    auto lane = std::make_unique<Lane>();
+    lane->strategy = std::move(strategy);
+    lane->on_fill = std::move(on_fill);
+    lane->strategy->set_clock(lane->clock);
+    lane->portfolio.set_clock(lane->clock);
+    lane->portfolio.set_cash(initial_capital_);
+    lane->equity_curve.push_back(EquityPoint{0, initial_capital_, "", ""});
+    lanes_.push_back(std::move(lane));
+    return true;
+}
+
+bool MultiStrategyBacktest::load_data(const std::string& data_file) {
+    data_ = &owned_data_;
+    return load_market_data(data_file, owned_data_);
+}
+
+void MultiStrategyBacktest::process_batch(Lane& lane, size_t begin, size_t end) {
+    const auto& data = *data_;
+    auto& strategy = *lane.strategy;
+    if (!strategy.is_enabled()) {
+        return;
+    }
+
+    for (size_t i = begin; i < end; ++i) {
+        lane.clock->set_us(data[i].timestamp);
+        lane.signal_buffer.clear();
+        strategy.append_signals(data[i], lane.signal_buffer);
+
+        for (const auto& signal : lane.signal_buffer) {
+            ++lane.signals;
+
+            auto order = winter::core::order_from_signal(signal, lane.portfolio);
+            if (!order) {
+                continue;
+            }
+
+            auto executed = winter::core::execute_order(*order, lane.portfolio);
+            if (!executed) {
+                ++lane.orders_rejected;
+                continue;
+            }
+
+            ++lane.orders_executed;
+            lane.equity_curve.push_back(EquityPoint{
+                data[i].timestamp,
+                lane.portfolio.total_value(),
+                executed->symbol,
+                executed->side == winter::core::OrderSide::BUY ? "BUY" : "SELL"});
+            if (lane.on_fill) {
+                lane.on_fill(*executed, data[i].timestamp);
+            }
+        }
+    }
+
+    // One regular equity point per batch
+    lane.equity_curve.push_back(EquityPoint{data[end - 1].timestamp, lane.portfolio.total_value(), "", ""});
+}
+
+bool MultiStrategyBacktest::run() {
+    const auto& data = *data_;
+    if (data.empty()) {
+        winter::utils::Logger::error() << "No historical data loaded for backtest" << winter::utils::Logger::endl;
+        return false;
+    }
+    if (lanes_.empty()) {
+        winter::utils::Logger::error() << "No strategies added to multi-strategy backtest" << winter::utils::Logger::endl;
+        return false;
+    }
+
+    auto start_time = std::chrono::steady_clock::now();
+
+    const size_t batch_size = std::max<size_t>(1, config_.batch_size);
+    const size_t worker_count = std::clamp<size_t>(config_.thread_count, 1, lanes_.size());
+
+    winter::utils::Logger::info() << "Starting shared-pass backtest: " << lanes_.size() << " strategies, "
+                                 << worker_count << " workers, " << data.size() << " data points"
+                                 << winter::utils::Logger::endl;
+
+    for (auto& lane : lanes_) {
+        lane->strategy->initialize();
+    }
+
+    // Every batch is one parallel_for over the lanes; it returns only once all
+    // lanes have finished the batch, which is the barrier between batches
+    auto& pool = winter::utils::ThreadPool::shared();
+    const size_t lanes_per_task = (lanes_.size() + worker_count - 1) / worker_count;
+    for (size_t begin = 0; begin < data.size(); begin += batch_size) {
+        size_t end = std::min(begin + batch_size, data.size());
+        pool.parallel_for(0, lanes_.size(), lanes_per_task, [&](size_t first, size_t last) {
+            for (size_t l = first; l < last; ++l) {
+                process_batch(*lanes_[l], begin, end);
+            }
+        });
+    }
+
+    for (auto& lane : lanes_) {
+        lane->strategy->shutdown();
+    }
+
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start_time).count();
+    winter::utils::Logger::info() << "Shared-pass backtest completed in " << duration << "ms" << winter::utils::Logger::endl;
+
+    return true;
+}
+
+std::vector<StrategyResult> MultiStrategyBacktest::get_results() const {
+    std::vector<StrategyResult> results;
+    results.reserve(lanes_.size());
+
+    for (const auto& lane : lanes_) {
+        StrategyResult result;
+        result.strategy_name = lane->strategy->name();
+        result.equity_curve = lane->equity_curve;
+        result.trades = lane->portfolio.get_trades();
+        result.metrics = BacktestEngine::compute_metrics(lane->equity_curve, result.trades, initial_capital_);
+        result.signals = lane->signals;
+        result.orders_executed = lane->orders_executed;
+        result.orders_rejected = lane->orders_rejected;
+        results.push_back(std::move(result));
+    }
+    return results;
+}
+
+void MultiStrategyBacktest::print_comparison() const {
+    auto results = get_results();
+
+    std::cout << "\n=== Strategy Comparison ===" << std::endl;
+    std::cout << std::left << std::setw(20) << "Strategy"
+              << std::right << std::setw(16) << "Final Capital"
+              << std::setw(12) << "Return %"
+              << std::setw(10) << "Sharpe"
+              << std::setw(10) << "Max DD %"
+              << std::setw(10) << "Trades"
+              << std::setw(10) << "Win %" << std::endl;
+
+    for (const auto& r : results) {
+        std::cout << std::left << std::setw(20) << r.strategy_name
+                  << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(16) << r.metrics.final_capital
+                  << std::setw(12) << r.metrics.total_return_pct
+                  << std::setw(10) << r.metrics.sharpe_ratio
+                  << std::setw(10) << r.metrics.max_drawdown_pct
+                  << std::setw(10) << r.metrics.total_trades
+                  << std::setw(10) << (r.metrics.win_rate * 100.0) << std::endl;
+    }
+}
+
+} // namespace winter::backtest
@@ -0,0 +1,404 @@
+#include <winter/backtest/report.hpp>
+#include <winter/backtest/report_writer.hpp>
+#include <winter/utils/buffered_writer.hpp>
+#include <winter/utils/logger.hpp>
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+namespace winter::backtest {
+
+bool write_trades_csv(const std::string& csv_file, const std::vector<winter::core::Trade>& trades) {
+    std::ofstream file(csv_file);
+    if (!file.is_open()) {
+        winter::utils::Logger::error() << "Failed to create CSV file: " << csv_file << winter::utils::Logger::endl;
+        return false;
+    }
+    
+    // Write header
+    file << "Timestamp,Symbol,Side,Quantity,Price,Value,Profit/Loss" << std::endl;
+    
+    // Write trades
+    for (const auto& trade : trades) {
+        file << trade.timestamp << ","
+             << trade.symbol << ","
+             << trade.side << ","
+             << trade.quantity << ","
+             << std::fixed << std::setprecision(2) << trade.price << ","
+             << std::fixed << std::setprecision(2) << (trade.quantity * trade.price) << ",";
+        
+        if (trade.side == "SELL") {
+            file << std::fixed << std::setprecision(2) << trade.profit;
+        }
+        file << std::endl;
+    }
+    
+    file.close();
+    winter::utils::Logger::info() << "Exported trades to CSV: " << csv_file << winter::utils::Logger::endl;
+    return true;
+}
+
+bool write_html_report(const std::string& output_file, const PerformanceMetrics& metrics,
+                       const std::vector<EquityPoint>& equity_curve, const std::string& period) {
+    std::ofstream html_file(output_file);
+    if (!html_file.is_open()) {
+        winter::utils::Logger::error() << "Failed to create HTML report file: " << output_file << winter::utils::Logger::endl;
+        return false;
+    }
+    
+    // Stream chart data into a separate file the page loads; the equity curve is
+    // LTTB-downsampled so drawdown troughs and spikes stay visible
+    ReportWriter data(output_file);
+    if (!data.is_open()) {
+        winter::utils::Logger::error() << "Failed to create report data file: " << data.data_file() << winter::utils::Logger::endl;
+        return false;
+    }
+
+    const auto& curve = equity_curve;
+    auto curve_x = [&](size_t i) { return curve[i].timestamp; };
+    auto curve_y = [&](size_t i) { return curve[i].equity; };
+    auto curve_symbol = [&](size_t i) -> std::string_view { return curve[i].symbol; };
+
+    data.series("equity", curve.size(), curve_x, curve_y);
+    data.markers("buys", curve.size(),
+                 [&](size_t i) { return curve[i].trade_type == "BUY"; },
+                 curve_x, curve_y, curve_symbol);
+    data.markers("sells", curve.size(),
+                 [&](size_t i) { return curve[i].trade_type == "SELL"; },
+                 curve_x, curve_y, curve_symbol);
+    data.close();
+
+    // Write HTML with embedded Chart.js
+    html_file << R"(
+<!DOCTYPE html>
+<html>
+<head>
+    <title>Winter Backtest Results</title>
+    <script src="https://cdn.jsdelivr.net/npm/chart.js"></script>
+    <script src="https://cdn.jsdelivr.net/npm/chartjs-plugin-annotation@1.0.2"></script>
+    <script src=")" << data.data_script_src() << R"("></script>
+    <style>
+        body {
+            font-family: Arial, sans-serif;
+            margin: 20px;
+            background-color: #f5f5f5;
+        }
+        .container {
+            max-width: 1200px;
+            margin: 0 auto;
+            background-color: white;
+            padding: 20px;
+            border-radius: 5px;
+            box-shadow: 0 0 10px rgba(0,0,0,0.1);
+        }
+        .header {
+            text-align: center;
+            margin-bottom: 30px;
+        }
+        .chart-container {
+            height: 500px;
+            margin-bottom: 30px;
+        }
+        .metrics-container {
+            display: flex;
+            flex-wrap: wrap;
+            justify-content: space-between;
+        }
+        .metric-box {
+            width: 30%;
+            margin-bottom: 20px;
+            padding: 15px;
+            border-radius: 5px;
+            background-color: #f9f9f9;
+            box-shadow: 0 0 5px rgba(0,0,0,0.05);
+        }
+        .metric-title {
+            font-weight: bold;
+            margin-bottom: 5px;
+            color: #333;
+        }
+        .metric-value {
+            font-size: 20px;
+            color: #0066cc;
+        }
+        .positive {
+            color: #00aa00;
+        }
+        .negative {
+            color: #cc0000;
+        }
+        .trade-markers {
+            margin-top: 20px;
+        }
+        .buy-marker {
+            display: inline-block;
+            width: 12px;
+            height: 12px;
+            background-color: #00aa00;
+            border-radius: 50%;
+            margin-right: 5px;
+        }
+        .sell-marker {
+            display: inline-block;
+            width: 12px;
+            height: 12px;
+            background-color: #cc0000;
+            border-radius: 50%;
+            margin-right: 5px;
+        }
+    </style>
+</head>
+<body>
+    <div class="container">
+        <div class="header">
+            <h1>Winter Backtest Results</h1>
+            <p>Period: )" << period << R"(</p>
+        </div>
+        
+        <div class="chart-container">
+            <canvas id="equityChart"></canvas>
+        </div>
+        
+        <div class="trade-markers">
+            <p><span class="buy-marker"></span> Buy Trade &nbsp;&nbsp; <span class="sell-marker"></span> Sell Trade</p>
+        </div>
+        
+        <div class="metrics-container">
+            <div class="metric-box">
+                <div class="metric-title">Initial Capital</div>
+                <div class="metric-value">$)" << std::fixed << std::setprecision(2) << metrics.initial_capital << R"(</div>
+            </div>
+            <div class="metric-box">
+                <div class="metric-title">Final Capital</div>
+                <div class="metric-value">$)" << std::fixed << std::setprecision(2) << metrics.final_capital << R"(</div>
+            </div>
+            <div class="metric-box">
+                <div class="metric-title">Total Return</div>
+                <div class="metric-value )" << (metrics.total_return >= 0 ? "positive" : "negative") << R"(">
+                    $)" << std::fixed << std::setprecision(2) << metrics.total_return << 
+                    " (" << std::setprecision(2) << metrics.total_return_pct << "%)" << R"(
+                </div>
+            </div>
+            <div class="metric-box">
+                <div class="metric-title">Annualized Return</div>
+                <div class="metric-value )" << (metrics.annualized_return >= 0 ? "positive" : "negative") << R"(">
+                    )" << std::fixed << std::setprecision(2) << (metrics.annualized_return * 100) << R"(%
+                </div>
+            </div>
+            <div class="metric-box">
+                <div class="metric-title">Sharpe Ratio</div>
+                <div class="metric-value">)" << std::fixed << std::setprecision(2) << metrics.sharpe_ratio << R"(</div>
+            </div>
+            <div class="metric-box">
+                <div class="metric-title">Max Drawdown</div>
+                <div class="metric-value negative">
+                    $)" << std::fixed << std::setprecision(2) << metrics.max_drawdown << 
+                    " (" << std::setprecision(2) << metrics.max_drawdown_pct << "%)" << R"(
+                </div>
+            </div>
+            <div class="metric-box">
+                <div class="metric-title">Max Drawdown Duration</div>
+                <div class="metric-value">)" << std::fixed << std::setprecision(1) << metrics.max_drawdown_duration << R"( days</div>
+            </div>
+            <div class="metric-box">
+                <div class="metric-title">Total Trades</div>
+                <div class="metric-value">)" << metrics.total_trades << R"(</div>
+            </div>
+            <div class="metric-box">
+                <div class="metric-title">Win Rate</div>
+                <div class="metric-value">)" << std::fixed << std::setprecision(2) << (metrics.win_rate * 100) << R"(%</div>
+            </div>
+            <div class="metric-box">
+                <div class="metric-title">Profit Factor</div>
+                <div class="metric-value">)" << std::fixed << std::setprecision(2) << metrics.profit_factor << R"(</div>
+            </div>
+            <div class="metric-box">
+                <div class="metric-title">Max Consecutive Wins</div>
+                <div class="metric-value">)" << metrics.max_consecutive_wins << R"(</div>
+            </div>
+            <div class="metric-box">
+                <div class="metric-title">Max Consecutive Losses</div>
+                <div class="metric-value">)" << metrics.max_consecutive_losses << R"(</div>
+            </div>
+            <div class="metric-box">
+                <div class="metric-title">Avg Profit Per Trade</div>
+                <div class="metric-value positive">$)" << std::fixed << std::setprecision(2) << metrics.avg_profit_per_trade << R"(</div>
+            </div>
+        </div>
+    </div>
+
+    <script>
+        const ctx = document.getElementById("equityChart").getContext("2d");
+        const report = window.WINTER_REPORT;
+        const toPoints = (s) => s.x.map((x, i) => ({x: x, y: s.y[i], symbol: s.label ? s.label[i] : undefined}));
+        
+        // Buy and sell points
+        const buyPoints = toPoints(report.buys);
+        const sellPoints = toPoints(report.sells);
+        
+        const equityChart = new Chart(ctx, {
+            type: "line",
+            data: {
+                datasets: [{
+                    label: "Equity Curve",
+                    data: toPoints(report.equity),
+                    borderColor: "#0066cc",
+                    backgroundColor: 'rgba(0, 102, 204, 0.1)',
+                    borderWidth: 2,
+                    fill: true,
+                    tension: 0.1
+                },
+                {
+                    label: "Buy Points",
+                    data: buyPoints,
+                    backgroundColor: "#00aa00",
+                    borderColor: "#00aa00",
+                    pointRadius: 5,
+                    pointHoverRadius: 8,
+                    showLine: false
+                },
+                {
+                    label: "Sell Points",
+                    data: sellPoints,
+                    backgroundColor: "#cc0000",
+                    borderColor: "#cc0000",
+                    pointRadius: 5,
+                    pointHoverRadius: 8,
+                    showLine: false
+                }]
+            },
+            options: {
+                responsive: true,
+                maintainAspectRatio: false,
+                plugins: {
+                    title: {
+                        display: true,
+                        text: "Equity Curve with Trade Markers"
+                    },
+                    tooltip: {
+                        mode: "index",
+                        intersect: false,
+                        callbacks: {
+                            label: function(context) {
+                                if (context.dataset.label === "Equity Curve") {
+                                    return "Equity: $" + context.raw.y.toFixed(2);
+                                } else if (context.dataset.label === "Buy Points") {
+                                    return "Buy: " + context.raw.symbol + " at $" + context.raw.y.toFixed(2);
+                                } else if (context.dataset.label === "Sell Points") {
+                                    return "Sell: " + context.raw.symbol + " at $" + context.raw.y.toFixed(2);
+                                }
+                            }
+                        }
+                    }
+                },
+                scales: {
+                    y: {
+                        beginAtZero: false,
+                        title: {
+                            display: true,
+                            text: 'Equity ($)'
+                        }
+                    },
+                    x: {
+                        type: "linear",
+                        title: {
+                            display: true,
+                            text: "Time"
+                        }
+                    }
+                }
+            }
+        });
+    </script>
+</body>
+</html>
+)";
+    
+    html_file.close();
+    winter::utils::Logger::info() << "Generated HTML report: " << output_file << winter::utils::Logger::endl;
+    return true;
+}
+
+std::string result_file_name(const std::string& file, const StrategyResult& result, size_t result_count) {
+    if (result_count <= 1) {
+        return file;
+    }
+    std::string prefix = result.strategy_name;
+    std::replace_if(prefix.begin(), prefix.end(), [](char c) { return c == '/' || c == '\\'; }, '_');
+    return prefix + "_" + file;
+}
+
+bool write_metrics_json(const std::string& json_file, const RunSummary& run,
+                        const std::vector<StrategyResult>& results) {
+    winter::utils::BufferedWriter out(json_file, 1 << 14);
+    if (!out.is_open()) {
+        winter::utils::Logger::error() << "Failed to create metrics file: " << json_file << winter::utils::Logger::endl;
+        return false;
+    }
+
+    out.write("{\n  \"mode\": ");
+    out.write_json_string(run.mode);
+    out.write(",\n  \"data_files\": [");
+    for (size_t i = 0; i < run.data_files.size(); ++i) {
+        out.write(i ? ", " : "");
+        out.write_json_string(run.data_files[i]);
+    }
+    out.write("],\n  \"ticks\": ");
+    out.write_int(static_cast<int64_t>(run.ticks));
+    out.write(",\n  \"threads\": ");
+    out.write_int(static_cast<int64_t>(run.threads));
+    out.write(",\n");
+    if (!run.profile.empty()) {
+        out.write("  \"profile\": {");
+        for (size_t i = 0; i < run.profile.size(); ++i) {
+            out.write(i ? ", " : "");
+            out.write_json_string(run.profile[i].first);
+            out.write(": ");
+            out.write_double(run.profile[i].second);  // NaN and infinity become null
+        }
+        out.write("},\n");
+    }
+
+    out.write("  \"strategies\": [");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const StrategyResult& r = results[i];
+        const PerformanceMetrics& m = r.metrics;
+        const std::pair<const char*, double> fields[] = {
+            {"initial_capital", m.initial_capital},
+            {"final_capital", m.final_capital},
+            {"total_return", m.total_return},
+            {"total_return_pct", m.total_return_pct},
+            {"annualized_return", m.annualized_return},
+            {"sharpe_ratio", m.sharpe_ratio},
+            {"sortino_ratio", m.sortino_ratio},
+            {"volatility", m.volatility},
+            {"max_drawdown", m.max_drawdown},
+            {"max_drawdown_pct", m.max_drawdown_pct},
+            {"max_drawdown_duration", m.max_drawdown_duration},
+            {"total_trades", static_cast<double>(m.total_trades)},
+            {"winning_trades", static_cast<double>(m.winning_trades)},
+            {"losing_trades", static_cast<double>(m.losing_trades)},
+            {"win_rate", m.win_rate},
+            {"profit_factor", m.profit_factor},
+            {"avg_profit_per_trade", m.avg_profit_per_trade},
+            {"avg_loss_per_trade", m.avg_loss_per_trade},
+            {"signals", static_cast<double>(r.signals)},
+            {"orders_executed", static_cast<double>(r.orders_executed)},
+            {"orders_rejected", static_cast<double>(r.orders_rejected)},
+        };
+        out.write(i ? ",\n    {\"name\": " : "\n    {\"name\": ");
+        out.write_json_string(r.strategy_name);
+        for (const auto& [name, value] : fields) {
+            out.write(", \"");
+            out.write(name);
+            out.write("\": ");
+            out.write_double(value);
+        }
+        out.write('}');
+    }
+    out.write("\n  ]\n}\n");
+    out.close();
+    return true;
+}
+
+} // namespace winter::backtest
@@ -0,0 +1,65 @@
+#include <winter/backtest/report_writer.hpp>
+#include <winter/utils/logger.hpp>
+#include <filesystem>
+
+namespace winter::backtest {
+
+ReportWriter::ReportWriter(const std::string& html_file, size_t max_points)
+    : data_file_(data_file_for(html_file)),
+      out_(data_file_),
+      max_points_(max_points) {
+    selected_.reserve(max_points_ + 1);
+    out_.write("window.WINTER_REPORT = {");
+}
+
+ReportWriter::~ReportWriter() {
+    close();
+}
+
+std::string ReportWriter::data_file_for(const std::string& html_file) {
+    std::filesystem::path path(html_file);
+    if (path.extension() == ".html" || path.extension() == ".htm") {
+        path.replace_extension();
+    }
+    return path.string() + ".data.js";
+}
+
+std::string ReportWriter::data_script_src() const {
+    return std::filesystem::path(data_file_).filename().string();
+}
+
+void ReportWriter::begin_field(std::string_view name) {
+    if (!first_field_) {
+        out_.write(',');
+    }
+    out_.write('\n');
+    out_.write_json_string(name);
+    out_.write(':');
+    first_field_ = false;
+}
+
+void ReportWriter::number(std::string_view name, double value) {
+    begin_field(name);
+    out_.write_double(value);
+}
+
+void ReportWriter::text(std::string_view name, std::string_view value) {
+    begin_field(name);
+    out_.write_json_string(value);
+}
+
+bool ReportWriter::close() {
+    if (!out_.is_open()) {
+        return false;
+    }
+
+    out_.write("\n};\n");
+    size_t bytes = out_.bytes_written();
+    out_.close();
+
+    winter::utils::Logger::info() << "Wrote report data: " << data_file_
+                                  << " (" << bytes << " bytes)" << winter::utils::Logger::endl;
+    return true;
+}
+
+} // namespace winter::backtest
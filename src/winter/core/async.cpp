@@ -0,0 +1,313 @@
+#include <winter/core/async.hpp>
+#include <winter/utils/core_affinity.hpp>
+#include <winter/utils/logger.hpp>
+#include <algorithm>
+#include <functional>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+namespace winter::core {
+
+namespace {
+
+thread_local Executor* current_executor = nullptr;
+
+// Event clocks only move with the data, so their timers are re-checked often
+constexpr int EVENT_CLOCK_POLL_MS = 1;
+
+#ifdef _WIN32
+// Without poll() readers are woken on this interval and re-check themselves
+constexpr int READER_POLL_MS = 5;
+#endif
+
+} // namespace
+
+// Top-level frame for spawned tasks; frees itself when the task finishes
+struct Executor::Root {
+    struct promise_type {
+        Executor* executor = nullptr;
+
+        Root get_return_object() { return Root{std::coroutine_handle<promise_type>::from_promise(*this)}; }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+
+        struct FinalAwaiter {
+            bool await_ready() noexcept { return false; }
+            void await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+                Executor* executor = handle.promise().executor;
+                {
+                    std::lock_guard<std::mutex> lock(executor->ready_mutex_);
+                    executor->roots_.erase(handle.address());
+                }
+                handle.destroy();
+            }
+            void await_resume() noexcept {}
+        };
+        FinalAwaiter final_suspend() noexcept { return {}; }
+
+        void return_void() {}
+        void unhandled_exception() {}
+    };
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+Executor::Executor(std::string name, int core, ClockPtr clock)
+    : name_(std::move(name)), core_(core), clock_(std::move(clock)) {
+#ifndef _WIN32
+    if (::pipe(wake_pipe_) == 0) {
+        for (int fd : wake_pipe_) {
+            ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+        }
+    } else {
+        wake_pipe_[0] = wake_pipe_[1] = -1;
+        utils::Logger::error() << "Executor " << name_ << ": failed to create wake pipe" << utils::Logger::endl;
+    }
+#endif
+}
+
+Executor::~Executor() {
+    stop();
+    join();
+    // Tasks spawned on an executor that never ran
+    for (void* root : roots_) {
+        std::coroutine_handle<>::from_address(root).destroy();
+    }
+#ifndef _WIN32
+    for (int fd : wake_pipe_) {
+        if (fd >= 0) {
+            ::close(fd);
+        }
+    }
+#endif
+}
+
+bool Executor::start() {
+#ifndef _WIN32
+    if (wake_pipe_[0] < 0) {
+        return false;
+    }
+#endif
+    if (thread_.joinable()) {
+        return false;
+    }
+    stopping_ = false;
+    thread_ = std::thread([this]() { run(); });
+    if (core_ >= 0 && !utils::CoreAffinity::pin_thread_to_core(thread_.native_handle(), core_)) {
+        utils::Logger::warn() << "Executor " << name_ << ": failed to pin to core " << core_ << utils::Logger::endl;
+    }
+    return true;
+}
+
+void Executor::stop() {
+    stopping_ = true;
+    wake();
+}
+
+void Executor::join() {
+    if (thread_.joinable() && thread_.get_id() != std::this_thread::get_id()) {
+        thread_.join();
+    }
+}
+
+void Executor::spawn(Task<void> task) {
+    Root root = run_root(std::move(task));
+    root.handle.promise().executor = this;
+    {
+        std::lock_guard<std::mutex> lock(ready_mutex_);
+        roots_.insert(root.handle.address());
+    }
+    post(root.handle);
+}
+
+Executor::Root Executor::run_root(Task<void> task) {
+    try {
+        co_await task;
+    } catch (const std::exception& e) {
+        utils::Logger::error() << "Executor " << name_ << ": task failed: " << e.what() << utils::Logger::endl;
+    } catch (...) {
+        utils::Logger::error() << "Executor " << name_ << ": task failed with an unknown exception" << utils::Logger::endl;
+    }
+}
+
+void Executor::post(std::coroutine_handle<> handle) {
+    {
+        std::lock_guard<std::mutex> lock(ready_mutex_);
+        ready_.push_back(handle);
+    }
+    if (!running_here()) {
+        wake();
+    }
+}
+
+bool Executor::running_here() const {
+    return current_executor == this;
+}
+
+Executor* Executor::current() {
+    return current_executor;
+}
+
+void Executor::wake() {
+#ifdef _WIN32
+    {
+        std::lock_guard<std::mutex> lock(ready_mutex_);
+        wake_pending_ = true;
+    }
+    wake_cv_.notify_one();
+#else
+    if (wake_pipe_[1] >= 0) {
+        char byte = 1;
+        // A full pipe already guarantees a wake-up
+        [[maybe_unused]] auto written = ::write(wake_pipe_[1], &byte, 1);
+    }
+#endif
+}
+
+void Executor::add_timer(int64_t deadline, std::coroutine_handle<> handle) {
+    timers_.push_back(Timer{deadline, handle});
+    std::push_heap(timers_.begin(), timers_.end(), std::greater<>());
+}
+
+void Executor::add_reader(int fd, std::coroutine_handle<> handle) {
+    readers_.push_back(Reader{fd, handle});
+}
+
+void Executor::run() {
+    current_executor = this;
+    utils::Logger::info() << "Executor " << name_ << " started" << utils::Logger::endl;
+
+    while (!stopping_) {
+        run_ready();
+        fire_timers();
+        if (stopping_) {
+            break;
+        }
+        poll_once(poll_timeout_ms());
+    }
+
+    // Whatever is still suspended here will never be resumed
+    std::vector<void*> roots;
+    {
+        std::lock_guard<std::mutex> lock(ready_mutex_);
+        roots.assign(roots_.begin(), roots_.end());
+        roots_.clear();
+        ready_.clear();
+    }
+    timers_.clear();
+    readers_.clear();
+    for (void* root : roots) {
+        std::coroutine_handle<>::from_address(root).destroy();
+    }
+    current_executor = nullptr;
+}
+
+void Executor::run_ready() {
+    std::vector<std::coroutine_handle<>> batch;
+    {
+        std::lock_guard<std::mutex> lock(ready_mutex_);
+        batch.swap(ready_);
+    }
+    for (auto handle : batch) {
+        handle.resume();
+        if (stopping_) {
+            break;
+        }
+    }
+}
+
+void Executor::fire_timers() {
+    int64_t now = clock_->now_ns();
+    while (!timers_.empty() && timers_.front().deadline <= now && !stopping_) {
+        std::pop_heap(timers_.begin(), timers_.end(), std::greater<>());
+        auto handle = timers_.back().handle;
+        timers_.pop_back();
+        handle.resume();
+    }
+}
+
+int Executor::poll_timeout_ms() const {
+    {
+        std::lock_guard<std::mutex> lock(ready_mutex_);
+        if (!ready_.empty()) {
+            return 0;
+        }
+    }
+    if (timers_.empty()) {
+        return -1;
+    }
+    if (!dynamic_cast<const RealClock*>(clock_.get())) {
+        return EVENT_CLOCK_POLL_MS;
+    }
+    int64_t wait_ns = std::max<int64_t>(0, timers_.front().deadline - clock_->now_ns());
+    return static_cast<int>(std::min<int64_t>((wait_ns + 999999) / 1000000, 60000));
+}
+
+#ifdef _WIN32
+void Executor::poll_once(int timeout_ms) {
+    if (!readers_.empty()) {
+        timeout_ms = timeout_ms < 0 ? READER_POLL_MS : std::min(timeout_ms, READER_POLL_MS);
+    }
+    {
+        std::unique_lock<std::mutex> lock(ready_mutex_);
+        auto signalled = [this]() { return wake_pending_ || !ready_.empty(); };
+        if (timeout_ms < 0) {
+            wake_cv_.wait(lock, signalled);
+        } else {
+            wake_cv_.wait_for(lock, std::chrono::milliseconds(timeout_ms), signalled);
+        }
+        wake_pending_ = false;
+    }
+
+    // Every reader gets a turn; a resumed coroutine may register new ones
+    std::vector<Reader> woken;
+    woken.swap(readers_);
+    for (const auto& reader : woken) {
+        reader.handle.resume();
+        if (stopping_) {
+            break;
+        }
+    }
+}
+#else
+void Executor::poll_once(int timeout_ms) {
+    std::vector<pollfd> fds;
+    fds.reserve(readers_.size() + 1);
+    fds.push_back(pollfd{wake_pipe_[0], POLLIN, 0});
+    for (const auto& reader : readers_) {
+        fds.push_back(pollfd{reader.fd, POLLIN, 0});
+    }
+
+    if (::poll(fds.data(), fds.size(), timeout_ms) <= 0) {
+        return;
+    }
+
+    if (fds[0].revents & POLLIN) {
+        char buffer[64];
+        while (::read(wake_pipe_[0], buffer, sizeof(buffer)) > 0) {
+        }
+    }
+
+    // Resume after the scan; a resumed coroutine may register new readers
+    std::vector<std::coroutine_handle<>> woken;
+    std::vector<Reader> waiting;
+    for (size_t i = 0; i < readers_.size(); ++i) {
+        if (fds[i + 1].revents & (POLLIN | POLLHUP | POLLERR)) {
+            woken.push_back(readers_[i].handle);
+        } else {
+            waiting.push_back(readers_[i]);
+        }
+    }
+    readers_.swap(waiting);
+    for (auto handle : woken) {
+        handle.resume();
+        if (stopping_) {
+            break;
+        }
+    }
+}
+#endif
+
+} // namespace winter::core
@@ -0,0 +1,204 @@
+#include <winter/core/checkpoint.hpp>
+#include <winter/utils/core_affinity.hpp>
+#include <winter/utils/logger.hpp>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+namespace winter::core {
+
+namespace {
+
+constexpr char CHECKPOINT_MAGIC[4] = {'W', 'C', 'K', 'P'};
+constexpr uint32_t CHECKPOINT_VERSION = 1;
+
+uint64_t fnv1a(const char* data, size_t size) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+} // namespace
+
+Checkpointer::Checkpointer(Engine& engine, std::string path, std::chrono::milliseconds interval)
+    : engine_(engine), path_(std::move(path)), interval_(interval) {
+}
+
+Checkpointer::~Checkpointer() {
+    stop();
+}
+
+void Checkpointer::start(int core) {
+    if (running_) {
+        return;
+    }
+    running_ = true;
+    thread_ = std::thread([this, core]() {
+        if (core >= 0 && !utils::CoreAffinity::pin_current_thread(core)) {
+            utils::Logger::warn() << "Failed to pin checkpoint thread to core " << core << utils::Logger::endl;
+        }
+        run();
+    });
+}
+
+void Checkpointer::stop() {
+    if (!running_) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(cv_mutex_);
+        running_ = false;
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    checkpoint_now();
+}
+
+void Checkpointer::run() {
+    std::unique_lock<std::mutex> lock(cv_mutex_);
+    while (running_) {
+        if (cv_.wait_for(lock, interval_, [this]() { return !running_; })) {
+            break;
+        }
+        lock.unlock();
+        checkpoint_now();
+        lock.lock();
+    }
+}
+
+bool Checkpointer::checkpoint_now() {
+    auto start_time = std::chrono::steady_clock::now();
+
+    utils::BinaryWriter engine_state;
+    utils::BinaryWriter extra_state;
+    engine_.pause();
+    engine_.save_snapshot(engine_state);
+    if (save_hook_) {
+        save_hook_(extra_state);
+    }
+    engine_.resume();
+
+    auto paused_us = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start_time).count();
+
+    utils::BinaryWriter snapshot;
+    snapshot.write_blob(engine_state);
+    snapshot.write_blob(extra_state);
+    if (!write_file(path_, snapshot)) {
+        return false;
+    }
+
+    ++checkpoints_written_;
+    utils::Logger::debug() << "Checkpoint written to " << path_ << " (" << snapshot.size()
+                           << " bytes, engine paused " << paused_us << "us)" << utils::Logger::endl;
+    return true;
+}
+
+bool Checkpointer::write_file(const std::string& path, const utils::BinaryWriter& payload) {
+    utils::BinaryWriter header;
+    header.write_bytes(CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC));
+    header.write(CHECKPOINT_VERSION);
+    header.write<uint64_t>(payload.size());
+    uint64_t checksum = fnv1a(payload.data(), payload.size());
+
+    std::string tmp_path = path + ".tmp";
+    FILE* file = std::fopen(tmp_path.c_str(), "wb");
+    if (!file) {
+        utils::Logger::error() << "Failed to open checkpoint file: " << tmp_path << utils::Logger::endl;
+        return false;
+    }
+
+    bool ok = std::fwrite(header.data(), 1, header.size(), file) == header.size() &&
+              std::fwrite(payload.data(), 1, payload.size(), file) == payload.size() &&
+              std::fwrite(&checksum, 1, sizeof(checksum), file) == sizeof(checksum) &&
+              std::fflush(file) == 0;
+#ifndef _WIN32
+    ok = ok && ::fsync(fileno(file)) == 0;
+#endif
+    ok = (std::fclose(file) == 0) && ok;
+
+    if (!ok) {
+        utils::Logger::error() << "Failed to write checkpoint file: " << tmp_path << utils::Logger::endl;
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmp_path, path, ec);
+    if (ec) {
+        utils::Logger::error() << "Failed to replace checkpoint " << path << ": " << ec.message() << utils::Logger::endl;
+        return false;
+    }
+    return true;
+}
+
+bool Checkpointer::read_file(const std::string& path, std::vector<char>& payload) {
+    FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) {
+        utils::Logger::error() << "Failed to open checkpoint file: " << path << utils::Logger::endl;
+        return false;
+    }
+
+    char magic[4] = {};
+    uint32_t version = 0;
+    uint64_t size = 0;
+    bool ok = std::fread(magic, 1, sizeof(magic), file) == sizeof(magic) &&
+              std::fread(&version, 1, sizeof(version), file) == sizeof(version) &&
+              std::fread(&size, 1, sizeof(size), file) == sizeof(size);
+
+    if (!ok || std::memcmp(magic, CHECKPOINT_MAGIC, sizeof(magic)) != 0 || version != CHECKPOINT_VERSION) {
+        utils::Logger::error() << "Not a valid checkpoint file: " << path << utils::Logger::endl;
+        std::fclose(file);
+        return false;
+    }
+
+    std::error_code ec;
+    uintmax_t file_size = std::filesystem::file_size(path, ec);
+    if (ec || size > file_size) {
+        utils::Logger::error() << "Truncated checkpoint file: " << path << utils::Logger::endl;
+        std::fclose(file);
+        return false;
+    }
+
+    payload.resize(size);
+    uint64_t checksum = 0;
+    ok = std::fread(payload.data(), 1, size, file) == size &&
+         std::fread(&checksum, 1, sizeof(checksum), file) == sizeof(checksum);
+    std::fclose(file);
+
+    if (!ok || checksum != fnv1a(payload.data(), payload.size())) {
+        utils::Logger::error() << "Checkpoint checksum mismatch: " << path << utils::Logger::endl;
+        payload.clear();
+        return false;
+    }
+    return true;
+}
+
+bool Checkpointer::restore(Engine& engine, const std::string& path, const LoadHook& load_hook) {
+    std::vector<char> payload;
+    if (!read_file(path, payload)) {
+        return false;
+    }
+
+    utils::BinaryReader reader(payload);
+    utils::BinaryReader engine_state = reader.read_blob();
+    utils::BinaryReader extra_state = reader.read_blob();
+    if (!engine.restore_snapshot(engine_state)) {
+        return false;
+    }
+    if (load_hook && !load_hook(extra_state)) {
+        utils::Logger::error() << "Corrupt application state in checkpoint: " << path << utils::Logger::endl;
+        return false;
+    }
+    return true;
+}
+
+} // namespace winter::core
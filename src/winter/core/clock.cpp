@@ -0,0 +1,29 @@
+#include <winter/core/clock.hpp>
+#include <winter/utils/tsc_clock.hpp>
+#include <ctime>
+
+namespace winter::core {
+
+int64_t RealClock::now_ns() const {
+    return utils::TscClock::instance().now_epoch_ns();
+}
+
+ClockPtr real_clock() {
+    static ClockPtr clock = std::make_shared<RealClock>();
+    return clock;
+}
+
+std::string format_time_of_day(int64_t ns) {
+    std::time_t seconds = static_cast<std::time_t>(ns / 1000000000);
+    std::tm tm{};
+#ifdef _WIN32
+    localtime_s(&tm, &seconds);
+#else
+    localtime_r(&seconds, &tm);
+#endif
+    char time_buffer[20];
+    std::strftime(time_buffer, sizeof(time_buffer), "%H:%M:%S", &tm);
+    return time_buffer;
+}
+
+} // namespace winter::core
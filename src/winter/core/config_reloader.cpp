@@ -0,0 +1,80 @@
+#include <winter/core/config_reloader.hpp>
+#include <winter/utils/logger.hpp>
+#include <utility>
+#include <vector>
+
+namespace winter::core {
+
+ConfigReloader::ConfigReloader(Engine& engine, std::string path, utils::WinterConfig current)
+    : engine_(engine), path_(std::move(path)), current_(std::move(current)), watcher_(path_) {}
+
+bool ConfigReloader::reload() {
+    utils::WinterConfig next;
+    std::string error;
+    if (!utils::WinterConfig::load(path_, next, error)) {
+        rejected_.fetch_add(1);
+        utils::Logger::error() << "Config reload rejected, keeping the running parameters: " << error
+                               << utils::Logger::endl;
+        return false;
+    }
+
+    // Only strategies this engine runs; other entries wait for a restart
+    std::vector<std::pair<std::string, utils::ConfigValues>> updates;
+    std::vector<std::string> changes;
+    for (const auto& name : current_.enabled_strategies) {
+        if (!engine_.get_strategy(name)) {
+            continue;
+        }
+        const utils::ConfigValues& values = next.parameters_for(name);
+        auto diff = utils::diff_config_values(current_.parameters_for(name), values);
+        if (diff.empty()) {
+            continue;
+        }
+        for (const auto& change : diff) {
+            changes.push_back(name + "." + change);
+        }
+        updates.emplace_back(name, values);
+    }
+
+    std::vector<std::string> errors;
+    if (!updates.empty() && !engine_.reconfigure_strategies(updates, errors)) {
+        rejected_.fetch_add(1);
+        utils::Logger::error() << "Config reload rejected, keeping the running parameters:" << utils::Logger::endl;
+        for (const auto& message : errors) {
+            utils::Logger::error() << "  " << message << utils::Logger::endl;
+        }
+        return false;
+    }
+
+    if (next.enabled_strategies != current_.enabled_strategies) {
+        utils::Logger::warn() << "Config reload: enabled_strategies changes take effect on restart"
+                              << utils::Logger::endl;
+        next.enabled_strategies = current_.enabled_strategies;
+    }
+    if (changes.empty()) {
+        utils::Logger::info() << "Config reloaded from " << path_ << ": no parameter changes" << utils::Logger::endl;
+    } else {
+        utils::Logger::info() << "Config reloaded from " << path_ << ":" << utils::Logger::endl;
+        for (const auto& change : changes) {
+            utils::Logger::info() << "  " << change << utils::Logger::endl;
+        }
+    }
+    current_ = std::move(next);
+    reloads_.fetch_add(1);
+    return true;
+}
+
+Task<void> ConfigReloader::watch(Executor& executor) {
+    if (!watcher_.ok()) {
+        co_return;
+    }
+    utils::Logger::info() << "Watching " << path_ << " for parameter changes" << utils::Logger::endl;
+    while (true) {
+        co_await executor.readable(watcher_.fd());
+        if (watcher_.changed()) {
+            reload();
+        }
+    }
+}
+
+} // namespace winter::core
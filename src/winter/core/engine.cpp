@@ -1,14 +1,16 @@
 #include <winter/core/engine.hpp>
+#include <winter/core/execution.hpp>
+#include <winter/utils/alloc_tracker.hpp>
+#include <winter/utils/core_affinity.hpp>
 #include <winter/utils/logger.hpp>
+#include <winter/utils/realtime.hpp>
 #include <algorithm>
-#include <execution>
-#include <windows.h>
 
 
 namespace winter::core {
 
 Engine::Engine() 
-    : running_(false) {
+    : strategies_(new StrategySet()), running_(false) {
     // Initialize with default configuration
     EngineConfiguration default_config;
     config_ = default_config;
@@ -16,32 +18,325 @@ Engine::Engine()
 
 Engine::~Engine() {
     stop();
+    std::lock_guard<std::mutex> lock(strategies_mutex_);
+    reclaim_strategy_sets();
+    delete strategies_.load();
 }
 
 void Engine::configure(const EngineConfiguration& config) {
+    bool resize = config.market_data_queue_size != config_.market_data_queue_size ||
+                  config.order_queue_size != config_.order_queue_size ||
+                  config.use_huge_pages != config_.use_huge_pages;
     config_ = config;
     
-    // Note: We can't resize the queues since they're fixed-size template parameters
-    // If you need different sizes, you'd need to create new queues
+    if (running_) {
+        // Queues cannot be swapped under the running threads
+        if (resize) {
+            queues_stale_ = true;
+            utils::Logger::warn() << "Queue size changes take effect at the next start" << utils::Logger::endl;
+        }
+        return;
+    }
+    if (resize || queues_stale_ || market_data_queue_.capacity() == 0) {
+        allocate_queues();
+    }
+    apply_overflow_policies();
+}
+
+OverflowPolicy Engine::default_overflow_policy(EngineConfiguration::ExecutionMode mode) {
+    switch (mode) {
+    case EngineConfiguration::ExecutionMode::BACKTEST: return OverflowPolicy::BLOCK;
+    case EngineConfiguration::ExecutionMode::PAPER_TRADING: return OverflowPolicy::REJECT;
+    case EngineConfiguration::ExecutionMode::LIVE_TRADING: return OverflowPolicy::DROP_OLDEST;
+    }
+    return OverflowPolicy::BLOCK;
+}
+
+OverflowPolicy Engine::default_order_overflow_policy(EngineConfiguration::ExecutionMode mode) {
+    return mode == EngineConfiguration::ExecutionMode::BACKTEST ? OverflowPolicy::BLOCK : OverflowPolicy::REJECT;
+}
+
+void Engine::apply_overflow_policies() {
+    OverflowPolicy market_data_policy = config_.market_data_overflow;
+    if (market_data_policy == OverflowPolicy::DEFAULT) {
+        market_data_policy = default_overflow_policy(config_.execution_mode);
+    }
+    market_data_queue_.set_policy(market_data_policy);
+    
+    // Evicting or merging queued orders would lose them without a trace
+    OverflowPolicy order_policy = config_.order_overflow;
+    if (order_policy == OverflowPolicy::DEFAULT) {
+        order_policy = default_order_overflow_policy(config_.execution_mode);
+    } else if (order_policy == OverflowPolicy::DROP_OLDEST || order_policy == OverflowPolicy::CONFLATE) {
+        utils::Logger::error() << "Order queue cannot use overflow policy " << to_string(order_policy)
+                               << "; rejecting instead" << utils::Logger::endl;
+        order_policy = OverflowPolicy::REJECT;
+    }
+    order_queue_.set_policy(order_policy);
+}
+
+void Engine::allocate_queues() {
+    queues_stale_ = false;
+    market_data_queue_.reset(config_.market_data_queue_size, config_.use_huge_pages);
+    order_queue_.reset(config_.order_queue_size, config_.use_huge_pages);
+    
+    utils::Logger::info() << "Market data queue: configured " << config_.market_data_queue_size
+                          << ", effective " << market_data_queue_.capacity()
+                          << (market_data_queue_.on_huge_pages() ? " (huge pages)" : "")
+                          << "; order queue: configured " << config_.order_queue_size
+                          << ", effective " << order_queue_.capacity()
+                          << (order_queue_.on_huge_pages() ? " (huge pages)" : "") << utils::Logger::endl;
+}
+
+uint64_t Engine::orders_settled() const {
+    OverflowStats overflow = order_queue_.stats();
+    return orders_filled_.load(std::memory_order_acquire) +
+           overflow.dropped_oldest + overflow.conflated + overflow.rejected;
+}
+
+void Engine::set_clock(ClockPtr clock) {
+    clock_ = std::move(clock);
+    event_clock_ = std::dynamic_pointer_cast<SimulatedClock>(clock_);
+    portfolio_.set_clock(clock_);
+    std::lock_guard<std::mutex> lock(strategies_mutex_);
+    for (auto& strategy : current_strategies()) {
+        strategy->set_clock(clock_);
+    }
+}
+
+void Engine::publish_strategies(StrategySet next) {
+    const StrategySet* previous = strategies_.exchange(new StrategySet(std::move(next)));
+    // Any batch still reading the previous set ends before the epoch moves on
+    retired_strategy_sets_.push_back(RetiredStrategySet{previous, strategy_epoch_.load()});
+    reclaim_strategy_sets();
+}
+
+void Engine::reclaim_strategy_sets() {
+    const bool reader_active = strategy_reader_active_.load();
+    const uint64_t epoch = strategy_epoch_.load();
+    auto expired = std::partition(retired_strategy_sets_.begin(), retired_strategy_sets_.end(),
+                                  [&](const RetiredStrategySet& r) { return reader_active && epoch <= r.epoch; });
+    for (auto it = expired; it != retired_strategy_sets_.end(); ++it) {
+        delete it->set;
+    }
+    retired_strategy_sets_.erase(expired, retired_strategy_sets_.end());
 }
 
 void Engine::add_strategy(std::shared_ptr<winter::strategy::StrategyBase> strategy) {
-    strategies_.push_back(strategy);
+    strategy->set_clock(clock_);
+    std::lock_guard<std::mutex> lock(strategies_mutex_);
+    StrategySet next = current_strategies();
+    next.push_back(std::move(strategy));
+    publish_strategies(std::move(next));
+}
+
+void Engine::remove_strategy(const std::string& name) {
+    std::lock_guard<std::mutex> lock(strategies_mutex_);
+    StrategySet next = current_strategies();
+    auto it = std::find_if(next.begin(), next.end(), [&name](const auto& s) { return s->name() == name; });
+    if (it == next.end()) {
+        utils::Logger::warn() << "No strategy named " << name << " to remove" << utils::Logger::endl;
+        return;
+    }
+    // The strategy (and any plugin behind it) goes once its retired set is reclaimed
+    next.erase(it);
+    publish_strategies(std::move(next));
+    strategy_plugins_.erase(name);
+    utils::Logger::info() << "Removed strategy " << name << utils::Logger::endl;
+}
+
+strategy::StrategyPtr Engine::get_strategy(const std::string& name) const {
+    std::lock_guard<std::mutex> lock(strategies_mutex_);
+    const auto& strategies = current_strategies();
+    auto it = std::find_if(strategies.begin(), strategies.end(), [&name](const auto& s) { return s->name() == name; });
+    return it == strategies.end() ? nullptr : *it;
+}
+
+size_t Engine::strategy_count() const {
+    std::lock_guard<std::mutex> lock(strategies_mutex_);
+    return current_strategies().size();
+}
+
+bool Engine::reconfigure_strategies(const std::vector<std::pair<std::string, utils::ConfigValues>>& updates,
+                                    std::vector<std::string>& errors) {
+    std::vector<PendingConfig> validated;
+    const size_t first_error = errors.size();
+    for (const auto& [name, values] : updates) {
+        strategy::StrategyPtr target = get_strategy(name);
+        if (!target) {
+            errors.push_back("no strategy named " + name);
+            continue;
+        }
+        std::vector<std::string> strategy_errors;
+        if (!target->validate_config(values, strategy_errors)) {
+            for (const auto& error : strategy_errors) {
+                errors.push_back(name + ": " + error);
+            }
+            continue;
+        }
+        validated.push_back(PendingConfig{name, values});
+    }
+    if (errors.size() != first_error) {
+        return false;
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(pending_configs_mutex_);
+        for (auto& pending : validated) {
+            pending_configs_.push_back(std::move(pending));
+        }
+        configs_pending_.store(true, std::memory_order_release);
+    }
+    if (!strategy_reader_active_.load()) {
+        std::lock_guard<std::mutex> lock(strategies_mutex_);
+        apply_pending_configs();
+    }
+    return true;
+}
+
+void Engine::apply_pending_configs() {
+    // Held while configuring so a stopping engine and its last batch never apply concurrently
+    std::lock_guard<std::mutex> lock(pending_configs_mutex_);
+    configs_pending_.store(false, std::memory_order_relaxed);
+    const auto& strategies = current_strategies();
+    for (auto& pending : pending_configs_) {
+        auto it = std::find_if(strategies.begin(), strategies.end(),
+                               [&pending](const auto& s) { return s->name() == pending.strategy_name; });
+        if (it == strategies.end()) {
+            utils::Logger::warn() << "Strategy " << pending.strategy_name
+                                  << " was removed before its parameter update applied" << utils::Logger::endl;
+        } else if (!(*it)->configure(pending.values)) {
+            utils::Logger::error() << "Strategy " << pending.strategy_name
+                                   << " rejected parameters that passed validation" << utils::Logger::endl;
+        }
+    }
+    pending_configs_.clear();
+}
+
+bool Engine::replace_strategy(const std::string& name, strategy::StrategyPtr replacement, bool transfer_state) {
+    if (!replacement) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(strategies_mutex_);
+    StrategySet next = current_strategies();
+    auto it = std::find_if(next.begin(), next.end(), [&name](const auto& s) { return s->name() == name; });
+    if (it == next.end()) {
+        utils::Logger::error() << "No strategy named " << name << " to replace" << utils::Logger::endl;
+        return false;
+    }
+    
+    // Quiesced from here on: the old instance's state and parameters are final,
+    // including updates the strategy thread had not reached yet
+    pause();
+    apply_pending_configs();
+    strategy::StrategyPtr previous = *it;
+    replacement->set_clock(clock_);
+    if (!replacement->configure(previous->config())) {
+        resume();
+        utils::Logger::error() << "New build of " << name << " rejected the current configuration; keeping the old one"
+                               << utils::Logger::endl;
+        return false;
+    }
+    
+    if (transfer_state) {
+        utils::BinaryWriter state;
+        previous->serialize(state);
+        utils::BinaryReader reader(state.buffer());
+        if (!replacement->deserialize(reader)) {
+            resume();
+            utils::Logger::error() << "New build of " << name << " rejected the old state; keeping the old one"
+                                   << utils::Logger::endl;
+            return false;
+        }
+    }
+    *it = replacement;
+    publish_strategies(std::move(next));
+    resume();
+    
+    utils::Logger::info() << "Replaced strategy " << name << (transfer_state ? " (state handed over)" : " (fresh state)")
+                          << utils::Logger::endl;
+    return true;
+}
+
+strategy::StrategyPtr Engine::load_strategy_plugin(const std::string& path, const std::string& instance_name) {
+    auto plugin = strategy::StrategyPlugin::load(path);
+    auto instance = plugin ? plugin->create(instance_name) : nullptr;
+    if (!instance) {
+        return nullptr;
+    }
+    instance->set_clock(clock_);
+    
+    std::lock_guard<std::mutex> lock(strategies_mutex_);
+    StrategySet next = current_strategies();
+    if (std::any_of(next.begin(), next.end(), [&](const auto& s) { return s->name() == instance->name(); })) {
+        utils::Logger::error() << "Strategy " << instance->name() << " already exists; swap it instead" << utils::Logger::endl;
+        return nullptr;
+    }
+    next.push_back(instance);
+    publish_strategies(std::move(next));
+    strategy_plugins_[instance->name()] = plugin;
+    return instance;
+}
+
+bool Engine::swap_strategy_plugin(const std::string& name, const std::string& path) {
+    auto plugin = strategy::StrategyPlugin::load(path);
+    auto instance = plugin ? plugin->create(name) : nullptr;
+    if (!instance) {
+        return false;
+    }
+    
+    bool transfer_state = true;
+    {
+        std::lock_guard<std::mutex> lock(strategies_mutex_);
+        auto previous = strategy_plugins_.find(name);
+        if (previous != strategy_plugins_.end() && previous->second->state_version() != plugin->state_version()) {
+            utils::Logger::warn() << "State version of " << name << " changed (" << previous->second->state_version()
+                                  << " -> " << plugin->state_version() << "); starting it cold" << utils::Logger::endl;
+            transfer_state = false;
+        }
+    }
+    if (!replace_strategy(name, instance, transfer_state)) {
+        return false;
+    }
+    
+    std::lock_guard<std::mutex> lock(strategies_mutex_);
+    strategy_plugins_[name] = plugin;
+    utils::Logger::info() << "Strategy " << name << " now runs " << plugin->type_name() << " " << plugin->version()
+                          << utils::Logger::endl;
+    return true;
+}
+
+bool Engine::unload_strategy_plugin(const std::string& name) {
+    {
+        std::lock_guard<std::mutex> lock(strategies_mutex_);
+        if (!strategy_plugins_.count(name)) {
+            utils::Logger::error() << "Strategy " << name << " was not loaded from a plugin" << utils::Logger::endl;
+            return false;
+        }
+    }
+    remove_strategy(name);
+    return true;
 }
 
 void Engine::process_market_data(const MarketData& data) {
-    if (!market_data_queue_.push(data)) {
+    if (market_data_queue_.push(data, running_) == OverflowQueue<MarketData>::Outcome::REJECTED) {
         utils::Logger::error() << "Market data queue full, dropping data for " << data.symbol << utils::Logger::endl;
     }
 }
 
 void Engine::process_market_data_batch(const std::vector<MarketData>& batch) {
-    // Process batch in parallel
-    std::for_each(std::execution::par_unseq, 
-                 batch.begin(), batch.end(),
-                 [this](const MarketData& data) {
-                     this->process_market_data(data);
-                 });
+    // Sequential: the queue has a single producer and must keep tick order
+    for (const auto& data : batch) {
+        process_market_data(data);
+    }
+}
+
+bool Engine::try_process_market_data_view(std::span<const MarketData> ticks) {
+    if (ticks.empty()) {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(tick_view_push_mutex_);
+    return tick_view_queue_.push(ticks);
 }
 
 void Engine::start(int strategy_core, int execution_core) {
@@ -50,55 +345,109 @@ void Engine::start(int strategy_core, int execution_core) {
         return;
     }
     
-    running_ = true;
+    if (queues_stale_ || market_data_queue_.capacity() == 0) {
+        allocate_queues();
+    }
+    apply_overflow_policies();
+    utils::Logger::info() << "Overflow policies: market data " << to_string(market_data_queue_.policy())
+                          << ", orders " << to_string(order_queue_.policy()) << utils::Logger::endl;
     
-    // Start threads
-    auto strategy_func = [this]() { strategy_loop(); };
-    auto execution_func = [this]() { execution_loop(); };
-    
-    if (strategy_core >= 0) {
-        // Pin thread to specific core
-        strategy_thread_ = std::thread([strategy_core, strategy_func]() {
-            // Pin thread to core
-            #ifdef _WIN32
-            SetThreadAffinityMask(GetCurrentThread(), (1ULL << strategy_core));
-            #else
-            cpu_set_t cpuset;
-            CPU_ZERO(&cpuset);
-            CPU_SET(strategy_core, &cpuset);
-            pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
-            #endif
-            
-            // Run the function
-            strategy_func();
-        });
-    } else {
-        strategy_thread_ = std::thread(strategy_func);
-    }
-    
-    if (execution_core >= 0) {
-        // Pin thread to specific core
-        execution_thread_ = std::thread([execution_core, execution_func]() {
-            // Pin thread to core
-            #ifdef _WIN32
-            SetThreadAffinityMask(GetCurrentThread(), (1ULL << execution_core));
-            #else
-            cpu_set_t cpuset;
-            CPU_ZERO(&cpuset);
-            CPU_SET(execution_core, &cpuset);
-            pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
-            #endif
-            
-            // Run the function
-            execution_func();
-        });
+    if (config_.realtime) {
+        std::lock_guard<std::mutex> lock(realtime_mutex_);
+        realtime_status_ = RealtimeStatus{};
+        realtime_status_.requested = true;
+        std::string error;
+        realtime_status_.memory_locked = utils::lock_process_memory(error);
+        if (!realtime_status_.memory_locked) {
+            realtime_status_.problems.push_back(error);
+        }
+        realtime_pending_.store(2, std::memory_order_relaxed);
     } else {
-        execution_thread_ = std::thread(execution_func);
+        std::lock_guard<std::mutex> lock(realtime_mutex_);
+        realtime_status_ = RealtimeStatus{};
+    }
+    
+    running_ = true;
+    strategy_reader_active_ = true;
+    
+    // Two spinning threads on one core would starve each other's neighbours
+    const bool shared_core = strategy_core >= 0 && strategy_core == execution_core;
+    
+    // Start threads, pinned when a core is given
+    strategy_thread_ = std::thread([this, strategy_core, shared_core]() {
+        bool pinned = strategy_core >= 0 && utils::CoreAffinity::pin_current_thread(strategy_core);
+        if (strategy_core >= 0 && !pinned) {
+            utils::Logger::warn() << "Failed to pin strategy thread to core " << strategy_core << utils::Logger::endl;
+        }
+        if (config_.realtime) {
+            enter_realtime("strategy", pinned && !shared_core, &RealtimeStatus::strategy_fifo);
+        }
+        strategy_loop();
+    });
+    execution_thread_ = std::thread([this, execution_core, shared_core]() {
+        bool pinned = execution_core >= 0 && utils::CoreAffinity::pin_current_thread(execution_core);
+        if (execution_core >= 0 && !pinned) {
+            utils::Logger::warn() << "Failed to pin execution thread to core " << execution_core << utils::Logger::endl;
+        }
+        if (config_.realtime) {
+            enter_realtime("execution", pinned && !shared_core, &RealtimeStatus::execution_fifo);
+        }
+        execution_loop();
+    });
+    
+    if (config_.realtime) {
+        while (realtime_pending_.load(std::memory_order_acquire) > 0) {
+            std::this_thread::yield();
+        }
+        report_realtime_status();
     }
     
     utils::Logger::info() << "Engine started" << utils::Logger::endl;
 }
 
+void Engine::enter_realtime(const char* role, bool dedicated_core, bool RealtimeStatus::*applied) {
+    utils::prefault_stack();
+    
+    std::string error;
+    bool fifo = false;
+    if (!dedicated_core) {
+        error = std::string(role) + " thread has no core of its own; SCHED_FIFO skipped";
+    } else if (utils::set_realtime_priority(config_.realtime_priority, error)) {
+        fifo = true;
+    } else {
+        error = std::string(role) + " thread: " + error;
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(realtime_mutex_);
+        realtime_status_.*applied = fifo;
+        if (!fifo) {
+            realtime_status_.problems.push_back(error);
+        }
+    }
+    realtime_pending_.fetch_sub(1, std::memory_order_release);
+}
+
+void Engine::report_realtime_status() {
+    RealtimeStatus status = realtime_status();
+    if (status.fully_applied()) {
+        utils::Logger::info() << "Realtime mode: memory locked, strategy and execution threads SCHED_FIFO priority "
+                              << config_.realtime_priority << utils::Logger::endl;
+        return;
+    }
+    utils::Logger::warn() << "Realtime mode partially applied (memory locked: " << (status.memory_locked ? "yes" : "no")
+                          << ", strategy FIFO: " << (status.strategy_fifo ? "yes" : "no")
+                          << ", execution FIFO: " << (status.execution_fifo ? "yes" : "no") << ")" << utils::Logger::endl;
+    for (const auto& problem : status.problems) {
+        utils::Logger::warn() << "  " << problem << utils::Logger::endl;
+    }
+}
+
+RealtimeStatus Engine::realtime_status() const {
+    std::lock_guard<std::mutex> lock(realtime_mutex_);
+    return realtime_status_;
+}
+
 void Engine::stop() {
     if (!running_) {
         return;
@@ -106,6 +455,14 @@ void Engine::stop() {
     
     running_ = false;
     
+    // Release threads parked for a snapshot
+    {
+        std::lock_guard<std::mutex> lock(cv_mutex_);
+        pause_requested_ = false;
+        pause_depth_ = 0;
+    }
+    cv_.notify_all();
+    
     // Wait for threads to finish
     if (strategy_thread_.joinable()) {
         strategy_thread_.join();
@@ -115,6 +472,18 @@ void Engine::stop() {
         execution_thread_.join();
     }
     
+    // No reader left, so every retired strategy set can go
+    strategy_reader_active_ = false;
+    {
+        std::lock_guard<std::mutex> lock(strategies_mutex_);
+        reclaim_strategy_sets();
+    }
+    // Updates queued after the strategy thread's last batch
+    {
+        std::lock_guard<std::mutex> lock(strategies_mutex_);
+        apply_pending_configs();
+    }
+    
     utils::Logger::info() << "Engine stopped" << utils::Logger::endl;
 }
 
@@ -128,172 +497,148 @@ void Engine::strategy_loop() {
     // Batch processing variables
     std::vector<MarketData> data_batch;
     data_batch.reserve(config_.batch_size);
+    if (config_.realtime) {
+        // Write the whole batch buffer now rather than page by page mid-batch
+        data_batch.resize(config_.batch_size);
+        data_batch.clear();
+    }
+    
+    // Published before the tick counter moves, so readers that see the ticks see their allocations
+    const uint64_t alloc_base = utils::AllocTracker::thread_stats().allocations;
+    strategy_loop_allocations_.store(0, std::memory_order_relaxed);
+    auto publish_allocations = [this, alloc_base]() {
+        strategy_loop_allocations_.store(utils::AllocTracker::thread_stats().allocations - alloc_base,
+                                         std::memory_order_relaxed);
+    };
     
     while (running_) {
+        bool idle = true;
+        // This batch's strategies; writers wait for the epoch bump below before freeing them
+        const StrategySet& strategies = *strategies_.load();
+        
+        // One in-place batch from a tick store, read without copying
+        std::span<const MarketData> view;
+        if (tick_view_queue_.pop(view)) {
+            run_strategies(strategies, view);
+            publish_allocations();
+            ticks_processed_.fetch_add(view.size(), std::memory_order_release);
+            idle = false;
+        }
+        
         // Process market data in batches
         MarketData data;
-        while (market_data_queue_.pop(data) && data_batch.size() < config_.batch_size) {
+        while (data_batch.size() < config_.batch_size && market_data_queue_.pop(data)) {
             data_batch.push_back(data);
         }
         
         if (!data_batch.empty()) {
-            // Process the batch with each strategy
-            for (auto& strategy : strategies_) {
-                if (strategy->is_enabled()) {
-                    // Process each data point with the strategy
-                    for (const auto& d : data_batch) {
-                        // Get signals from process_tick
-                        std::vector<winter::core::Signal> signals = strategy->process_tick(d);
-                        
-                        // Process each signal
-                        for (const auto& signal : signals) {
-                            // Handle the signal
-                            if (signal.type != SignalType::NEUTRAL) {
-                                Order order;
-                                order.symbol = signal.symbol;
-                                
-                                if (signal.type == SignalType::BUY) {
-                                    order.side = OrderSide::BUY;
-                                    
-                                    // Calculate position size based on signal strength and available cash
-                                    double max_position = portfolio_.cash() * 0.1; // Max 10% of portfolio per position
-                                    int quantity = static_cast<int>(max_position / signal.price);
-                                    
-                                    if (quantity > 0) {
-                                        order.quantity = quantity;
-                                        order.price = signal.price;
-                                        
-                                        if (!order_queue_.push(order)) {
-                                            utils::Logger::error() << "Order queue full, dropping order for " << order.symbol << utils::Logger::endl;
-                                        }
-                                    }
-                                }
-                                else if (signal.type == SignalType::SELL) {
-                                    order.side = OrderSide::SELL;
-                                    
-                                    // Get current position
-                                    int position = portfolio_.get_position(signal.symbol);
-                                    
-                                    if (position > 0) {
-                                        order.quantity = position; // Sell entire position
-                                        order.price = signal.price;
-                                        
-                                        if (!order_queue_.push(order)) {
-                                            utils::Logger::error() << "Order queue full, dropping order for " << order.symbol << utils::Logger::endl;
-                                        }
-                                    }
-                                    // Don't log warnings here - we'll handle that in the execution loop
-                                }
-                            }
-                        }
-                    }
-                }
-            }
+            run_strategies(strategies, data_batch);
+            publish_allocations();
+            ticks_processed_.fetch_add(data_batch.size(), std::memory_order_release);
             
             // Clear the batch
             data_batch.clear();
+            idle = false;
         }
         
+        // Batch boundary: safe point for snapshots and parameter updates
+        if (configs_pending_.load(std::memory_order_acquire)) {
+            apply_pending_configs();
+        }
+        if (pause_requested_.load(std::memory_order_acquire)) {
+            park(strategy_parked_);
+        }
+        
+        strategy_epoch_.fetch_add(1);
+        
         // Yield to other threads if no data
-        if (data_batch.empty()) {
+        if (idle) {
             std::this_thread::yield();
         }
     }
 }
 
+void Engine::run_strategies(const StrategySet& strategies, std::span<const MarketData> ticks) {
+    if (config_.sequential_fills || event_clock_) {
+        // Tick-major order so event time only moves forward; with
+        // sequential_fills each tick's fills land before the next tick is seen
+        for (const auto& d : ticks) {
+            if (event_clock_) {
+                event_clock_->set_us(d.timestamp);
+            }
+            for (auto& strategy : strategies) {
+                if (strategy->is_enabled()) {
+                    submit_signals(*strategy, d);
+                }
+            }
+            while (config_.sequential_fills &&
+                   orders_settled() < orders_submitted_.load(std::memory_order_relaxed) &&
+                   running_) {
+                std::this_thread::yield();
+            }
+        }
+    } else {
+        // Process the batch with each strategy
+        for (auto& strategy : strategies) {
+            if (strategy->is_enabled()) {
+                // Process each data point with the strategy
+                for (const auto& d : ticks) {
+                    submit_signals(*strategy, d);
+                }
+            }
+        }
+    }
+}
+
 void Engine::execution_loop() {
     utils::Logger::info() << "Execution thread started" << utils::Logger::endl;
     
     // Batch processing for orders
     std::vector<Order> order_batch;
     order_batch.reserve(config_.batch_size);
+    if (config_.realtime) {
+        order_batch.resize(config_.batch_size);
+        order_batch.clear();
+    }
     
-    // Keep track of positions for backtesting
-    std::unordered_map<std::string, int> positions;
+    const uint64_t alloc_base = utils::AllocTracker::thread_stats().allocations;
+    execution_loop_allocations_.store(0, std::memory_order_relaxed);
     
     while (running_) {
         // Collect orders in a batch
         Order order;
-        while (order_queue_.pop(order) && order_batch.size() < config_.batch_size) {
+        while (order_batch.size() < config_.batch_size && order_queue_.pop(order)) {
             order_batch.push_back(order);
         }
         
         if (!order_batch.empty()) {
             // Process orders
             for (const auto& o : order_batch) {
-                if (o.side == OrderSide::BUY) {
-                    double cost = o.price * o.quantity;
-                    
-                    if (portfolio_.cash() >= cost) {
-                        // Execute buy order
-                        portfolio_.reduce_cash(cost);
-                        portfolio_.add_position(o.symbol, o.quantity, cost);
-                        
-                        // Update position tracking
-                        positions[o.symbol] += o.quantity;
-                        
-                        // Call order callback
-                        if (order_callback_) {
-                            order_callback_(o);
-                        }
-                    }
-                    else {
-                        utils::Logger::warn() << "Insufficient cash for order: " << o.symbol << utils::Logger::endl;
-                    }
-                }
-                else if (o.side == OrderSide::SELL) {
-                    int position = portfolio_.get_position(o.symbol);
-                    
-                    // Fix: Check if we have enough position to sell
-                    if (position >= o.quantity) {
-                        // Execute sell order
-                        double proceeds = o.price * o.quantity;
-                        portfolio_.add_cash(proceeds);
-                        portfolio_.reduce_position(o.symbol, o.quantity);
-                        
-                        // Update position tracking
-                        positions[o.symbol] -= o.quantity;
-                        
-                        // Call order callback
-                        if (order_callback_) {
-                            order_callback_(o);
-                        }
-                    }
-                    else if (position > 0) {
-                        // We have some position but not enough - sell what we have
-                        utils::Logger::info() << "Partial position for " << o.symbol 
-                                            << ": requested " << o.quantity 
-                                            << ", available " << position 
-                                            << ". Selling available position." << utils::Logger::endl;
-                        
-                        // Create a modified order with the available quantity
-                        Order modified_order = o;
-                        modified_order.quantity = position;
-                        
-                        // Execute the modified sell order
-                        double proceeds = modified_order.price * modified_order.quantity;
-                        portfolio_.add_cash(proceeds);
-                        portfolio_.reduce_position(modified_order.symbol, modified_order.quantity);
-                        
-                        // Update position tracking
-                        positions[o.symbol] = 0;
-                        
-                        // Call order callback with modified order
-                        if (order_callback_) {
-                            order_callback_(modified_order);
-                        }
-                    }
-                    else {
-                        // We have no position at all - ignore the order
-                        utils::Logger::debug() << "Ignored sell order for " << o.symbol << " - no position" << utils::Logger::endl;
-                    }
+                auto executed = execute_order(o, portfolio_);
+                if (executed && order_callback_) {
+                    order_callback_(*executed);
                 }
+                execution_loop_allocations_.store(utils::AllocTracker::thread_stats().allocations - alloc_base,
+                                                  std::memory_order_relaxed);
+                orders_filled_.fetch_add(1, std::memory_order_release);
             }
             
             // Clear the batch
             order_batch.clear();
         }
         
+        // Park only once the strategy thread has stopped producing and every order is filled
+        if (pause_requested_.load(std::memory_order_acquire) && order_queue_.empty()) {
+            bool strategy_parked;
+            {
+                std::lock_guard<std::mutex> lock(cv_mutex_);
+                strategy_parked = strategy_parked_;
+            }
+            if (strategy_parked && order_queue_.empty()) {
+                park(execution_parked_);
+            }
+        }
+        
         // Yield to other threads if no orders
         if (order_batch.empty()) {
             std::this_thread::yield();
@@ -301,4 +646,143 @@ void Engine::execution_loop() {
     }
 }
 
+void Engine::submit_signals(strategy::StrategyBase& strategy, const MarketData& data) {
+    // Get signals into the reused buffer
+    signal_buffer_.clear();
+    strategy.append_signals(data, signal_buffer_);
+    
+    // Turn each actionable signal into an order
+    for (const auto& signal : signal_buffer_) {
+        auto order = order_from_signal(signal, portfolio_);
+        if (!order) {
+            continue;
+        }
+        order->tick_seq = data.seq;
+        orders_submitted_.fetch_add(1, std::memory_order_relaxed);
+        if (order_queue_.push(*order, running_) == OverflowQueue<Order>::Outcome::REJECTED) {
+            utils::Logger::error() << "Order queue full, dropping order for " << order->symbol << utils::Logger::endl;
+        }
+    }
+}
+
+void Engine::park(bool& parked_flag) {
+    std::unique_lock<std::mutex> lock(cv_mutex_);
+    parked_flag = true;
+    cv_.notify_all();
+    cv_.wait(lock, [this]() { return !pause_requested_ || !running_; });
+    parked_flag = false;
+}
+
+void Engine::pause() {
+    if (!running_) {
+        return;
+    }
+    
+    std::unique_lock<std::mutex> lock(cv_mutex_);
+    ++pause_depth_;
+    pause_requested_ = true;
+    cv_.wait(lock, [this]() {
+        return (strategy_parked_ && execution_parked_) || !running_;
+    });
+}
+
+void Engine::resume() {
+    {
+        std::lock_guard<std::mutex> lock(cv_mutex_);
+        if (pause_depth_ > 0 && --pause_depth_ > 0) {
+            return;  // Someone else still holds the engine paused
+        }
+        pause_requested_ = false;
+    }
+    cv_.notify_all();
+}
+
+void Engine::save_snapshot(utils::BinaryWriter& out) const {
+    constexpr uint32_t SNAPSHOT_VERSION = 1;
+    
+    out.write(SNAPSHOT_VERSION);
+    out.write<uint64_t>(ticks_processed_.load());
+    
+    utils::BinaryWriter portfolio_state;
+    portfolio_.serialize(portfolio_state);
+    out.write_blob(portfolio_state);
+    
+    std::lock_guard<std::mutex> lock(strategies_mutex_);
+    const auto& strategies = current_strategies();
+    out.write<uint32_t>(static_cast<uint32_t>(strategies.size()));
+    for (const auto& strategy : strategies) {
+        utils::BinaryWriter strategy_state;
+        strategy->serialize(strategy_state);
+        out.write_string(strategy->name());
+        out.write_blob(strategy_state);
+    }
+}
+
+bool Engine::restore_snapshot(utils::BinaryReader& in) {
+    if (running_) {
+        utils::Logger::error() << "Cannot restore a snapshot while the engine is running" << utils::Logger::endl;
+        return false;
+    }
+    
+    uint32_t version = in.read<uint32_t>();
+    if (!in.ok() || version != 1) {
+        utils::Logger::error() << "Unsupported snapshot version: " << version << utils::Logger::endl;
+        return false;
+    }
+    
+    uint64_t ticks = in.read<uint64_t>();
+    
+    // Nothing changes until the whole snapshot has decoded: the portfolio is
+    // read into a temporary, and strategies (which cannot be copied) keep
+    // their current state to roll back to
+    Portfolio portfolio;
+    utils::BinaryReader portfolio_state = in.read_blob();
+    if (!portfolio.deserialize(portfolio_state)) {
+        utils::Logger::error() << "Corrupt portfolio state in snapshot" << utils::Logger::endl;
+        return false;
+    }
+    portfolio.set_clock(clock_);
+    
+    std::lock_guard<std::mutex> lock(strategies_mutex_);
+    const auto& strategies = current_strategies();
+    std::vector<std::pair<strategy::StrategyPtr, utils::BinaryWriter>> previous_states;
+    auto roll_back = [&previous_states]() {
+        for (auto& [strategy, state] : previous_states) {
+            utils::BinaryReader reader(state.buffer());
+            strategy->deserialize(reader);
+        }
+    };
+    
+    uint32_t strategy_count = in.read<uint32_t>();
+    for (uint32_t i = 0; i < strategy_count && in.ok(); ++i) {
+        std::string name = in.read_string();
+        utils::BinaryReader strategy_state = in.read_blob();
+        
+        auto it = std::find_if(strategies.begin(), strategies.end(),
+                               [&name](const auto& s) { return s->name() == name; });
+        if (it == strategies.end()) {
+            utils::Logger::warn() << "Snapshot contains state for unknown strategy: " << name << utils::Logger::endl;
+            continue;
+        }
+        previous_states.emplace_back(*it, utils::BinaryWriter());
+        (*it)->serialize(previous_states.back().second);
+        if (!(*it)->deserialize(strategy_state)) {
+            utils::Logger::error() << "Corrupt state for strategy: " << name << utils::Logger::endl;
+            roll_back();
+            return false;
+        }
+    }
+    
+    if (!in.ok()) {
+        utils::Logger::error() << "Truncated snapshot" << utils::Logger::endl;
+        roll_back();
+        return false;
+    }
+    
+    portfolio_ = std::move(portfolio);
+    ticks_processed_ = ticks;
+    utils::Logger::info() << "Restored snapshot at tick offset " << ticks << utils::Logger::endl;
+    return true;
+}
+
 } // namespace winter::core
@@ -0,0 +1,75 @@
+#include <winter/core/execution.hpp>
+#include <winter/utils/logger.hpp>
+
+namespace winter::core {
+
+std::optional<Order> order_from_signal(const Signal& signal, const Portfolio& portfolio) {
+    if (signal.price <= 0.0) {
+        return std::nullopt;
+    }
+
+    Order order;
+    order.symbol = signal.symbol;
+    order.price = signal.price;
+
+    if (signal.type == SignalType::BUY) {
+        // Calculate position size based on available cash
+        double max_position = portfolio.cash() * MAX_POSITION_FRACTION;
+        int quantity = static_cast<int>(max_position / signal.price);
+        if (quantity <= 0) {
+            return std::nullopt;
+        }
+        order.side = OrderSide::BUY;
+        order.quantity = quantity;
+        return order;
+    }
+
+    if (signal.type == SignalType::SELL) {
+        int position = portfolio.get_position(signal.symbol);
+        if (position <= 0) {
+            return std::nullopt;
+        }
+        order.side = OrderSide::SELL;
+        order.quantity = position; // Sell entire position
+        return order;
+    }
+
+    return std::nullopt;
+}
+
+std::optional<Order> execute_order(const Order& order, Portfolio& portfolio) {
+    if (order.side == OrderSide::BUY) {
+        double cost = order.price * order.quantity;
+        if (portfolio.cash() < cost) {
+            utils::Logger::warn() << "Insufficient cash for order: " << order.symbol << utils::Logger::endl;
+            return std::nullopt;
+        }
+
+        portfolio.reduce_cash(cost);
+        portfolio.add_position(order.symbol, order.quantity, cost);
+        return order;
+    }
+
+    int position = portfolio.get_position(order.symbol);
+    if (position <= 0) {
+        // We have no position at all - ignore the order
+        utils::Logger::debug() << "Ignored sell order for " << order.symbol << " - no position" << utils::Logger::endl;
+        return std::nullopt;
+    }
+
+    Order executed = order;
+    if (position < order.quantity) {
+        // We have some position but not enough - sell what we have
+        utils::Logger::info() << "Partial position for " << order.symbol
+                              << ": requested " << order.quantity
+                              << ", available " << position
+                              << ". Selling available position." << utils::Logger::endl;
+        executed.quantity = position;
+    }
+
+    portfolio.add_cash(executed.price * executed.quantity);
+    portfolio.reduce_position(executed.symbol, executed.quantity);
+    return executed;
+}
+
+} // namespace winter::core
@@ -0,0 +1,194 @@
+#include <winter/core/journal.hpp>
+#include <winter/utils/logger.hpp>
+#include <cstring>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+namespace winter::core {
+
+namespace {
+
+constexpr char JOURNAL_MAGIC[4] = {'W', 'J', 'N', 'L'};
+constexpr uint32_t JOURNAL_VERSION = 2;
+
+// Flush early once this much is buffered
+constexpr size_t FLUSH_THRESHOLD = 1 << 20;
+
+} // namespace
+
+// File layout: magic, version, then records of u32 body size followed by the
+// body (type, arrival_ns, payload)
+
+JournalWriter::JournalWriter(const std::string& path, std::chrono::milliseconds flush_interval)
+    : flush_interval_(flush_interval) {
+    file_ = std::fopen(path.c_str(), "wb");
+    if (!file_) {
+        utils::Logger::error() << "Failed to open journal: " << path << utils::Logger::endl;
+        return;
+    }
+
+    std::fwrite(JOURNAL_MAGIC, 1, sizeof(JOURNAL_MAGIC), file_);
+    std::fwrite(&JOURNAL_VERSION, 1, sizeof(JOURNAL_VERSION), file_);
+
+    running_ = true;
+    thread_ = std::thread(&JournalWriter::run, this);
+}
+
+JournalWriter::~JournalWriter() {
+    close();
+}
+
+void JournalWriter::append_tick(const MarketData& data, int64_t arrival_ns) {
+    std::lock_guard<std::mutex> lock(buffer_mutex_);
+    utils::BinaryWriter& out = active_;
+    size_t start = out.size();
+    out.write<uint32_t>(0);
+    out.write(JournalEventType::TICK);
+    out.write(arrival_ns);
+    out.write_string(data.symbol);
+    out.write(data.price);
+    out.write<int32_t>(data.volume);
+    out.write<int64_t>(data.timestamp);
+    out.write(data.seq);
+    out.patch<uint32_t>(start, static_cast<uint32_t>(out.size() - start - sizeof(uint32_t)));
+    ++events_buffered_;
+    if (out.size() >= FLUSH_THRESHOLD) {
+        cv_.notify_one();
+    }
+}
+
+void JournalWriter::append_fill(const Order& order, int64_t arrival_ns) {
+    std::lock_guard<std::mutex> lock(buffer_mutex_);
+    utils::BinaryWriter& out = active_;
+    size_t start = out.size();
+    out.write<uint32_t>(0);
+    out.write(JournalEventType::FILL);
+    out.write(arrival_ns);
+    out.write(order.tick_seq);
+    out.write_string(order.symbol);
+    out.write<uint8_t>(order.side == OrderSide::BUY ? 0 : 1);
+    out.write<int32_t>(order.quantity);
+    out.write(order.price);
+    out.patch<uint32_t>(start, static_cast<uint32_t>(out.size() - start - sizeof(uint32_t)));
+    ++events_buffered_;
+}
+
+void JournalWriter::run() {
+    std::unique_lock<std::mutex> lock(buffer_mutex_);
+    while (running_) {
+        cv_.wait_for(lock, flush_interval_, [this]() {
+            return !running_ || active_.size() >= FLUSH_THRESHOLD;
+        });
+        lock.unlock();
+        flush();
+        lock.lock();
+    }
+}
+
+void JournalWriter::flush() {
+    uint64_t events = 0;
+    {
+        // Swap so appends never wait on the disk
+        std::lock_guard<std::mutex> lock(buffer_mutex_);
+        std::swap(active_, flushing_);
+        events = events_buffered_;
+        events_buffered_ = 0;
+    }
+    if (flushing_.size() == 0 || !file_) {
+        return;
+    }
+
+    if (std::fwrite(flushing_.data(), 1, flushing_.size(), file_) != flushing_.size()) {
+        utils::Logger::error() << "Journal write failed" << utils::Logger::endl;
+    }
+    std::fflush(file_);
+#ifndef _WIN32
+    ::fdatasync(fileno(file_));
+#endif
+    flushing_.clear();
+    events_written_ += events;
+}
+
+void JournalWriter::close() {
+    if (running_) {
+        running_ = false;
+        cv_.notify_all();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+    if (file_) {
+        flush();
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+}
+
+JournalReader::JournalReader(const std::string& path) {
+    file_ = std::fopen(path.c_str(), "rb");
+    if (!file_) {
+        utils::Logger::error() << "Failed to open journal: " << path << utils::Logger::endl;
+        return;
+    }
+
+    char magic[4] = {};
+    uint32_t version = 0;
+    if (std::fread(magic, 1, sizeof(magic), file_) != sizeof(magic) ||
+        std::fread(&version, 1, sizeof(version), file_) != sizeof(version) ||
+        std::memcmp(magic, JOURNAL_MAGIC, sizeof(magic)) != 0 || version != JOURNAL_VERSION) {
+        utils::Logger::error() << "Not a valid journal: " << path << utils::Logger::endl;
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+}
+
+JournalReader::~JournalReader() {
+    if (file_) {
+        std::fclose(file_);
+    }
+}
+
+bool JournalReader::next(JournalEvent& event) {
+    if (!file_) {
+        return false;
+    }
+
+    uint32_t body_size = 0;
+    if (std::fread(&body_size, 1, sizeof(body_size), file_) != sizeof(body_size)) {
+        return false;
+    }
+    record_.resize(body_size);
+    if (std::fread(record_.data(), 1, body_size, file_) != body_size) {
+        utils::Logger::warn() << "Journal ends with a torn record; ignoring it" << utils::Logger::endl;
+        return false;
+    }
+
+    utils::BinaryReader in(record_);
+    event.type = in.read<JournalEventType>();
+    event.arrival_ns = in.read<int64_t>();
+    if (event.type == JournalEventType::TICK) {
+        event.tick.symbol = in.read_string();
+        event.tick.price = in.read<double>();
+        event.tick.volume = in.read<int32_t>();
+        event.tick.timestamp = in.read<int64_t>();
+        event.tick.seq = in.read<uint64_t>();
+    } else if (event.type == JournalEventType::FILL) {
+        event.fill.tick_seq = in.read<uint64_t>();
+        event.fill.symbol = in.read_string();
+        event.fill.side = in.read<uint8_t>() == 0 ? OrderSide::BUY : OrderSide::SELL;
+        event.fill.quantity = in.read<int32_t>();
+        event.fill.price = in.read<double>();
+    } else {
+        utils::Logger::error() << "Unknown journal record type" << utils::Logger::endl;
+        return false;
+    }
+
+    if (!in.ok()) {
+        utils::Logger::error() << "Corrupt journal record" << utils::Logger::endl;
+        return false;
+    }
+    return true;
+}
+
+} // namespace winter::core
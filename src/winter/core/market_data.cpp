@@ -1,17 +1,15 @@
 #include <winter/core/market_data.hpp>
-#include <chrono>
+#include <winter/core/clock.hpp>
 
 namespace winter::core {
 
 MarketData::MarketData()
-    : price(0.0), volume(0), timestamp(0) {}
+    : price(0.0), volume(0), timestamp(0), seq(0) {}
 
 MarketData::MarketData(const std::string& sym, double p, int vol)
-    : symbol(sym), price(p), volume(vol) {
+    : symbol(sym), price(p), volume(vol), seq(0) {
     // Set timestamp to current time
-    timestamp = std::chrono::duration_cast<std::chrono::microseconds>(
-        std::chrono::high_resolution_clock::now().time_since_epoch()
-    ).count();
+    timestamp = real_clock()->now_us();
 }
 
 } // namespace winter::core
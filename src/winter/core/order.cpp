@@ -5,10 +5,10 @@
 namespace winter::core {
 
 Order::Order()
-    : side(OrderSide::BUY), quantity(0), price(0.0) {}
+    : side(OrderSide::BUY), quantity(0), price(0.0), tick_seq(0) {}
 
 Order::Order(const std::string& sym, OrderSide s, int qty, double p)
-    : symbol(sym), side(s), quantity(qty), price(p) {}
+    : symbol(sym), side(s), quantity(qty), price(p), tick_seq(0) {}
 
 double Order::total_value() const {
     return price * quantity;
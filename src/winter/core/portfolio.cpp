@@ -1,11 +1,10 @@
 #include <winter/core/portfolio.hpp>
 #include <winter/utils/logger.hpp>
 #include <algorithm>
-#include <ctime>
 
 namespace winter::core {
 
-Portfolio::Portfolio() : cash_(0.0), trade_count_(0) {}
+Portfolio::Portfolio() : cash_(0.0), trade_count_(0), clock_(real_clock()) {}
 
 void Portfolio::set_cash(double amount) {
     cash_ = amount;
@@ -65,12 +64,7 @@ void Portfolio::add_position(const std::string& symbol, int quantity, double cos
     trade.cost = cost;
     trade.profit = 0.0;
     
-    // Get current time
-    std::time_t now = std::time(nullptr);
-    std::tm* tm = std::localtime(&now);
-    char time_buffer[20];
-    std::strftime(time_buffer, sizeof(time_buffer), "%H:%M:%S", tm);
-    trade.timestamp = time_buffer;
+    trade.timestamp = format_time_of_day(clock_->now_ns());
     
     trades_.push_back(trade);
     
@@ -80,7 +74,7 @@ void Portfolio::add_position(const std::string& symbol, int quantity, double cos
 
 void Portfolio::reduce_position(const std::string& symbol, int quantity) {
     auto it = positions_.find(symbol);
-    if (it != positions_.end()) {
+    if (it != positions_.end() && it->second.quantity > 0) {
         // Calculate proportion of position being sold
         double proportion = static_cast<double>(quantity) / it->second.quantity;
         double cost_basis = it->second.cost * proportion;
@@ -95,12 +89,7 @@ void Portfolio::reduce_position(const std::string& symbol, int quantity) {
         trade.cost = cost_basis;
         trade.profit = (trade.price * quantity) - cost_basis;
         
-        // Get current time
-        std::time_t now = std::time(nullptr);
-        std::tm* tm = std::localtime(&now);
-        char time_buffer[20];
-        std::strftime(time_buffer, sizeof(time_buffer), "%H:%M:%S", tm);
-        trade.timestamp = time_buffer;
+        trade.timestamp = format_time_of_day(clock_->now_ns());
         
         trades_.push_back(trade);
         
@@ -108,9 +97,10 @@ void Portfolio::reduce_position(const std::string& symbol, int quantity) {
         it->second.quantity -= quantity;
         it->second.cost -= cost_basis;
         
-        // Remove position if quantity is zero
+        // Keep flat positions in the map so re-entering the symbol does not allocate
         if (it->second.quantity <= 0) {
-            positions_.erase(it);
+            it->second.quantity = 0;
+            it->second.cost = 0.0;
         }
     } else {
         utils::Logger::warn() << "Insufficient position for order: " << symbol << utils::Logger::endl;
@@ -135,4 +125,59 @@ int Portfolio::trade_count() const {
     return trade_count_;
 }
 
+void Portfolio::serialize(utils::BinaryWriter& out) const {
+    out.write(cash_);
+    out.write<int32_t>(trade_count_);
+    
+    // Flat positions are not part of the state
+    uint64_t open_positions = std::count_if(positions_.begin(), positions_.end(),
+                                            [](const auto& entry) { return entry.second.quantity != 0; });
+    out.write<uint64_t>(open_positions);
+    for (const auto& [symbol, position] : positions_) {
+        if (position.quantity != 0) {
+            out.write_string(symbol);
+            out.write(position);
+        }
+    }
+    
+    out.write<uint64_t>(trades_.size());
+    for (const auto& trade : trades_) {
+        out.write_string(trade.symbol);
+        out.write_string(trade.side);
+        out.write<int32_t>(trade.quantity);
+        out.write(trade.price);
+        out.write(trade.cost);
+        out.write(trade.profit);
+        out.write_string(trade.timestamp);
+    }
+}
+
+bool Portfolio::deserialize(utils::BinaryReader& in) {
+    cash_ = in.read<double>();
+    trade_count_ = in.read<int32_t>();
+    
+    positions_.clear();
+    uint64_t position_count = in.read<uint64_t>();
+    for (uint64_t i = 0; i < position_count && in.ok(); ++i) {
+        std::string symbol = in.read_string();
+        positions_[symbol] = in.read<Position>();
+    }
+    
+    trades_.clear();
+    uint64_t trade_count = in.read<uint64_t>();
+    for (uint64_t i = 0; i < trade_count && in.ok(); ++i) {
+        Trade trade;
+        trade.symbol = in.read_string();
+        trade.side = in.read_string();
+        trade.quantity = in.read<int32_t>();
+        trade.price = in.read<double>();
+        trade.cost = in.read<double>();
+        trade.profit = in.read<double>();
+        trade.timestamp = in.read_string();
+        trades_.push_back(std::move(trade));
+    }
+    
+    return in.ok();
+}
+
 } // namespace winter::core
@@ -0,0 +1,135 @@
+#include <winter/runtime/execution.hpp>
+#include <cmath>
+
+namespace winter::runtime {
+
+namespace {
+
+// Running sums are rebuilt from the window this often to shed rounding drift
+constexpr uint32_t RESYNC_INTERVAL = 1024;
+
+} // namespace
+
+double ZScoreTracker::update(const std::string& symbol, double price) {
+    auto it = symbols_.find(symbol);
+    if (it == symbols_.end()) {
+        it = symbols_.try_emplace(symbol, window_, price).first;
+    }
+    State& state = it->second;
+
+    double value = price - state.anchor;
+    if (state.prices.full()) {
+        double oldest = state.prices.front();
+        state.sum -= oldest;
+        state.sum_sq -= oldest * oldest;
+    }
+    state.prices.push_back(value);
+    state.sum += value;
+    state.sum_sq += value * value;
+
+    if (++state.updates >= RESYNC_INTERVAL) {
+        state.updates = 0;
+        state.sum = 0.0;
+        state.sum_sq = 0.0;
+        for (double v : state.prices) {
+            state.sum += v;
+            state.sum_sq += v * v;
+        }
+    }
+
+    const double n = static_cast<double>(state.prices.size());
+    state.z_score = 0.0;
+    if (state.prices.size() >= 2) {
+        double mean = state.sum / n;
+        double mean_sq = state.sum_sq / n;
+        double variance = mean_sq - mean * mean;
+        // A flat window leaves only cancellation residue
+        if (variance > 1e-12 * mean_sq) {
+            state.z_score = (value - mean) / std::sqrt(variance);
+        }
+    }
+    return state.z_score;
+}
+
+double ZScoreTracker::last(const std::string& symbol) const {
+    auto it = symbols_.find(symbol);
+    return it == symbols_.end() ? 0.0 : it->second.z_score;
+}
+
+const TradeRecord& TradeLedger::record_fill(const winter::core::Order& order, std::string timestamp,
+                                            int64_t event_us, double z_score) {
+    TradeRecord record;
+    record.timestamp = std::move(timestamp);
+    record.event_us = event_us;
+    record.symbol = order.symbol;
+    record.quantity = order.quantity;
+    record.price = order.price;
+    record.value = order.quantity * order.price;
+    record.z_score = z_score;
+
+    Position& position = positions_[order.symbol];
+    if (order.side == winter::core::OrderSide::BUY) {
+        record.side = "BUY";
+        position.quantity += order.quantity;
+        position.total_cost += record.value;
+    } else {
+        record.side = "SELL";
+        if (position.quantity > 0) {
+            double average_cost = position.total_cost / position.quantity;
+            record.profit_loss = order.quantity * (order.price - average_cost);
+            position.quantity -= order.quantity;
+            position.total_cost -= order.quantity * average_cost;
+            if (position.quantity <= 0) {
+                position = Position{};
+            }
+        }
+        realized_pnl_ += record.profit_loss;
+    }
+
+    trades_.push_back(std::move(record));
+    return trades_.back();
+}
+
+void TradeLedger::clear() {
+    positions_.clear();
+    trades_.clear();
+    realized_pnl_ = 0.0;
+}
+
+std::vector<winter::core::Trade> closed_trades(const std::vector<TradeRecord>& trades) {
+    std::vector<winter::core::Trade> closed;
+    for (const auto& record : trades) {
+        if (record.side != "SELL") {
+            continue;
+        }
+        winter::core::Trade trade;
+        trade.symbol = record.symbol;
+        trade.side = record.side;
+        trade.quantity = record.quantity;
+        trade.price = record.price;
+        trade.cost = record.value - record.profit_loss;
+        trade.profit = record.profit_loss;
+        trade.timestamp = record.timestamp;
+        closed.push_back(std::move(trade));
+    }
+    return closed;
+}
+
+void annotate_z_scores(std::vector<TradeRecord>& trades, const std::vector<winter::core::MarketData>& ticks,
+                       size_t window) {
+    ZScoreTracker tracker(window);
+    size_t next = 0;
+    for (const auto& tick : ticks) {
+        // Trades stamped before this tick saw the tracker as it is now
+        while (next < trades.size() && trades[next].event_us < tick.timestamp) {
+            trades[next].z_score = tracker.last(trades[next].symbol);
+            ++next;
+        }
+        tracker.update(tick.symbol, tick.price);
+    }
+    for (; next < trades.size(); ++next) {
+        trades[next].z_score = tracker.last(trades[next].symbol);
+    }
+}
+
+} // namespace winter::runtime
@@ -0,0 +1,83 @@
+#include <winter/runtime/ingest.hpp>
+#include <winter/backtest/csv_loader.hpp>
+#include <charconv>
+#include <iterator>
+
+namespace winter::runtime {
+
+namespace {
+
+// Raw text of a top-level field's value, without quotes; empty if absent
+std::string_view field_value(std::string_view json, std::string_view key) {
+    size_t pos = 0;
+    while ((pos = json.find(key, pos)) != std::string_view::npos) {
+        size_t end = pos + key.size();
+        bool quoted_key = pos > 0 && json[pos - 1] == '"' && end < json.size() && json[end] == '"';
+        pos = end;
+        if (!quoted_key) {
+            continue;
+        }
+        size_t colon = json.find_first_not_of(" \t", end + 1);
+        if (colon == std::string_view::npos || json[colon] != ':') {
+            continue;
+        }
+        size_t begin = json.find_first_not_of(" \t\"", colon + 1);
+        if (begin == std::string_view::npos) {
+            return {};
+        }
+        size_t stop = json.find_first_of("\",}", begin);
+        std::string_view value = json.substr(begin, stop == std::string_view::npos ? stop : stop - begin);
+        while (!value.empty() && (value.back() == ' ' || value.back() == '\t')) {
+            value.remove_suffix(1);
+        }
+        return value;
+    }
+    return {};
+}
+
+template<typename T>
+bool parse_number(std::string_view text, T& out) {
+    auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), out);
+    return ec == std::errc() && end == text.data() + text.size();
+}
+
+} // namespace
+
+bool decode_json_tick(std::string_view json, winter::core::MarketData& data) {
+    std::string_view symbol = field_value(json, "Symbol");
+    double price = 0.0;
+    int volume = 0;
+    if (symbol.empty() || !parse_number(field_value(json, "Price"), price) ||
+        !parse_number(field_value(json, "Size"), volume)) {
+        return false;
+    }
+    data.symbol.assign(symbol.data(), symbol.size());
+    data.price = price;
+    data.volume = volume;
+    return true;
+}
+
+bool load_ticks(const std::vector<std::string>& files, std::vector<winter::core::MarketData>& ticks) {
+    for (const auto& file : files) {
+        std::vector<winter::core::MarketData> part;
+        if (!winter::backtest::load_market_data(file, part)) {
+            return false;
+        }
+        if (ticks.empty()) {
+            ticks = std::move(part);
+            continue;
+        }
+        if (!part.empty() && part.front().timestamp <= ticks.back().timestamp) {
+            // Whole days, so times of day and gaps within the file survive
+            constexpr int64_t day = winter::backtest::TAPE_DAY_US;
+            int64_t shift = (ticks.back().timestamp - part.front().timestamp) / day * day + day;
+            for (auto& tick : part) {
+                tick.timestamp += shift;
+            }
+        }
+        ticks.insert(ticks.end(), std::make_move_iterator(part.begin()), std::make_move_iterator(part.end()));
+    }
+    return true;
+}
+
+} // namespace winter::runtime
@@ -0,0 +1,538 @@
+#include <winter/runtime/reporting.hpp>
+#include <winter/backtest/report_writer.hpp>
+#include <winter/utils/logger.hpp>
+#include <fstream>
+#include <iomanip>
+#include <unordered_map>
+
+namespace winter::runtime {
+
+namespace {
+
+// Quotes a CSV field if it contains separators, quotes or newlines
+std::string escape_csv_field(const std::string& field) {
+    if (field.find_first_of(",\"\n") == std::string::npos) {
+        return field;
+    }
+    std::string escaped = "\"";
+    for (char c : field) {
+        if (c == '"') {
+            escaped += '"';
+        }
+        escaped += c;
+    }
+    return escaped + "\"";
+}
+
+} // namespace
+
+bool write_trade_journal(const std::string& csv_file, const std::vector<TradeRecord>& trades,
+                         double initial_balance, double final_balance) {
+    std::ofstream file(csv_file);
+    if (!file.is_open()) {
+        winter::utils::Logger::error() << "Could not open CSV file for writing: " << csv_file << winter::utils::Logger::endl;
+        return false;
+    }
+
+    file << "Time,Symbol,Side,Quantity,Price,Value,P&L,Z-Score\n";
+    for (const auto& trade : trades) {
+        file << escape_csv_field(trade.timestamp) << ","
+             << escape_csv_field(trade.symbol) << ","
+             << escape_csv_field(trade.side) << ","
+             << trade.quantity << ","
+             << std::fixed << std::setprecision(2) << trade.price << ","
+             << trade.value << ",";
+        if (trade.side == "SELL") {
+            file << trade.profit_loss;
+        }
+        file << "," << std::setprecision(4) << trade.z_score << "\n";
+    }
+
+    // Summary section after an empty row
+    file << "\nSummary\n" << std::fixed << std::setprecision(2)
+         << "Initial Balance:," << initial_balance << "\n"
+         << "Final Balance:," << final_balance << "\n"
+         << "P&L:," << (final_balance - initial_balance) << "\n";
+
+    file.close();
+    winter::utils::Logger::info() << "Trade data exported to " << csv_file << winter::utils::Logger::endl;
+    return static_cast<bool>(file);
+}
+
+bool write_trade_graphs(const std::string& output_file, const std::vector<TradeRecord>& trades,
+                        double initial_balance, double final_balance) {
+    std::ofstream html_file(output_file);
+    if (!html_file.is_open()) {
+        winter::utils::Logger::error() << "Failed to create trade result graphs: " << output_file << winter::utils::Logger::endl;
+        return false;
+    }
+    
+    // Generate equity curve data
+    std::vector<double> equity_curve;
+    equity_curve.reserve(trades.size() + 1);
+    equity_curve.push_back(initial_balance);
+    
+    // Indices of closing trades for the P&L chart
+    std::vector<size_t> sell_indices;
+    
+    // Generate cumulative P&L by symbol
+    std::unordered_map<std::string, double> symbol_pnl;
+    std::unordered_map<std::string, int> symbol_trade_count;
+    
+    double equity = initial_balance;
+    for (size_t i = 0; i < trades.size(); ++i) {
+        const auto& trade = trades[i];
+        if (trade.side == "BUY") {
+            equity -= trade.value;
+        } else if (trade.side == "SELL") {
+            equity += trade.value;
+            sell_indices.push_back(i);
+            
+            // Track P&L by symbol
+            symbol_pnl[trade.symbol] += trade.profit_loss;
+            symbol_trade_count[trade.symbol]++;
+        }
+        
+        equity_curve.push_back(equity);
+    }
+    
+    // Generate symbol P&L data for bar chart
+    std::vector<std::string> symbol_names;
+    std::vector<double> symbol_profits;
+    std::vector<int> symbol_counts;
+    
+    for (const auto& [symbol, pnl] : symbol_pnl) {
+        symbol_names.push_back(symbol);
+        symbol_profits.push_back(pnl);
+        symbol_counts.push_back(symbol_trade_count[symbol]);
+    }
+    
+    // Stream chart data into the page's data file; long series are LTTB-downsampled
+    winter::backtest::ReportWriter report_data(output_file);
+    if (!report_data.is_open()) {
+        winter::utils::Logger::error() << "Failed to create report data file: " << report_data.data_file() << winter::utils::Logger::endl;
+        return false;
+    }
+    auto index_x = [](size_t i) { return static_cast<double>(i); };
+    
+    report_data.series("equity", equity_curve.size(), index_x,
+                       [&](size_t i) { return equity_curve[i]; });
+    report_data.series("pnl", sell_indices.size(), index_x,
+                       [&](size_t i) { return trades[sell_indices[i]].profit_loss; },
+                       [&](size_t i) -> std::string_view { return trades[sell_indices[i]].symbol; });
+    report_data.series("z_score", trades.size(), index_x,
+                       [&](size_t i) { return trades[i].z_score; },
+                       [&](size_t i) -> std::string_view { return trades[i].symbol; });
+    report_data.categories("symbol_pnl", symbol_names.size(),
+                           [&](size_t i) -> std::string_view { return symbol_names[i]; },
+                           [&](size_t i) { return symbol_profits[i]; });
+    report_data.categories("symbol_trades", symbol_names.size(),
+                           [&](size_t i) -> std::string_view { return symbol_names[i]; },
+                           [&](size_t i) { return symbol_counts[i]; });
+    report_data.close();
+    
+    // Write HTML with embedded Chart.js
+    html_file << R"(
+<!DOCTYPE html>
+<html>
+<head>
+    <title>Winter Trade Simulation Results</title>
+    <script src="https://cdn.jsdelivr.net/npm/chart.js"></script>
+    <script src=")" << report_data.data_script_src() << R"("></script>
+    <style>
+        body {
+            font-family: Arial, sans-serif;
+            margin: 20px;
+            background-color: #f5f5f5;
+        }
+        .container {
+            max-width: 1200px;
+            margin: 0 auto;
+            background-color: white;
+            padding: 20px;
+            border-radius: 5px;
+            box-shadow: 0 0 10px rgba(0,0,0,0.1);
+        }
+        .header {
+            text-align: center;
+            margin-bottom: 30px;
+        }
+        .chart-container {
+            height: 400px;
+            margin-bottom: 30px;
+        }
+        .metrics-container {
+            display: flex;
+            flex-wrap: wrap;
+            justify-content: space-between;
+            margin-bottom: 30px;
+        }
+        .metric-box {
+            width: 30%;
+            margin-bottom: 20px;
+            padding: 15px;
+            border-radius: 5px;
+            background-color: #f9f9f9;
+            box-shadow: 0 0 5px rgba(0,0,0,0.05);
+        }
+        .metric-title {
+            font-weight: bold;
+            margin-bottom: 5px;
+            color: #333;
+        }
+        .metric-value {
+            font-size: 20px;
+            color: #0066cc;
+        }
+        .positive {
+            color: #00aa00;
+        }
+        .negative {
+            color: #cc0000;
+        }
+        .chart-row {
+            display: flex;
+            margin-bottom: 30px;
+        }
+        .chart-col {
+            flex: 1;
+            padding: 10px;
+        }
+    </style>
+</head>
+<body>
+    <div class="container">
+        <div class="header">
+            <h1>Winter Trade Simulation Results</h1>
+            <p>Real Market Simulation Report</p>
+        </div>
+        
+        <div class="metrics-container">
+            <div class="metric-box">
+                <div class="metric-title">Initial Capital</div>
+                <div class="metric-value">$)" << std::fixed << std::setprecision(2) << initial_balance << R"(</div>
+            </div>
+            <div class="metric-box">
+                <div class="metric-title">Final Capital</div>
+                <div class="metric-value">$)" << std::fixed << std::setprecision(2) << final_balance << R"(</div>
+            </div>
+            <div class="metric-box">
+                <div class="metric-title">Total Return</div>
+                <div class="metric-value )" << (final_balance > initial_balance ? "positive" : "negative") << R"(">
+                    $)" << std::fixed << std::setprecision(2) << (final_balance - initial_balance) << 
+                    " (" << std::setprecision(2) << ((final_balance - initial_balance) / initial_balance * 100) << R"(%)
+                </div>
+            </div>
+            <div class="metric-box">
+                <div class="metric-title">Total Trades</div>
+                <div class="metric-value">)" << trades.size() << R"(</div>
+            </div>
+            <div class="metric-box">
+                <div class="metric-title">Symbols Traded</div>
+                <div class="metric-value">)" << symbol_names.size() << R"(</div>
+            </div>
+        </div>
+        
+        <div class="chart-container">
+            <canvas id="equityChart"></canvas>
+        </div>
+        
+        <div class="chart-row">
+            <div class="chart-col">
+                <div class="chart-container">
+                    <canvas id="pnlChart"></canvas>
+                </div>
+            </div>
+            <div class="chart-col">
+                <div class="chart-container">
+                    <canvas id="zScoreChart"></canvas>
+                </div>
+            </div>
+        </div>
+        
+        <div class="chart-row">
+            <div class="chart-col">
+                <div class="chart-container">
+                    <canvas id="symbolPnlChart"></canvas>
+                </div>
+            </div>
+            <div class="chart-col">
+                <div class="chart-container">
+                    <canvas id="symbolCountChart"></canvas>
+                </div>
+            </div>
+        </div>
+    </div>
+
+    <script>
+        const report = window.WINTER_REPORT;
+        
+        // Equity Curve Chart
+        const ctxEquity = document.getElementById("equityChart").getContext("2d");
+        const equityChart = new Chart(ctxEquity, {
+            type: "line",
+            data: {
+                labels: report.equity.x,
+                datasets: [{
+                    label: "Equity Curve",
+                    data: report.equity.y,
+                    borderColor: "#0066cc",
+                    backgroundColor: 'rgba(0, 102, 204, 0.1)',
+                    borderWidth: 2,
+                    fill: true,
+                    tension: 0.1
+                }]
+            },
+            options: {
+                responsive: true,
+                maintainAspectRatio: false,
+                plugins: {
+                    title: {
+                        display: true,
+                        text: "Equity Curve"
+                    },
+                    tooltip: {
+                        mode: "index",
+                        intersect: false,
+                        callbacks: {
+                            label: function(context) {
+                                return "Equity: $" + context.raw.toFixed(2);
+                            }
+                        }
+                    }
+                },
+                scales: {
+                    y: {
+                        beginAtZero: false,
+                        title: {
+                            display: true,
+                            text: 'Equity ($)'
+                        }
+                    },
+                    x: {
+                        title: {
+                            display: true,
+                            text: "Trade #"
+                        }
+                    }
+                }
+            }
+        });
+        
+        // Trade P&L Chart
+        const ctxPnl = document.getElementById("pnlChart").getContext("2d");
+        const pnlChart = new Chart(ctxPnl, {
+            type: "bar",
+            data: {
+                labels: report.pnl.x,
+                datasets: [{
+                    label: "Trade P&L",
+                    data: report.pnl.y,
+                    backgroundColor: function(context) {
+                        const value = context.dataset.data[context.dataIndex];
+                        return value >= 0 ? 'rgba(0, 170, 0, 0.7)' : 'rgba(204, 0, 0, 0.7)';
+                    },
+                    borderColor: function(context) {
+                        const value = context.dataset.data[context.dataIndex];
+                        return value >= 0 ? 'rgba(0, 170, 0, 1)' : 'rgba(204, 0, 0, 1)';
+                    },
+                    borderWidth: 1
+                }]
+            },
+            options: {
+                responsive: true,
+                maintainAspectRatio: false,
+                plugins: {
+                    title: {
+                        display: true,
+                        text: "Trade P&L"
+                    },
+                    tooltip: {
+                        callbacks: {
+                            title: function(context) {
+                                return "Trade #" + context[0].label;
+                            },
+                            label: function(context) {
+                                const symbol = report.pnl.label[context.dataIndex];
+                                const value = context.raw.toFixed(2);
+                                return symbol + ": $" + value;
+                            }
+                        }
+                    }
+                },
+                scales: {
+                    y: {
+                        title: {
+                            display: true,
+                            text: 'P&L ($)'
+                        }
+                    },
+                    x: {
+                        display: false
+                    }
+                }
+            }
+        });
+        
+        // Z-Score Chart
+        const ctxZScore = document.getElementById("zScoreChart").getContext("2d");
+        const zScoreChart = new Chart(ctxZScore, {
+            type: "line",
+            data: {
+                labels: report.z_score.x,
+                datasets: [{
+                    label: "Z-Score",
+                    data: report.z_score.y,
+                    borderColor: "#9900cc",
+                    backgroundColor: 'rgba(153, 0, 204, 0.1)',
+                    borderWidth: 2,
+                    fill: false,
+                    pointRadius: 3
+                }]
+            },
+            options: {
+                responsive: true,
+                maintainAspectRatio: false,
+                plugins: {
+                    title: {
+                        display: true,
+                        text: "Z-Score at Trade Time"
+                    },
+                    tooltip: {
+                        callbacks: {
+                            title: function(context) {
+                                return "Trade #" + context[0].label;
+                            },
+                            label: function(context) {
+                                const symbol = report.z_score.label[context.dataIndex];
+                                const value = context.raw.toFixed(4);
+                                return symbol + ": Z-Score " + value;
+                            }
+                        }
+                    }
+                },
+                scales: {
+                    y: {
+                        title: {
+                            display: true,
+                            text: 'Z-Score'
+                        }
+                    },
+                    x: {
+                        display: false
+                    }
+                }
+            }
+        });
+        
+        // Symbol P&L Chart
+        const ctxSymbolPnl = document.getElementById("symbolPnlChart").getContext("2d");
+        const symbolPnlChart = new Chart(ctxSymbolPnl, {
+            type: "bar",
+            data: {
+                labels: report.symbol_pnl.label,
+                datasets: [{
+                    label: "P&L by Symbol",
+                    data: report.symbol_pnl.y,
+                    backgroundColor: function(context) {
+                        const value = context.dataset.data[context.dataIndex];
+                        return value >= 0 ? 'rgba(0, 170, 0, 0.7)' : 'rgba(204, 0, 0, 0.7)';
+                    },
+                    borderColor: function(context) {
+                        const value = context.dataset.data[context.dataIndex];
+                        return value >= 0 ? 'rgba(0, 170, 0, 1)' : 'rgba(204, 0, 0, 1)';
+                    },
+                    borderWidth: 1
+                }]
+            },
+            options: {
+                responsive: true,
+                maintainAspectRatio: false,
+                plugins: {
+                    title: {
+                        display: true,
+                        text: "P&L by Symbol"
+                    },
+                    tooltip: {
+                        callbacks: {
+                            label: function(context) {
+                                return "P&L: $" + context.raw.toFixed(2);
+                            }
+                        }
+                    }
+                },
+                scales: {
+                    y: {
+                        title: {
+                            display: true,
+                            text: 'P&L ($)'
+                        }
+                    },
+                    x: {
+                        title: {
+                            display: true,
+                            text: "Symbol"
+                        }
+                    }
+                }
+            }
+        });
+        
+        // Symbol Count Chart
+        const ctxSymbolCount = document.getElementById("symbolCountChart").getContext("2d");
+        const symbolCountChart = new Chart(ctxSymbolCount, {
+            type: "bar",
+            data: {
+                labels: report.symbol_trades.label,
+                datasets: [{
+                    label: "Trades by Symbol",
+                    data: report.symbol_trades.y,
+                    backgroundColor: 'rgba(255, 159, 64, 0.7)',
+                    borderColor: 'rgba(255, 159, 64, 1)',
+                    borderWidth: 1
+                }]
+            },
+            options: {
+                responsive: true,
+                maintainAspectRatio: false,
+                plugins: {
+                    title: {
+                        display: true,
+                        text: "Trades by Symbol"
+                    },
+                    tooltip: {
+                        callbacks: {
+                            label: function(context) {
+                                return "Trades: " + context.raw;
+                            }
+                        }
+                    }
+                },
+                scales: {
+                    y: {
+                        beginAtZero: true,
+                        title: {
+                            display: true,
+                            text: 'Number of Trades'
+                        }
+                    },
+                    x: {
+                        title: {
+                            display: true,
+                            text: "Symbol"
+                        }
+                    }
+                }
+            }
+        });
+    </script>
+</body>
+</html>
+)";
+    
+    html_file.close();
+    winter::utils::Logger::info() << "Generated trade result graphs: " << output_file << winter::utils::Logger::endl;
+    return true;
+}
+
+} // namespace winter::runtime
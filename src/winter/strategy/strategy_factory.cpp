@@ -1,12 +1,44 @@
 // src/winter/strategy/strategy_factory.cpp
 #include "winter/strategy/strategy_factory.hpp"
+#include "winter/utils/logger.hpp"
 
 namespace winter {
 namespace strategy {
 
-// Define static members
-std::unordered_map<std::string, StrategyFactory::StrategyCreator> StrategyFactory::creators_;
-std::mutex StrategyFactory::factory_mutex_;
+std::unordered_map<std::string, StrategyFactory::StrategyCreator>& StrategyFactory::creators() {
+    static std::unordered_map<std::string, StrategyCreator> creators;
+    return creators;
+}
+
+std::mutex& StrategyFactory::factory_mutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+StrategyPtr StrategyFactory::create_configured(const std::string& type_name, const utils::ConfigValues& parameters) {
+    StrategyPtr strategy = create_strategy(type_name);
+    if (!strategy) {
+        utils::Logger::error() << "Unknown strategy type: " << type_name << utils::Logger::endl;
+        return nullptr;
+    }
+    if (!strategy->configure(parameters)) {
+        utils::Logger::error() << "Invalid parameters for " << type_name << utils::Logger::endl;
+        return nullptr;
+    }
+    return strategy;
+}
+
+std::vector<StrategyPtr> StrategyFactory::create_from_config(const utils::WinterConfig& config) {
+    std::vector<StrategyPtr> strategies;
+    for (const auto& type : config.enabled_strategies) {
+        StrategyPtr strategy = create_configured(type, config.parameters_for(type));
+        if (!strategy) {
+            return {};
+        }
+        strategies.push_back(std::move(strategy));
+    }
+    return strategies;
+}
 
 } // namespace strategy
 } // namespace winter
@@ -0,0 +1,91 @@
+#include <winter/strategy/strategy_plugin.hpp>
+#include <winter/utils/logger.hpp>
+#include <winter/utils/plugin_loader.hpp>
+#include <atomic>
+#include <filesystem>
+#include <stdexcept>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+namespace winter::strategy {
+
+namespace {
+
+// The dynamic loader hands back the already mapped image for a path it has
+// open, so each load goes through a uniquely named copy
+std::filesystem::path private_copy(const std::filesystem::path& path, std::error_code& ec) {
+    static std::atomic<uint64_t> counter{0};
+#ifdef _WIN32
+    const long pid = 0;
+#else
+    const long pid = static_cast<long>(::getpid());
+#endif
+    auto copy = std::filesystem::temp_directory_path(ec) /
+                ("winter-plugin-" + std::to_string(pid) + "-" + std::to_string(counter++) + "-" +
+                 path.filename().string());
+    if (!ec) {
+        std::filesystem::copy_file(path, copy, std::filesystem::copy_options::overwrite_existing, ec);
+    }
+    return copy;
+}
+
+} // namespace
+
+std::shared_ptr<StrategyPlugin> StrategyPlugin::load(const std::string& path) {
+    std::error_code ec;
+    std::filesystem::path copy = private_copy(path, ec);
+    if (ec) {
+        utils::Logger::error() << "Cannot stage plugin " << path << ": " << ec.message() << utils::Logger::endl;
+        return nullptr;
+    }
+
+    auto library = std::make_shared<utils::PluginLoader>();
+    WinterStrategyPluginEntry entry = nullptr;
+    try {
+        library->load(copy.string());
+        entry = library->get_function<WinterStrategyPluginEntry>(WINTER_STRATEGY_PLUGIN_ENTRY);
+    } catch (const std::exception& e) {
+        utils::Logger::error() << "Cannot load plugin " << path << ": " << e.what() << utils::Logger::endl;
+        std::filesystem::remove(copy, ec);
+        return nullptr;
+    }
+    // The mapping outlives the file on POSIX; elsewhere the copy stays until exit
+    std::filesystem::remove(copy, ec);
+
+    const WinterStrategyPluginInfo* info = entry();
+    std::string problem;
+    if (!info || !info->create || !info->destroy || !info->type_name || !info->version) {
+        problem = "incomplete plugin description";
+    } else if (info->abi_version != WINTER_STRATEGY_PLUGIN_ABI) {
+        problem = "plugin ABI " + std::to_string(info->abi_version) + ", host ABI " +
+                  std::to_string(WINTER_STRATEGY_PLUGIN_ABI);
+    } else if (info->base_size != sizeof(StrategyBase) || info->cxx_abi != WINTER_CXX_ABI) {
+        problem = "built against a different StrategyBase or C++ ABI";
+    }
+    if (!problem.empty()) {
+        utils::Logger::error() << "Rejected plugin " << path << ": " << problem << utils::Logger::endl;
+        return nullptr;
+    }
+
+    std::shared_ptr<StrategyPlugin> plugin(new StrategyPlugin());
+    plugin->path_ = path;
+    plugin->library_ = std::move(library);
+    plugin->info_ = info;
+    utils::Logger::info() << "Loaded strategy plugin " << info->type_name << " " << info->version << " from "
+                          << path << utils::Logger::endl;
+    return plugin;
+}
+
+StrategyPtr StrategyPlugin::create(const std::string& instance_name) const {
+    const std::string name = instance_name.empty() ? std::string(info_->type_name) : instance_name;
+    StrategyBase* strategy = info_->create(name.c_str());
+    if (!strategy) {
+        utils::Logger::error() << "Plugin " << info_->type_name << " failed to create " << name << utils::Logger::endl;
+        return nullptr;
+    }
+    // Destroyed by the plugin's own code; the library is released afterwards
+    return StrategyPtr(strategy, [library = library_, destroy = info_->destroy](StrategyBase* s) { destroy(s); });
+}
+
+} // namespace winter::strategy
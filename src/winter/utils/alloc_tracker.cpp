@@ -0,0 +1,68 @@
+#include <winter/utils/alloc_tracker.hpp>
+#include <winter/utils/logger.hpp>
+#include <atomic>
+
+namespace winter::utils {
+
+namespace {
+
+// Constant-initialized and trivially destructible, so the hooks can touch
+// them from any thread at any time without TLS guards
+thread_local AllocStats thread_counts;
+
+std::atomic<uint64_t> process_allocations{0};
+std::atomic<uint64_t> process_deallocations{0};
+std::atomic<uint64_t> process_bytes{0};
+std::atomic<bool> installed{false};
+
+} // namespace
+
+bool AllocTracker::hooks_installed() {
+    return installed.load(std::memory_order_relaxed);
+}
+
+AllocStats AllocTracker::thread_stats() {
+    return thread_counts;
+}
+
+AllocStats AllocTracker::process_stats() {
+    return AllocStats{process_allocations.load(std::memory_order_relaxed),
+                      process_deallocations.load(std::memory_order_relaxed),
+                      process_bytes.load(std::memory_order_relaxed)};
+}
+
+void AllocTracker::record_allocation(size_t bytes) noexcept {
+    ++thread_counts.allocations;
+    thread_counts.bytes += bytes;
+    process_allocations.fetch_add(1, std::memory_order_relaxed);
+    process_bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void AllocTracker::record_deallocation() noexcept {
+    ++thread_counts.deallocations;
+    process_deallocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+void AllocTracker::mark_hooks_installed() noexcept {
+    installed.store(true, std::memory_order_relaxed);
+}
+
+AllocScope::AllocScope(std::string name, bool log_on_exit)
+    : name_(std::move(name)), log_on_exit_(log_on_exit), start_(AllocTracker::thread_stats()) {}
+
+AllocScope::~AllocScope() {
+    if (!log_on_exit_) {
+        return;
+    }
+    AllocStats delta = stats();
+    if (delta.allocations > 0) {
+        Logger::warn() << "Allocation scope " << name_ << ": " << delta.allocations << " allocations, "
+                       << delta.bytes << " bytes" << Logger::endl;
+    }
+}
+
+AllocStats AllocScope::stats() const {
+    return AllocTracker::thread_stats() - start_;
+}
+
+} // namespace winter::utils
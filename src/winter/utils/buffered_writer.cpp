@@ -0,0 +1,111 @@
+#include <winter/utils/buffered_writer.hpp>
+#include <winter/utils/logger.hpp>
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+
+namespace winter::utils {
+
+BufferedWriter::BufferedWriter(const std::string& path, size_t buffer_size)
+    : buffer_(std::max<size_t>(buffer_size, 4096)) {
+    file_ = std::fopen(path.c_str(), "wb");
+    if (!file_) {
+        Logger::error() << "Failed to open file for writing: " << path << Logger::endl;
+    }
+}
+
+BufferedWriter::~BufferedWriter() {
+    close();
+}
+
+void BufferedWriter::flush_buffer() {
+    if (file_ && pos_ > 0) {
+        std::fwrite(buffer_.data(), 1, pos_, file_);
+        bytes_written_ += pos_;
+    }
+    pos_ = 0;
+}
+
+void BufferedWriter::write(std::string_view text) {
+    if (text.size() > buffer_.size() - pos_) {
+        flush_buffer();
+        // Oversized chunks bypass the buffer entirely
+        if (text.size() > buffer_.size()) {
+            if (file_) {
+                std::fwrite(text.data(), 1, text.size(), file_);
+                bytes_written_ += text.size();
+            }
+            return;
+        }
+    }
+    std::memcpy(buffer_.data() + pos_, text.data(), text.size());
+    pos_ += text.size();
+}
+
+void BufferedWriter::write(char c) {
+    if (pos_ == buffer_.size()) {
+        flush_buffer();
+    }
+    buffer_[pos_++] = c;
+}
+
+void BufferedWriter::write_double(double value, int precision) {
+    // JSON has no representation for NaN/inf
+    if (!std::isfinite(value)) {
+        write("null");
+        return;
+    }
+
+    char tmp[64];
+    std::to_chars_result result = precision < 0
+        ? std::to_chars(tmp, tmp + sizeof(tmp), value)
+        : std::to_chars(tmp, tmp + sizeof(tmp), value, std::chars_format::fixed, precision);
+    write(std::string_view(tmp, result.ptr - tmp));
+}
+
+void BufferedWriter::write_int(int64_t value) {
+    char tmp[24];
+    auto result = std::to_chars(tmp, tmp + sizeof(tmp), value);
+    write(std::string_view(tmp, result.ptr - tmp));
+}
+
+void BufferedWriter::write_json_string(std::string_view text) {
+    write('"');
+    for (char c : text) {
+        switch (c) {
+            case '"':  write("\\\""); break;
+            case '\\': write("\\\\"); break;
+            case '\n': write("\\n"); break;
+            case '\r': write("\\r"); break;
+            case '\t': write("\\t"); break;
+            case '<':  write("\\u003c"); break; // Keep "</script>" out of inline data
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char esc[8];
+                    std::snprintf(esc, sizeof(esc), "\\u%04x", c);
+                    write(esc);
+                } else {
+                    write(c);
+                }
+        }
+    }
+    write('"');
+}
+
+void BufferedWriter::flush() {
+    flush_buffer();
+    if (file_) {
+        std::fflush(file_);
+    }
+}
+
+void BufferedWriter::close() {
+    if (file_) {
+        flush_buffer();
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+}
+
+} // namespace winter::utils
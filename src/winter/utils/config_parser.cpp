@@ -0,0 +1,338 @@
+#include <winter/utils/config_parser.hpp>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+namespace winter::utils {
+
+namespace {
+
+struct Line {
+    size_t number;
+    size_t indent;
+    std::string_view text;  // Comment and surrounding whitespace removed
+};
+
+std::string_view trim(std::string_view text) {
+    size_t begin = text.find_first_not_of(" \t\r");
+    if (begin == std::string_view::npos) {
+        return {};
+    }
+    size_t end = text.find_last_not_of(" \t\r");
+    return text.substr(begin, end - begin + 1);
+}
+
+// '#' starts a comment at the start of a line or after whitespace, outside quotes
+std::string_view strip_comment(std::string_view text) {
+    char quote = 0;
+    for (size_t i = 0; i < text.size(); ++i) {
+        char c = text[i];
+        if (quote) {
+            if (c == quote) quote = 0;
+        } else if (c == '"' || c == '\'') {
+            quote = c;
+        } else if (c == '#' && (i == 0 || text[i - 1] == ' ' || text[i - 1] == '\t')) {
+            return text.substr(0, i);
+        }
+    }
+    return text;
+}
+
+bool is_item(std::string_view text) {
+    return text == "-" || text.substr(0, 2) == "- ";
+}
+
+// Recursive descent over pre-split lines; stops at the first error
+class Parser {
+public:
+    explicit Parser(std::string_view text) {
+        size_t number = 0;
+        size_t pos = 0;
+        while (pos <= text.size() && error_.empty()) {
+            size_t end = text.find('\n', pos);
+            if (end == std::string_view::npos) end = text.size();
+            std::string_view raw = text.substr(pos, end - pos);
+            pos = end + 1;
+            ++number;
+
+            std::string_view content = trim(strip_comment(raw));
+            if (content.empty() || (lines_.empty() && content == "---")) {
+                continue;
+            }
+            size_t indent = raw.find_first_not_of(' ');
+            if (raw[indent] == '\t') {
+                fail(number, "tab in indentation");
+            }
+            lines_.push_back(Line{number, indent, content});
+        }
+    }
+
+    bool parse(ConfigNode& root, std::string& error) {
+        if (error_.empty()) {
+            root = lines_.empty() ? ConfigNode(ConfigNode::Kind::Map) : parse_block(lines_[0].indent);
+            if (error_.empty() && next_ < lines_.size()) {
+                fail(lines_[next_].number, "unexpected indentation");
+            }
+        }
+        error = error_;
+        return error_.empty();
+    }
+
+private:
+    std::vector<Line> lines_;
+    size_t next_ = 0;
+    std::string error_;
+
+    void fail(size_t line, const std::string& message) {
+        if (error_.empty()) {
+            error_ = "line " + std::to_string(line) + ": " + message;
+        }
+    }
+
+    bool more_at(size_t indent) const {
+        return error_.empty() && next_ < lines_.size() && lines_[next_].indent == indent;
+    }
+
+    ConfigNode parse_block(size_t indent) {
+        return is_item(lines_[next_].text) ? parse_sequence(indent) : parse_map(indent);
+    }
+
+    ConfigNode parse_sequence(size_t indent) {
+        ConfigNode node(ConfigNode::Kind::Sequence);
+        while (more_at(indent) && is_item(lines_[next_].text)) {
+            const Line& line = lines_[next_++];
+            std::string_view value = trim(line.text.substr(1));
+            if (value.empty()) {
+                fail(line.number, "empty or nested sequence items are not supported");
+            } else if (value.front() != '"' && value.front() != '\'' && value.find(": ") != std::string_view::npos) {
+                fail(line.number, "mappings inside sequences are not supported");
+            } else {
+                node.append(parse_inline(line.number, value));
+            }
+        }
+        return node;
+    }
+
+    ConfigNode parse_map(size_t indent) {
+        ConfigNode node(ConfigNode::Kind::Map);
+        while (more_at(indent)) {
+            const Line& line = lines_[next_++];
+            if (is_item(line.text)) {
+                fail(line.number, "sequence item where a key was expected");
+                break;
+            }
+            size_t colon = find_key_colon(line.text);
+            if (colon == std::string_view::npos) {
+                fail(line.number, "expected 'key: value'");
+                break;
+            }
+            std::string key = unquote(line.number, trim(line.text.substr(0, colon)));
+            if (key.empty()) {
+                fail(line.number, "empty key");
+                break;
+            }
+            if (node.find(key)) {
+                fail(line.number, "duplicate key '" + key + "'");
+                break;
+            }
+            std::string_view value = trim(line.text.substr(colon + 1));
+            if (!value.empty()) {
+                node.add(std::move(key), parse_inline(line.number, value));
+            } else if (next_ < lines_.size() && lines_[next_].indent > indent) {
+                node.add(std::move(key), parse_block(lines_[next_].indent));
+            } else if (more_at(indent) && is_item(lines_[next_].text)) {
+                // "key:" followed by an unindented "- item" list
+                node.add(std::move(key), parse_sequence(indent));
+            } else {
+                node.add(std::move(key), ConfigNode(""));  // Null
+            }
+        }
+        return node;
+    }
+
+    // The ':' ending a key, outside quotes and followed by space or end of line
+    static size_t find_key_colon(std::string_view text) {
+        char quote = 0;
+        for (size_t i = 0; i < text.size(); ++i) {
+            char c = text[i];
+            if (quote) {
+                if (c == quote) quote = 0;
+            } else if (c == '"' || c == '\'') {
+                quote = c;
+            } else if (c == ':' && (i + 1 == text.size() || text[i + 1] == ' ')) {
+                return i;
+            }
+        }
+        return std::string_view::npos;
+    }
+
+    ConfigNode parse_inline(size_t line, std::string_view value) {
+        if (value.front() == '[') {
+            if (value.back() != ']') {
+                fail(line, "unterminated flow sequence");
+                return ConfigNode();
+            }
+            ConfigNode node(ConfigNode::Kind::Sequence);
+            std::string_view body = trim(value.substr(1, value.size() - 2));
+            while (!body.empty()) {
+                size_t comma = body.find(',');
+                std::string_view item = trim(body.substr(0, comma));
+                if (item.empty()) {
+                    fail(line, "empty flow sequence item");
+                    break;
+                }
+                node.append(ConfigNode(unquote(line, item)));
+                body = comma == std::string_view::npos ? std::string_view() : body.substr(comma + 1);
+            }
+            return node;
+        }
+        if (value.front() == '{' || value.front() == '&' || value.front() == '*' || value.front() == '!' ||
+            value.front() == '|' || value.front() == '>') {
+            fail(line, "unsupported YAML construct '" + std::string(1, value.front()) + "'");
+            return ConfigNode();
+        }
+        return ConfigNode(unquote(line, value));
+    }
+
+    std::string unquote(size_t line, std::string_view value) {
+        if (value.empty() || (value.front() != '"' && value.front() != '\'')) {
+            return std::string(value);
+        }
+        char quote = value.front();
+        if (value.size() < 2 || value.back() != quote) {
+            fail(line, "unterminated quoted string");
+            return {};
+        }
+        std::string out;
+        std::string_view body = value.substr(1, value.size() - 2);
+        for (size_t i = 0; i < body.size(); ++i) {
+            if (quote == '"' && body[i] == '\\' && i + 1 < body.size()) {
+                char escaped = body[++i];
+                out += escaped == 'n' ? '\n' : escaped == 't' ? '\t' : escaped;
+            } else if (quote == '\'' && body[i] == '\'' && i + 1 < body.size() && body[i + 1] == '\'') {
+                out += '\'';
+                ++i;
+            } else {
+                out += body[i];
+            }
+        }
+        return out;
+    }
+};
+
+} // namespace
+
+const ConfigNode* ConfigNode::find(std::string_view key) const {
+    for (const auto& [name, value] : entries_) {
+        if (name == key) {
+            return &value;
+        }
+    }
+    return nullptr;
+}
+
+bool ConfigParser::parse(std::string_view text, ConfigNode& root, std::string& error) {
+    return Parser(text).parse(root, error);
+}
+
+bool ConfigParser::parse_file(const std::string& path, ConfigNode& root, std::string& error) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        error = "cannot open " + path;
+        return false;
+    }
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    if (!parse(contents.str(), root, error)) {
+        error = path + ": " + error;
+        return false;
+    }
+    return true;
+}
+
+const ConfigValues& WinterConfig::parameters_for(const std::string& type) const {
+    static const ConfigValues none;
+    auto it = strategy_parameters.find(type);
+    return it != strategy_parameters.end() ? it->second : none;
+}
+
+bool WinterConfig::from_node(const ConfigNode& root, WinterConfig& out, std::string& error) {
+    if (!root.is_map()) {
+        error = "top level must be a mapping";
+        return false;
+    }
+    WinterConfig config;
+    if (const ConfigNode* enabled = root.find("enabled_strategies")) {
+        if (enabled->is_scalar() && enabled->scalar().empty()) {
+            // Every entry commented out
+        } else if (!enabled->is_sequence()) {
+            error = "enabled_strategies must be a list";
+            return false;
+        } else {
+            for (const auto& item : enabled->items()) {
+                if (!item.is_scalar()) {
+                    error = "enabled_strategies entries must be strategy names";
+                    return false;
+                }
+                config.enabled_strategies.push_back(item.scalar());
+            }
+        }
+    }
+    if (const ConfigNode* parameters = root.find("strategy_parameters")) {
+        if (!parameters->is_map() && !(parameters->is_scalar() && parameters->scalar().empty())) {
+            error = "strategy_parameters must be a mapping";
+            return false;
+        }
+        for (const auto& [type, values] : parameters->entries()) {
+            if (values.is_scalar() && values.scalar().empty()) {
+                config.strategy_parameters[type];
+                continue;
+            }
+            if (!values.is_map()) {
+                error = "strategy_parameters." + type + " must be a mapping";
+                return false;
+            }
+            ConfigValues& target = config.strategy_parameters[type];
+            for (const auto& [key, value] : values.entries()) {
+                if (!value.is_scalar()) {
+                    error = "strategy_parameters." + type + "." + key + " must be a single value";
+                    return false;
+                }
+                target[key] = value.scalar();
+            }
+        }
+    }
+    out = std::move(config);
+    return true;
+}
+
+bool WinterConfig::load(const std::string& path, WinterConfig& out, std::string& error) {
+    ConfigNode root;
+    if (!ConfigParser::parse_file(path, root, error)) {
+        return false;
+    }
+    if (!from_node(root, out, error)) {
+        error = path + ": " + error;
+        return false;
+    }
+    return true;
+}
+
+std::vector<std::string> diff_config_values(const ConfigValues& before, const ConfigValues& after) {
+    std::map<std::string, std::pair<const std::string*, const std::string*>> keys;
+    for (const auto& [key, value] : before) keys[key].first = &value;
+    for (const auto& [key, value] : after) keys[key].second = &value;
+
+    std::vector<std::string> changes;
+    for (const auto& [key, values] : keys) {
+        const auto& [old_value, new_value] = values;
+        if (old_value && new_value && *old_value == *new_value) {
+            continue;
+        }
+        changes.push_back(key + ": " + (old_value ? *old_value : "(default)") + " -> " +
+                          (new_value ? *new_value : "(default)"));
+    }
+    return changes;
+}
+
+} // namespace winter::utils
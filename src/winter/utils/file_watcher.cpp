@@ -0,0 +1,70 @@
+#include <winter/utils/file_watcher.hpp>
+#include <winter/utils/logger.hpp>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace winter::utils {
+
+#ifndef __linux__
+// No inotify: the watcher reports !ok() and callers skip live reloads
+FileWatcher::FileWatcher(std::string path) : path_(std::move(path)) {
+    name_ = std::filesystem::path(path_).filename().string();
+    Logger::warn() << "Cannot watch " << path_ << ": file watching needs inotify" << Logger::endl;
+}
+
+FileWatcher::~FileWatcher() = default;
+
+bool FileWatcher::changed() {
+    return false;
+}
+#else
+
+FileWatcher::FileWatcher(std::string path) : path_(std::move(path)) {
+    std::filesystem::path file(path_);
+    name_ = file.filename().string();
+    std::string directory = file.has_parent_path() ? file.parent_path().string() : ".";
+
+    fd_ = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd_ < 0) {
+        Logger::error() << "Cannot watch " << path_ << ": " << std::strerror(errno) << Logger::endl;
+        return;
+    }
+    if (::inotify_add_watch(fd_, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+        Logger::error() << "Cannot watch " << directory << ": " << std::strerror(errno) << Logger::endl;
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+FileWatcher::~FileWatcher() {
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+}
+
+bool FileWatcher::changed() {
+    if (fd_ < 0) {
+        return false;
+    }
+    bool changed = false;
+    alignas(inotify_event) char buffer[4096];
+    ssize_t length;
+    while ((length = ::read(fd_, buffer, sizeof(buffer))) > 0) {
+        for (ssize_t offset = 0; offset < length;) {
+            const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+            if (event->len > 0 && name_ == event->name) {
+                changed = true;
+            }
+            offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+        }
+    }
+    return changed;
+}
+#endif
+
+} // namespace winter::utils
@@ -76,7 +76,7 @@ public:
 };
 
 Flamegraph::Flamegraph(std::string name) 
-    : name_(std::move(name)), impl_(std::make_unique<FlamegraphImpl>(name_)), running_(false) {}
+    : impl_(std::make_unique<FlamegraphImpl>(name)), name_(std::move(name)), running_(false) {}
 
 Flamegraph::~Flamegraph() {
     if (running_) {
@@ -0,0 +1,70 @@
+#include <winter/utils/huge_pages.hpp>
+#include <new>
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace winter::utils {
+
+namespace {
+
+constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+constexpr size_t PAGE_ALIGNMENT = 4096;
+
+size_t round_up(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+} // namespace
+
+PageAllocation allocate_pages(size_t bytes, bool use_huge_pages) {
+    PageAllocation allocation;
+    if (bytes == 0) {
+        return allocation;
+    }
+
+#ifdef __linux__
+    if (use_huge_pages) {
+        // Explicit huge pages need a reserved pool (vm.nr_hugepages)
+        size_t size = round_up(bytes, HUGE_PAGE_SIZE);
+        void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (data != MAP_FAILED) {
+            allocation.data = data;
+            allocation.size = size;
+            allocation.huge_pages = true;
+            return allocation;
+        }
+    }
+
+    size_t size = round_up(bytes, use_huge_pages ? HUGE_PAGE_SIZE : PAGE_ALIGNMENT);
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (data == MAP_FAILED) {
+        throw std::bad_alloc();
+    }
+    if (use_huge_pages) {
+        madvise(data, size, MADV_HUGEPAGE);
+    }
+    allocation.data = data;
+    allocation.size = size;
+#else
+    (void)use_huge_pages;
+    allocation.size = round_up(bytes, PAGE_ALIGNMENT);
+    allocation.data = ::operator new(allocation.size, std::align_val_t(PAGE_ALIGNMENT));
+#endif
+    return allocation;
+}
+
+void free_pages(PageAllocation& allocation) {
+    if (!allocation.data) {
+        return;
+    }
+#ifdef __linux__
+    munmap(allocation.data, allocation.size);
+#else
+    ::operator delete(allocation.data, std::align_val_t(PAGE_ALIGNMENT));
+#endif
+    allocation = PageAllocation{};
+}
+
+} // namespace winter::utils
@@ -0,0 +1,73 @@
+#include <winter/utils/realtime.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#ifdef __linux__
+#include <malloc.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#endif
+
+namespace winter::utils {
+
+namespace {
+
+constexpr size_t STACK_CHUNK = 4096;
+
+// One page of stack per frame; the write after the call keeps the frame alive
+[[gnu::noinline]] void touch_stack(size_t remaining) {
+    volatile char page[STACK_CHUNK];
+    page[0] = 0;
+    page[STACK_CHUNK - 1] = 0;
+    if (remaining > STACK_CHUNK) {
+        touch_stack(remaining - STACK_CHUNK);
+    }
+    page[1] = page[0];
+}
+
+} // namespace
+
+bool lock_process_memory(std::string& error) {
+#ifdef __linux__
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+        error = std::string("mlockall failed: ") + std::strerror(errno) +
+                (errno == EPERM || errno == ENOMEM ? " (needs CAP_IPC_LOCK or a higher RLIMIT_MEMLOCK)" : "");
+        return false;
+    }
+#ifdef __GLIBC__
+    // Keep freed memory mapped (and locked) for reuse instead of trimming it
+    mallopt(M_TRIM_THRESHOLD, -1);
+    mallopt(M_MMAP_MAX, 0);
+#endif
+    return true;
+#else
+    error = "memory locking is not supported on this platform";
+    return false;
+#endif
+}
+
+bool set_realtime_priority(int priority, std::string& error) {
+#ifdef __linux__
+    sched_param param{};
+    param.sched_priority = std::clamp(priority, sched_get_priority_min(SCHED_FIFO), sched_get_priority_max(SCHED_FIFO));
+    int result = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+    if (result != 0) {
+        error = std::string("SCHED_FIFO failed: ") + std::strerror(result) +
+                (result == EPERM ? " (needs CAP_SYS_NICE or RLIMIT_RTPRIO)" : "");
+        return false;
+    }
+    return true;
+#else
+    error = "SCHED_FIFO is not supported on this platform";
+    return false;
+#endif
+}
+
+void prefault_stack(size_t bytes) {
+    if (bytes > 0) {
+        touch_stack(bytes);
+    }
+}
+
+} // namespace winter::utils
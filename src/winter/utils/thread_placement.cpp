@@ -0,0 +1,282 @@
+#include <winter/utils/thread_placement.hpp>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <thread>
+#include <tuple>
+
+namespace winter::utils {
+
+namespace {
+
+std::string read_line(const std::filesystem::path& path) {
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+int read_int(const std::filesystem::path& path, int fallback) {
+    std::string line = read_line(path);
+    try {
+        return line.empty() ? fallback : std::stoi(line);
+    } catch (...) {
+        return fallback;
+    }
+}
+
+bool contains(const std::vector<int>& cpus, int cpu) {
+    return std::find(cpus.begin(), cpus.end(), cpu) != cpus.end();
+}
+
+} // namespace
+
+CpuTopology CpuTopology::detect(const std::string& sysfs_root) {
+    namespace fs = std::filesystem;
+    const fs::path cpu_dir = fs::path(sysfs_root) / "cpu";
+
+    std::vector<int> online = parse_cpu_list(read_line(cpu_dir / "online"));
+    if (online.empty()) {
+        unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned cpu = 0; cpu < hardware; ++cpu) {
+            online.push_back(static_cast<int>(cpu));
+        }
+    }
+    std::vector<int> isolated = parse_cpu_list(read_line(cpu_dir / "isolated"));
+    std::vector<int> nohz_full = parse_cpu_list(read_line(cpu_dir / "nohz_full"));
+
+    std::map<int, int> node_of;
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(fs::path(sysfs_root) / "node", ec)) {
+        std::string name = entry.path().filename().string();
+        if (name.rfind("node", 0) != 0 || name.size() == 4 ||
+            !std::all_of(name.begin() + 4, name.end(), ::isdigit)) {
+            continue;
+        }
+        int node = std::stoi(name.substr(4));
+        for (int cpu : parse_cpu_list(read_line(entry.path() / "cpulist"))) {
+            node_of[cpu] = node;
+        }
+    }
+
+    std::vector<CpuInfo> cpus;
+    for (int cpu : online) {
+        const fs::path topology = cpu_dir / ("cpu" + std::to_string(cpu)) / "topology";
+        CpuInfo info;
+        info.cpu = cpu;
+        info.core_id = read_int(topology / "core_id", cpu);
+        info.package = read_int(topology / "physical_package_id", 0);
+        info.node = node_of.count(cpu) ? node_of[cpu] : 0;
+        info.isolated = contains(isolated, cpu);
+        info.nohz_full = contains(nohz_full, cpu);
+        cpus.push_back(info);
+    }
+    return CpuTopology(std::move(cpus));
+}
+
+CpuTopology::CpuTopology(std::vector<CpuInfo> cpus) : cpus_(std::move(cpus)) {
+    std::sort(cpus_.begin(), cpus_.end(), [](const CpuInfo& a, const CpuInfo& b) { return a.cpu < b.cpu; });
+
+    // Hardware threads sharing a package and core id are SMT siblings
+    std::map<std::pair<int, int>, size_t> core_index;
+    for (const auto& info : cpus_) {
+        auto key = std::make_pair(info.package, info.core_id);
+        auto it = core_index.find(key);
+        if (it == core_index.end()) {
+            core_index[key] = cores_.size();
+            cores_.push_back(PhysicalCore{{info.cpu}, info.node, info.isolated, info.nohz_full});
+        } else {
+            PhysicalCore& core = cores_[it->second];
+            core.cpus.push_back(info.cpu);
+            core.isolated = core.isolated && info.isolated;
+            core.nohz_full = core.nohz_full && info.nohz_full;
+        }
+    }
+}
+
+size_t CpuTopology::node_count() const {
+    std::set<int> nodes;
+    for (const auto& info : cpus_) {
+        nodes.insert(info.node);
+    }
+    return nodes.size();
+}
+
+std::vector<int> CpuTopology::parse_cpu_list(const std::string& list) {
+    std::vector<int> cpus;
+    std::stringstream ss(list);
+    std::string range;
+    while (std::getline(ss, range, ',')) {
+        range.erase(std::remove_if(range.begin(), range.end(), ::isspace), range.end());
+        if (range.empty()) {
+            continue;
+        }
+        try {
+            size_t dash = range.find('-');
+            int first = std::stoi(range.substr(0, dash));
+            int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+            for (int cpu = first; cpu <= last; ++cpu) {
+                cpus.push_back(cpu);
+            }
+        } catch (...) {
+            // Ignore malformed ranges
+        }
+    }
+    return cpus;
+}
+
+std::string CpuTopology::format_cpu_list(std::vector<int> cpus) {
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    std::string out;
+    for (size_t i = 0; i < cpus.size();) {
+        size_t j = i;
+        while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1) {
+            ++j;
+        }
+        if (!out.empty()) out += ",";
+        out += std::to_string(cpus[i]);
+        if (j > i) {
+            out += '-';
+            out += std::to_string(cpus[j]);
+        }
+        i = j + 1;
+    }
+    return out.empty() ? "none" : out;
+}
+
+PlacementPlan PlacementPlanner::plan(size_t pool_workers) const {
+    PlacementPlan plan;
+    const auto& cores = topology_.cores();
+    if (cores.empty()) {
+        return plan;
+    }
+
+    // Housekeeping goes to the first non-isolated core (normally cpu 0's)
+    auto housekeeping = std::find_if(cores.begin(), cores.end(), [](const PhysicalCore& c) { return !c.isolated; });
+    size_t logger_core = housekeeping == cores.end() ? 0 : static_cast<size_t>(housekeeping - cores.begin());
+    plan.logger = cores[logger_core].cpus.front();
+
+    // Keep the critical threads on the node with the most isolated cores
+    std::map<int, size_t> isolated_per_node;
+    for (const auto& core : cores) {
+        isolated_per_node[core.node] += core.isolated ? 1 : 0;
+    }
+    int home_node = cores[logger_core].node;
+    size_t best = 0;
+    for (const auto& [node, count] : isolated_per_node) {
+        if (count > best) {
+            best = count;
+            home_node = node;
+        }
+    }
+
+    // Candidates for the critical roles, best first
+    std::vector<size_t> order;
+    for (size_t i = 0; i < cores.size(); ++i) {
+        if (i != logger_core) {
+            order.push_back(i);
+        }
+    }
+    auto rank = [&](size_t i) {
+        const auto& core = cores[i];
+        return std::make_tuple(!core.isolated, !core.nohz_full, core.node != home_node, i);
+    };
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return rank(a) < rank(b); });
+
+    size_t isolated_count = std::count_if(cores.begin(), cores.end(), [](const PhysicalCore& c) { return c.isolated; });
+    if (isolated_count == 0) {
+        plan.notes.push_back("no isolated cores (isolcpus/nohz_full); critical threads share cores with the OS");
+    }
+
+    std::vector<bool> used(cores.size(), false);
+    used[logger_core] = true;
+    int* roles[] = {&plan.feed, &plan.strategy, &plan.execution};
+    const char* role_names[] = {"feed", "strategy", "execution"};
+    size_t next = 0;
+    for (size_t r = 0; r < 3; ++r) {
+        if (next < order.size()) {
+            used[order[next]] = true;
+            *roles[r] = cores[order[next]].cpus.front();
+            if (isolated_count > 0 && !cores[order[next]].isolated) {
+                plan.notes.push_back(std::string(role_names[r]) + " placed on a non-isolated core");
+            }
+            ++next;
+        } else {
+            // Out of cores: share with the previous role (or housekeeping)
+            *roles[r] = r > 0 ? *roles[r - 1] : plan.logger;
+            plan.notes.push_back(std::string(role_names[r]) + " shares cpu " + std::to_string(*roles[r]) +
+                                 " (not enough physical cores)");
+        }
+    }
+
+    // Pool: leftover non-isolated cores, home node first
+    std::vector<size_t> spare;
+    for (size_t i = 0; i < cores.size(); ++i) {
+        if (!used[i] && !cores[i].isolated) {
+            spare.push_back(i);
+        }
+    }
+    std::stable_sort(spare.begin(), spare.end(),
+                     [&](size_t a, size_t b) { return (cores[a].node != home_node) < (cores[b].node != home_node); });
+    for (size_t i : spare) {
+        plan.pool.push_back(cores[i].cpus.front());
+    }
+    if (plan.pool.empty()) {
+        plan.pool = cores[logger_core].cpus;
+        plan.notes.push_back("worker pool shares the housekeeping core");
+    }
+    if (pool_workers > 0) {
+        std::vector<int> sized;
+        for (size_t i = 0; i < pool_workers; ++i) {
+            sized.push_back(plan.pool[i % plan.pool.size()]);
+        }
+        plan.pool = std::move(sized);
+    }
+    return plan;
+}
+
+std::string PlacementPlan::describe(const CpuTopology& topology) const {
+    std::vector<int> isolated;
+    for (const auto& info : topology.cpus()) {
+        if (info.isolated) isolated.push_back(info.cpu);
+    }
+
+    auto describe_cpu = [&](int cpu) {
+        std::ostringstream out;
+        out << "cpu " << cpu;
+        for (const auto& core : topology.cores()) {
+            if (!contains(core.cpus, cpu)) {
+                continue;
+            }
+            out << " (node " << core.node << (core.isolated ? ", isolated" : "") << (core.nohz_full ? ", nohz_full" : "");
+            if (core.cpus.size() > 1) {
+                std::vector<int> siblings(core.cpus.begin(), core.cpus.end());
+                siblings.erase(std::remove(siblings.begin(), siblings.end(), cpu), siblings.end());
+                out << ", siblings " << CpuTopology::format_cpu_list(siblings) << " unused by the plan";
+            }
+            out << ")";
+            break;
+        }
+        return out.str();
+    };
+
+    std::ostringstream out;
+    out << "Thread placement (" << topology.cpus().size() << " cpus, " << topology.cores().size()
+        << " physical cores, " << topology.node_count() << " NUMA nodes, isolated: "
+        << CpuTopology::format_cpu_list(isolated) << ")\n";
+    out << "  feed       " << describe_cpu(feed) << "\n";
+    out << "  strategy   " << describe_cpu(strategy) << "\n";
+    out << "  execution  " << describe_cpu(execution) << "\n";
+    out << "  logger     cpu " << logger << "\n";
+    out << "  pool       cpus " << CpuTopology::format_cpu_list(pool) << " (" << pool.size() << " workers)\n";
+    for (const auto& note : notes) {
+        out << "  note: " << note << "\n";
+    }
+    return out.str();
+}
+
+} // namespace winter::utils
@@ -0,0 +1,219 @@
+#include <winter/utils/thread_pool.hpp>
+#include <winter/utils/core_affinity.hpp>
+#include <winter/utils/logger.hpp>
+
+namespace winter::utils {
+
+namespace {
+
+// Identifies the pool worker running on this thread, if any
+thread_local const ThreadPool* current_pool = nullptr;
+thread_local size_t current_index = 0;
+
+std::mutex shared_mutex;
+std::atomic<ThreadPool*> shared_pool{nullptr};
+std::vector<int> shared_cores;  // Empty: one unpinned worker per hardware thread
+
+std::vector<int> core_layout(size_t workers, int first_core) {
+    size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    if (workers == 0) {
+        workers = hardware;
+    }
+    std::vector<int> cores(workers, -1);
+    if (first_core >= 0) {
+        for (size_t i = 0; i < workers; ++i) {
+            cores[i] = static_cast<int>((static_cast<size_t>(first_core) + i) % hardware);
+        }
+    }
+    return cores;
+}
+
+} // namespace
+
+ThreadPool::ThreadPool(size_t workers, int first_core) : ThreadPool(core_layout(workers, first_core)) {}
+
+ThreadPool::ThreadPool(const std::vector<int>& cores) {
+    const size_t workers = std::max<size_t>(1, cores.size());
+    workers_.reserve(workers);
+    for (size_t i = 0; i < workers; ++i) {
+        workers_.push_back(std::make_unique<Worker>());
+    }
+    // Start threads only once every deque exists; workers steal from each other
+    for (size_t i = 0; i < workers; ++i) {
+        workers_[i]->thread = std::thread([this, i]() { worker_loop(i); });
+        int core = i < cores.size() ? cores[i] : -1;
+        if (core >= 0 && !CoreAffinity::pin_thread_to_core(workers_[i]->thread.native_handle(), core)) {
+            Logger::warn() << "Failed to pin pool worker " << i << " to core " << core << Logger::endl;
+        }
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+}
+
+bool ThreadPool::in_worker() const {
+    return current_pool == this;
+}
+
+void ThreadPool::post(std::function<void()> task) {
+    // A worker keeps its own tasks local; everyone else spreads them out
+    size_t index = in_worker() ? current_index
+                               : next_worker_.fetch_add(1, std::memory_order_relaxed) % workers_.size();
+    {
+        std::lock_guard<std::mutex> lock(workers_[index]->mutex);
+        workers_[index]->tasks.push_back(std::move(task));
+    }
+    pending_.fetch_add(1);
+    {
+        // Pairs with the predicate check in worker_loop so a wake-up is never lost
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+    }
+    wake_.notify_one();
+}
+
+void ThreadPool::parallel_for(size_t begin, size_t end, size_t grain,
+                              const std::function<void(size_t, size_t)>& body) {
+    if (begin >= end) {
+        return;
+    }
+    grain = resolve_grain(end - begin, grain);
+    size_t chunks = (end - begin + grain - 1) / grain;
+    if (chunks == 1) {
+        body(begin, end);
+        return;
+    }
+
+    std::atomic<size_t> remaining{chunks};
+    std::mutex error_mutex;
+    std::exception_ptr error;
+
+    auto run_chunk = [&](size_t c) {
+        size_t chunk_begin = begin + c * grain;
+        try {
+            body(chunk_begin, std::min(chunk_begin + grain, end));
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+        // Last touch of this frame's state by the task
+        remaining.fetch_sub(1, std::memory_order_acq_rel);
+    };
+
+    for (size_t c = 1; c < chunks; ++c) {
+        post([&run_chunk, c]() { run_chunk(c); });
+    }
+    run_chunk(0);
+
+    // Help out instead of blocking until every chunk is done
+    size_t home = in_worker() ? current_index : 0;
+    while (remaining.load(std::memory_order_acquire) > 0) {
+        if (!run_one(home)) {
+            std::this_thread::yield();
+        }
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+ThreadPool& ThreadPool::shared() {
+    if (ThreadPool* pool = shared_pool.load(std::memory_order_acquire)) {
+        return *pool;
+    }
+    std::lock_guard<std::mutex> lock(shared_mutex);
+    if (!shared_pool.load(std::memory_order_relaxed)) {
+        // Lives for the whole process; tasks may still be running during exit
+        auto* pool = shared_cores.empty() ? new ThreadPool() : new ThreadPool(shared_cores);
+        shared_pool.store(pool, std::memory_order_release);
+    }
+    return *shared_pool.load(std::memory_order_relaxed);
+}
+
+bool ThreadPool::configure_shared(size_t workers, int first_core) {
+    return configure_shared(core_layout(workers, first_core));
+}
+
+bool ThreadPool::configure_shared(const std::vector<int>& cores) {
+    std::lock_guard<std::mutex> lock(shared_mutex);
+    if (shared_pool.load(std::memory_order_relaxed)) {
+        Logger::warn() << "Shared thread pool already started; configuration ignored" << Logger::endl;
+        return false;
+    }
+    shared_cores = cores;
+    return true;
+}
+
+void ThreadPool::worker_loop(size_t index) {
+    current_pool = this;
+    current_index = index;
+
+    while (true) {
+        if (run_one(index)) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        wake_.wait(lock, [this]() { return pending_.load() > 0 || stopping_.load(); });
+        if (stopping_ && pending_.load() == 0) {
+            break;
+        }
+    }
+}
+
+bool ThreadPool::run_one(size_t home) {
+    const size_t count = workers_.size();
+    for (size_t i = 0; i < count; ++i) {
+        Worker& worker = *workers_[(home + i) % count];
+        std::function<void()> task;
+        {
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            if (worker.tasks.empty()) {
+                continue;
+            }
+            // Newest work from home keeps caches warm; steal the oldest elsewhere
+            if (i == 0) {
+                task = std::move(worker.tasks.back());
+                worker.tasks.pop_back();
+            } else {
+                task = std::move(worker.tasks.front());
+                worker.tasks.pop_front();
+            }
+        }
+        pending_.fetch_sub(1);
+        run_task(task);
+        return true;
+    }
+    return false;
+}
+
+void ThreadPool::run_task(std::function<void()>& task) {
+    try {
+        task();
+    } catch (const std::exception& e) {
+        Logger::error() << "Thread pool task failed: " << e.what() << Logger::endl;
+    } catch (...) {
+        Logger::error() << "Thread pool task failed with an unknown exception" << Logger::endl;
+    }
+}
+
+size_t ThreadPool::resolve_grain(size_t count, size_t grain) const {
+    if (grain > 0) {
+        return grain;
+    }
+    // A few chunks per worker leaves room for stealing to even out the load
+    return std::max<size_t>(1, count / (workers_.size() * 4));
+}
+
+} // namespace winter::utils
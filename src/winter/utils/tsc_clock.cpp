@@ -0,0 +1,129 @@
+#include <winter/utils/tsc_clock.hpp>
+#include <chrono>
+
+namespace winter::utils {
+
+namespace {
+
+int64_t monotonic_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int64_t realtime_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+TscClock& TscClock::instance() {
+    static TscClock clock;
+    return clock;
+}
+
+TscClock::Sample TscClock::sample() {
+    // Bracket the clock read with two stamps and keep the tightest of a few
+    // attempts, so preemption between the reads does not skew the pair
+    Sample best{};
+    uint64_t best_gap = UINT64_MAX;
+    for (int i = 0; i < 5; ++i) {
+        uint64_t before = tsc_now();
+        int64_t mono = monotonic_ns();
+        uint64_t after = tsc_now();
+        if (after - before < best_gap) {
+            best_gap = after - before;
+            best.ticks = before + (after - before) / 2;
+            best.monotonic_ns = mono;
+        }
+    }
+    best.realtime_ns = realtime_ns() - (monotonic_ns() - best.monotonic_ns);
+    return best;
+}
+
+TscClock::TscClock() {
+    Sample origin = sample();
+    origin_ticks_ = origin.ticks;
+    origin_ns_ = origin.monotonic_ns;
+
+    double ns_per_tick = 1.0;
+#ifdef WINTER_HAS_RDTSCP
+    // Initial rate from a short spin; recalibration refines it from here on
+    while (monotonic_ns() - origin_ns_ < 10000000) {
+    }
+    Sample now = sample();
+    ns_per_tick = static_cast<double>(now.monotonic_ns - origin_ns_) /
+                  static_cast<double>(now.ticks - origin_ticks_);
+    origin = now;
+#endif
+
+    recalibrate_interval_ticks_ = static_cast<uint64_t>(RECALIBRATE_INTERVAL_NS / ns_per_tick);
+    publish(origin, ns_per_tick);
+}
+
+void TscClock::publish(const Sample& anchor, double ns_per_tick) {
+    uint32_t seq = seq_.load(std::memory_order_relaxed);
+    seq_.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    base_ticks_.store(anchor.ticks, std::memory_order_relaxed);
+    base_ns_.store(anchor.monotonic_ns, std::memory_order_relaxed);
+    epoch_offset_ns_.store(anchor.realtime_ns - anchor.monotonic_ns, std::memory_order_relaxed);
+    ns_per_tick_.store(ns_per_tick, std::memory_order_relaxed);
+    seq_.store(seq + 2, std::memory_order_release);
+}
+
+void TscClock::load(uint64_t& base_ticks, int64_t& base_ns, double& ns_per_tick, int64_t& epoch_offset) const {
+    uint32_t before, after;
+    do {
+        before = seq_.load(std::memory_order_acquire);
+        base_ticks = base_ticks_.load(std::memory_order_relaxed);
+        base_ns = base_ns_.load(std::memory_order_relaxed);
+        ns_per_tick = ns_per_tick_.load(std::memory_order_relaxed);
+        epoch_offset = epoch_offset_ns_.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        after = seq_.load(std::memory_order_relaxed);
+    } while (before != after || (before & 1));
+}
+
+void TscClock::recalibrate() {
+    // One recalibration at a time; others keep using the current anchor
+    if (recalibrating_.exchange(true, std::memory_order_acquire)) {
+        return;
+    }
+
+    Sample now = sample();
+    double ns_per_tick = ns_per_tick_.load(std::memory_order_relaxed);
+#ifdef WINTER_HAS_RDTSCP
+    if (now.ticks > origin_ticks_) {
+        ns_per_tick = static_cast<double>(now.monotonic_ns - origin_ns_) /
+                      static_cast<double>(now.ticks - origin_ticks_);
+    }
+#endif
+    publish(now, ns_per_tick);
+
+    recalibrating_.store(false, std::memory_order_release);
+}
+
+int64_t TscClock::to_ns(uint64_t ticks) {
+    uint64_t base_ticks;
+    int64_t base_ns;
+    double ns_per_tick;
+    int64_t epoch_offset;
+    load(base_ticks, base_ns, ns_per_tick, epoch_offset);
+
+    if (ticks > base_ticks && ticks - base_ticks > recalibrate_interval_ticks_) {
+        recalibrate();
+        load(base_ticks, base_ns, ns_per_tick, epoch_offset);
+    }
+
+    // Signed delta: stamps taken just before a re-anchor are still valid
+    int64_t delta = static_cast<int64_t>(ticks - base_ticks);
+    return base_ns + static_cast<int64_t>(static_cast<double>(delta) * ns_per_tick);
+}
+
+int64_t TscClock::to_epoch_ns(uint64_t ticks) {
+    int64_t ns = to_ns(ticks);
+    return ns + epoch_offset_ns_.load(std::memory_order_relaxed);
+}
+
+} // namespace winter::utils
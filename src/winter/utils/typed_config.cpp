@@ -0,0 +1,78 @@
+#include <winter/utils/typed_config.hpp>
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <sstream>
+
+namespace winter::utils::config_detail {
+
+namespace {
+
+std::string_view trim(std::string_view text) {
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(text.front()))) text.remove_prefix(1);
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(text.back()))) text.remove_suffix(1);
+    return text;
+}
+
+template<typename N>
+bool parse_number(std::string_view text, N& out) {
+    text = trim(text);
+    if (!text.empty() && text.front() == '+') {
+        text.remove_prefix(1);
+    }
+    N value{};
+    auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (text.empty() || ec != std::errc() || end != text.data() + text.size()) {
+        return false;
+    }
+    out = value;
+    return true;
+}
+
+} // namespace
+
+bool parse_value(std::string_view text, double& out) {
+    double value = 0.0;
+    if (!parse_number(text, value) || !std::isfinite(value)) {
+        return false;
+    }
+    out = value;
+    return true;
+}
+
+bool parse_value(std::string_view text, int& out) { return parse_number(text, out); }
+bool parse_value(std::string_view text, int64_t& out) { return parse_number(text, out); }
+bool parse_value(std::string_view text, size_t& out) { return parse_number(text, out); }
+
+bool parse_value(std::string_view text, bool& out) {
+    std::string lower(trim(text));
+    std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return std::tolower(c); });
+    if (lower == "true" || lower == "yes" || lower == "on" || lower == "1") {
+        out = true;
+    } else if (lower == "false" || lower == "no" || lower == "off" || lower == "0") {
+        out = false;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool parse_value(std::string_view text, std::string& out) {
+    out = std::string(trim(text));
+    return true;
+}
+
+std::string format_value(double value) {
+    std::ostringstream out;
+    out << value;
+    return out.str();
+}
+
+std::string format_value(int value) { return std::to_string(value); }
+std::string format_value(int64_t value) { return std::to_string(value); }
+std::string format_value(size_t value) { return std::to_string(value); }
+std::string format_value(bool value) { return value ? "true" : "false"; }
+std::string format_value(const std::string& value) { return value; }
+
+} // namespace winter::utils::config_detail
@@ -2,23 +2,40 @@
 #include <winter/strategy/strategy_base.hpp>
 #include <winter/core/signal.hpp>
 #include <winter/core/market_data.hpp>
-#include <deque>
+#include <winter/utils/rolling_window.hpp>
+#include <winter/utils/typed_config.hpp>
 #include <unordered_map>
 #include <cmath>
 #include <algorithm>
 #include <numeric>
 
+struct MeanReversionParams {
+    double entry_threshold = 2.5;  // Z-score threshold for entry
+    double exit_threshold = 0.5;   // Z-score threshold for exit
+    int lookback_period = 20;      // Price window; applies to symbols first seen after a change
+
+    static const winter::utils::ConfigSchema<MeanReversionParams>& schema() {
+        using P = MeanReversionParams;
+        static const auto schema = winter::utils::ConfigSchema<P>()
+            .field("entry_threshold", &P::entry_threshold, 0.1, 10.0)
+            .field("exit_threshold", &P::exit_threshold, 0.0, 10.0)
+            .field("lookback_period", &P::lookback_period, 2, 10000)
+            .check("exit_threshold < entry_threshold", [](const P& p) { return p.exit_threshold < p.entry_threshold; });
+        return schema;
+    }
+};
+
 class MeanReversionStrategy : public winter::strategy::StrategyBase {
 private:
     struct StockData {
         // Price data
-        std::deque<double> prices;
+        winter::utils::RollingWindow<double> prices{20};
         double sum = 0.0;
         double sum_sq = 0.0;
         int window_size = 20;
         
         // Volume data
-        std::deque<double> volumes;
+        winter::utils::RollingWindow<double> volumes{28};
         double short_volume_ma = 0.0;  // 14-period
         double long_volume_ma = 0.0;   // 28-period
         
@@ -29,33 +46,28 @@ private:
         // Volatility
         double bb_width = 0.0;
         double atr_14 = 0.0;
-        std::deque<double> true_ranges;
+        winter::utils::RollingWindow<double> true_ranges{14};
         
         // Momentum
         double rsi = 50.0;
-        std::deque<double> gains;
-        std::deque<double> losses;
+        winter::utils::RollingWindow<double> gains{14};
+        winter::utils::RollingWindow<double> losses{14};
 
         explicit StockData() = default;
+        explicit StockData(int lookback) : prices(static_cast<size_t>(lookback)), window_size(lookback) {}
 
         void update_indicators(const winter::core::MarketData& data) {
-            // Update price and volume data
-            prices.push_back(data.price);
-            volumes.push_back(data.volume);
-            
-            // Maintain price window
-            if (prices.size() > window_size) {
+            // Update price and volume data; full windows drop their oldest value
+            if (prices.full()) {
                 double old_price = prices.front();
-                prices.pop_front();
                 sum -= old_price;
                 sum_sq -= old_price * old_price;
             }
+            prices.push_back(data.price);
+            volumes.push_back(data.volume);
             sum += data.price;
             sum_sq += data.price * data.price;
 
-            // Maintain volume window
-            if (volumes.size() > 28) volumes.pop_front();
-
             // Update indicators
             update_volume_oscillator();
             update_ema_200(data.price);
@@ -102,7 +114,6 @@ private:
                 double tr = std::abs(price - previous_close);
                 
                 true_ranges.push_back(tr);
-                if (true_ranges.size() > 14) true_ranges.pop_front();
                 
                 if (true_ranges.size() == 14) {
                     atr_14 = std::accumulate(true_ranges.begin(), true_ranges.end(), 0.0) / 14;
@@ -118,9 +129,6 @@ private:
                 gains.push_back(std::max(change, 0.0));
                 losses.push_back(std::max(-change, 0.0));
                 
-                if (gains.size() > 14) gains.pop_front();
-                if (losses.size() > 14) losses.pop_front();
-                
                 if (gains.size() == 14) {
                     double avg_gain = std::accumulate(gains.begin(), gains.end(), 0.0) / 14;
                     double avg_loss = std::accumulate(losses.begin(), losses.end(), 0.0) / 14;
@@ -132,24 +140,40 @@ private:
     };
 
     std::unordered_map<std::string, StockData> stock_data_;
-    double entry_threshold_ = 2.5;  // Z-score threshold for entry
-    double exit_threshold_ = 0.5;   // Z-score threshold for exit
+    winter::utils::ConfigSnapshot<MeanReversionParams> params_;
 
 public:
     MeanReversionStrategy(const std::string& name = "MeanReversion") : StrategyBase(name) {}
 
+    bool configure(const std::unordered_map<std::string, std::string>& config) override {
+        return configure_params(params_, config);
+    }
+
+    bool validate_config(const std::unordered_map<std::string, std::string>& config,
+                         std::vector<std::string>& errors) const override {
+        return validate_params<MeanReversionParams>(config, errors);
+    }
+
+    const MeanReversionParams& params() const { return params_.get(); }
+
     std::vector<winter::core::Signal> process_tick(const winter::core::MarketData& data) override {
         std::vector<winter::core::Signal> signals;
-        auto& stock = stock_data_[data.symbol];
+        append_signals(data, signals);
+        return signals;
+    }
+
+    void append_signals(const winter::core::MarketData& data, std::vector<winter::core::Signal>& signals) override {
+        const MeanReversionParams& params = params_.get();
+        auto& stock = stock_data_.try_emplace(data.symbol, params.lookback_period).first->second;
         stock.update_indicators(data);
 
-        if (!ready_for_trading(stock)) return signals;
+        if (!ready_for_trading(stock)) return;
 
         double z_score = calculate_z_score(stock, data.price);
         double vol_osc = volume_oscillator(stock);
 
         // Long entry conditions
-        if (z_score <= -entry_threshold_ &&
+        if (z_score <= -params.entry_threshold &&
             stock.bb_width > 0.15 &&
             vol_osc < -30 &&
             data.price > stock.ema_200 &&
@@ -159,11 +183,11 @@ public:
             signal.symbol = data.symbol;
             signal.type = winter::core::SignalType::BUY;
             signal.price = data.price;
-            signal.strength = std::min(1.0, (-z_score - entry_threshold_) / 2.0);
+            signal.strength = std::min(1.0, (-z_score - params.entry_threshold) / 2.0);
             signals.push_back(signal);
         }
         // Short entry conditions
-        else if (z_score >= entry_threshold_ &&
+        else if (z_score >= params.entry_threshold &&
                  stock.bb_width > 0.15 &&
                  vol_osc > 30 &&
                  data.price < stock.ema_200 &&
@@ -173,20 +197,66 @@ public:
             signal.symbol = data.symbol;
             signal.type = winter::core::SignalType::SELL;
             signal.price = data.price;
-            signal.strength = std::min(1.0, (z_score - entry_threshold_) / 2.0);
+            signal.strength = std::min(1.0, (z_score - params.entry_threshold) / 2.0);
             signals.push_back(signal);
         }
         // Exit conditions
-        else if (std::abs(z_score) < exit_threshold_) {
+        else if (std::abs(z_score) < params.exit_threshold) {
             winter::core::Signal signal;
             signal.symbol = data.symbol;
             signal.type = winter::core::SignalType::EXIT;
             signal.price = data.price;
-            signal.strength = 1.0 - (std::abs(z_score) / exit_threshold_);
+            signal.strength = 1.0 - (std::abs(z_score) / params.exit_threshold);
             signals.push_back(signal);
         }
+    }
 
-        return signals;
+    void serialize(winter::utils::BinaryWriter& out) const override {
+        StrategyBase::serialize(out);
+        out.write<uint64_t>(stock_data_.size());
+        for (const auto& [symbol, stock] : stock_data_) {
+            out.write_string(symbol);
+            out.write_window(stock.prices);
+            out.write(stock.sum);
+            out.write(stock.sum_sq);
+            out.write<int32_t>(stock.window_size);
+            out.write_window(stock.volumes);
+            out.write(stock.short_volume_ma);
+            out.write(stock.long_volume_ma);
+            out.write(stock.ema_200);
+            out.write<uint8_t>(stock.ema_initialized ? 1 : 0);
+            out.write(stock.bb_width);
+            out.write(stock.atr_14);
+            out.write_window(stock.true_ranges);
+            out.write(stock.rsi);
+            out.write_window(stock.gains);
+            out.write_window(stock.losses);
+        }
+    }
+
+    bool deserialize(winter::utils::BinaryReader& in) override {
+        if (!StrategyBase::deserialize(in)) return false;
+        stock_data_.clear();
+        uint64_t count = in.read<uint64_t>();
+        for (uint64_t i = 0; i < count && in.ok(); ++i) {
+            auto& stock = stock_data_.try_emplace(in.read_string(), params_->lookback_period).first->second;
+            in.read_window(stock.prices);
+            stock.sum = in.read<double>();
+            stock.sum_sq = in.read<double>();
+            stock.window_size = in.read<int32_t>();
+            in.read_window(stock.volumes);
+            stock.short_volume_ma = in.read<double>();
+            stock.long_volume_ma = in.read<double>();
+            stock.ema_200 = in.read<double>();
+            stock.ema_initialized = in.read<uint8_t>() != 0;
+            stock.bb_width = in.read<double>();
+            stock.atr_14 = in.read<double>();
+            in.read_window(stock.true_ranges);
+            stock.rsi = in.read<double>();
+            in.read_window(stock.gains);
+            in.read_window(stock.losses);
+        }
+        return in.ok();
     }
 
 private:
@@ -17,35 +17,78 @@
 #include <mutex>
 #include <random>
 #include <winter/utils/logger.hpp>
+#include <winter/utils/spsc_ring.hpp>
+#include <winter/utils/tsc_clock.hpp>
+#include <winter/utils/thread_pool.hpp>
+#include <winter/utils/typed_config.hpp>
 #include <thread>
-#include <queue>
-#include <condition_variable>
 #include <atomic>
 #include <sstream>
 #include <iomanip>
 #include <memory>
 
-// Global map to store z-scores for each symbol
-extern std::unordered_map<std::string, double> last_z_scores;
+// Tunable parameters, parsed once per configure() and read as plain fields
+struct StatArbParams {
+    double entry_threshold = 1.2;       // Medium-term z-score to enter
+    double exit_threshold = 0.1;        // Mean reversion exit
+    double profit_target_mult = 0.25;   // Share of the best excursion to lock in
+    double trailing_stop = 0.85;        // Give-back of peak profit that closes
+    double max_position_pct = 0.0015;   // Position sizing
+    double stop_loss_pct = 0.012;
+    int max_holding_hours = 48;
+    int min_holding_hours = 3;
+    double max_sector_allocation = 0.20;
+    double min_cash_reserve_pct = 0.30;
+    double emergency_cash_level = 0.15;
+    bool verbose_logging = true;
+    int log_every_n_trades = 500;
+
+    static const winter::utils::ConfigSchema<StatArbParams>& schema() {
+        using P = StatArbParams;
+        static const auto schema = winter::utils::ConfigSchema<P>()
+            .field("entry_threshold", &P::entry_threshold, 0.1, 10.0)
+            .field("exit_threshold", &P::exit_threshold, 0.0, 10.0)
+            .field("profit_target_mult", &P::profit_target_mult, 0.0, 1.0)
+            .field("trailing_stop", &P::trailing_stop, 0.0, 1.0)
+            .field("max_position_pct", &P::max_position_pct, 0.0, 1.0)
+            .field("stop_loss_pct", &P::stop_loss_pct, 0.0, 1.0)
+            .field("max_holding_hours", &P::max_holding_hours, 0, 24 * 365)
+            .field("min_holding_hours", &P::min_holding_hours, 0, 24 * 365)
+            .field("max_sector_allocation", &P::max_sector_allocation, 0.0, 1.0)
+            .field("min_cash_reserve_pct", &P::min_cash_reserve_pct, 0.0, 1.0)
+            .field("emergency_cash_level", &P::emergency_cash_level, 0.0, 1.0)
+            .field("verbose_logging", &P::verbose_logging)
+            .field("log_every_n_trades", &P::log_every_n_trades, 1, 1000000)
+            .check("exit_threshold < entry_threshold", [](const P& p) { return p.exit_threshold < p.entry_threshold; })
+            .check("min_holding_hours <= max_holding_hours",
+                   [](const P& p) { return p.min_holding_hours <= p.max_holding_hours; });
+        return schema;
+    }
+};
 
 class StatisticalArbitrageStrategy : public winter::strategy::StrategyBase {
 private:
     // OPTIMIZED PARALLEL PROCESSING with enhanced queue management
+    // Symbols are sharded; each shard is drained by at most one task on the
+    // shared ThreadPool at a time, so its ticks are still handled in order.
+    // Ticks are copied into a preallocated ring per shard: the strategy thread
+    // is its only producer and the shard's drain its only consumer.
     const int MAX_THREADS = std::min(12, static_cast<int>(std::thread::hardware_concurrency()));
-    std::vector<std::thread> worker_threads;
-    std::vector<std::queue<std::shared_ptr<winter::core::MarketData>>> data_queues;
-    std::unique_ptr<std::mutex[]> queue_mutexes;
-    std::unique_ptr<std::condition_variable[]> queue_cvs;
+    std::unique_ptr<winter::utils::SpscRing<winter::core::MarketData>[]> shard_rings;
+    std::unique_ptr<std::atomic<bool>[]> shard_scheduled;  // A drain task is queued or running
+    std::vector<std::vector<winter::core::MarketData>> shard_batches;  // Reused by drains
+    std::vector<std::vector<winter::core::Signal>> shard_signals;
     std::atomic<bool> running{true};
-    std::atomic<int> active_workers{0};
-    std::mutex signals_mutex;
+    std::atomic<int> active_workers{0};  // Drain tasks in flight
+    mutable std::mutex signals_mutex;
     std::vector<winter::core::Signal> pending_signals;
     
     // ENHANCED QUEUE MANAGEMENT
-    const size_t MAX_QUEUE_SIZE = 25000000; // Balanced queue size
-    std::unique_ptr<std::atomic<size_t>[]> queue_sizes;
+    static constexpr size_t SHARD_RING_CAPACITY = 16384;  // Ticks waiting per shard
     std::atomic<size_t> dropped_messages{0};
     std::atomic<size_t> processed_messages{0};
+    std::atomic<size_t> enqueued_messages{0};
+    std::atomic<size_t> completed_messages{0};  // Never reset, unlike processed_messages
     
     // OPTIMIZED BATCH PROCESSING
     const size_t BATCH_SIZE = 100; // Optimized batch size
@@ -112,14 +155,9 @@ private:
     
     std::vector<std::pair<std::string, std::string>> active_pairs;
     
-    // RESTORED: Advanced entry/exit rules with multiple timeframes
-    double ENTRY_THRESHOLD = 1.2;      // Optimized threshold
-    double ENTRY_CONFIRMATION = 0.08;  // Confirmation requirement
-    double EXIT_THRESHOLD = 0.1;       // Mean reversion exit
-    double PROFIT_TARGET_MULT = 0.25;  // Profit target multiplier
-    double TRAILING_STOP_PCT = 0.85;   // Trailing stop percentage
+    // Entry/exit, sizing, holding and cash rules; see StatArbParams
+    winter::utils::ConfigSnapshot<StatArbParams> params_;
     
-    const double MAX_POSITION_PCT = 0.0015; // Position sizing
     const double CAPITAL = 5000000.0;
     
     // RESTORED: Multi-timeframe parameters
@@ -127,27 +165,11 @@ private:
     static constexpr int MEDIUM_LOOKBACK = 15; // Medium-term lookback
     static constexpr int LONG_LOOKBACK = 25;   // Long-term lookback
     
-    // RESTORED: Time-based parameters
-    const int MAX_HOLDING_PERIODS = 48; // Maximum holding period in hours
-    const int MIN_HOLDING_PERIODS = 3;  // Minimum holding period
-    
-    // RESTORED: Advanced risk management
-    const double STOP_LOSS_PCT = 0.012;  // Stop loss percentage
-    const double MAX_SECTOR_ALLOCATION = 0.20; // Sector allocation limit
-    
     // RESTORED: Enhanced cash management
-    const double MIN_CASH_RESERVE_PCT = 0.30; // Minimum cash reserve
-    const double EMERGENCY_CASH_LEVEL = 0.15; // Emergency cash level
     std::atomic<double> available_cash{CAPITAL};
     std::mutex cash_mutex;
     
-    // RESTORED: Market making parameters
-    bool market_making_enabled = true;
-    double market_making_spread_threshold = 0.0008;
-    
     // RESTORED: Enhanced logging control
-    bool verbose_logging = true;
-    int log_every_n_trades = 500; // More frequent logging
     std::atomic<int> trade_counter{0};
     
     struct PairData {
@@ -333,10 +355,10 @@ private:
     
     // RESTORED: Full data structures
     std::unordered_map<std::string, PairData> pair_data;
-    std::mutex pair_data_mutex;
+    mutable std::mutex pair_data_mutex;
     
     std::unordered_map<std::string, double> latest_prices;
-    std::mutex prices_mutex;
+    mutable std::mutex prices_mutex;
     
     // RESTORED: Per-thread price history
     std::vector<std::unordered_map<std::string, std::deque<double>>> thread_price_history;
@@ -349,12 +371,12 @@ private:
     
     // RESTORED: Sector allocation tracking
     std::unordered_map<std::string, double> sector_allocation;
-    std::mutex sector_mutex;
+    mutable std::mutex sector_mutex;
     
     // RESTORED: Trading day tracking
     std::string current_day = "";
     bool unwinding_mode = false;
-    std::mutex day_mutex;
+    mutable std::mutex day_mutex;
     
     // RESTORED: Symbol tracking
     std::unordered_set<std::string> seen_symbols;
@@ -371,8 +393,8 @@ private:
     std::mt19937 rng;
     
     // RESTORED: Performance monitoring
-    std::chrono::time_point<std::chrono::high_resolution_clock> last_stats_time;
-    std::chrono::time_point<std::chrono::high_resolution_clock> last_cash_check_time;
+    uint64_t last_stats_tsc = 0;  // Throughput stats measure the machine, so they stay on wall time
+    int64_t last_cash_check_ns = 0;  // Strategy clock (event time in backtests)
     const int CASH_CHECK_INTERVAL_MS = 750; // Balanced interval
     
     // RESTORED: Adaptive throttling
@@ -386,16 +408,18 @@ public:
         active_pairs = all_possible_pairs;
         
         // Initialize enhanced thread structures
-        data_queues.resize(MAX_THREADS);
-        queue_mutexes = std::make_unique<std::mutex[]>(MAX_THREADS);
-        queue_cvs = std::make_unique<std::condition_variable[]>(MAX_THREADS);
-        queue_sizes = std::make_unique<std::atomic<size_t>[]>(MAX_THREADS);
+        shard_rings = std::make_unique<winter::utils::SpscRing<winter::core::MarketData>[]>(MAX_THREADS);
+        shard_scheduled = std::make_unique<std::atomic<bool>[]>(MAX_THREADS);
+        shard_batches.resize(MAX_THREADS);
+        shard_signals.resize(MAX_THREADS);
         
         thread_price_history.resize(MAX_THREADS);
         history_mutexes.resize(MAX_THREADS);
         for (int i = 0; i < MAX_THREADS; i++) {
             history_mutexes[i] = std::make_unique<std::mutex>();
-            queue_sizes[i] = 0;
+            shard_rings[i].reset(SHARD_RING_CAPACITY);
+            shard_scheduled[i] = false;
+            shard_batches[i].resize(BATCH_SIZE * 2);
         }
         
         thread_volatility.resize(MAX_THREADS);
@@ -428,8 +452,7 @@ public:
         winter::utils::Logger::info() << "Trading " << active_pairs.size() 
                                   << " hardcoded cointegrated pairs" << winter::utils::Logger::endl;
         
-        last_stats_time = std::chrono::high_resolution_clock::now();
-        last_cash_check_time = std::chrono::high_resolution_clock::now();
+        last_stats_tsc = winter::utils::tsc_now();
         
         start_worker_threads();
     }
@@ -438,6 +461,17 @@ public:
         stop_worker_threads();
     }
     
+    bool configure(const std::unordered_map<std::string, std::string>& config) override {
+        return configure_params(params_, config);
+    }
+    
+    bool validate_config(const std::unordered_map<std::string, std::string>& config,
+                         std::vector<std::string>& errors) const override {
+        return validate_params<StatArbParams>(config, errors);
+    }
+    
+    const StatArbParams& params() const { return params_.get(); }
+    
     std::vector<winter::core::Signal> process_tick(const winter::core::MarketData& data) override {
         try {
             // Filter active symbols
@@ -445,37 +479,40 @@ public:
                 return {};
             }
             
-            auto data_ptr = std::make_shared<winter::core::MarketData>(data);
             int thread_id = get_thread_for_symbol(data.symbol);
+            auto& ring = shard_rings[thread_id];
             
-            // Enhanced queue management
-            bool enqueued = false;
-            {
-                std::lock_guard<std::mutex> lock(queue_mutexes[thread_id]);
-                if (queue_sizes[thread_id].load() < MAX_QUEUE_SIZE) {
-                    data_queues[thread_id].push(data_ptr);
-                    queue_sizes[thread_id]++;
-                    enqueued = true;
-                }
+            // A full ring waits for its drain instead of losing the tick; the
+            // engine's queue policy decides what happens further upstream
+            bool enqueued = ring.push(data);
+            while (!enqueued && running) {
+                schedule_shard(thread_id);
+                std::this_thread::yield();
+                enqueued = ring.push(data);
             }
             
             if (enqueued) {
-                queue_cvs[thread_id].notify_one();
+                enqueued_messages++;
+                // Pairs with the fence in drain_shard: either the drain sees
+                // this tick or schedule_shard sees its flag cleared
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                schedule_shard(thread_id);
             } else {
                 dropped_messages++;
                 if (dropped_messages % 25000 == 0) {
-                    winter::utils::Logger::error() << "Market data queue full, dropping data for " 
+                    winter::utils::Logger::error() << "Strategy stopped, dropping data for " 
                                                << data.symbol << winter::utils::Logger::endl;
                     log_performance_stats();
                 }
             }
             
             // Periodic cash management
-            auto now = std::chrono::high_resolution_clock::now();
-            auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(now - last_cash_check_time).count();
-            if (duration > CASH_CHECK_INTERVAL_MS) {
+            int64_t now_ns = clock().now_ns();
+            if (last_cash_check_ns == 0) {
+                last_cash_check_ns = now_ns;
+            } else if (now_ns - last_cash_check_ns > CASH_CHECK_INTERVAL_MS * 1000000LL) {
                 check_and_free_capital();
-                last_cash_check_time = now;
+                last_cash_check_ns = now_ns;
             }
             
             // Return pending signals
@@ -494,6 +531,228 @@ public:
         }
     }
     
+    void serialize(winter::utils::BinaryWriter& out) const override {
+        // Called with the engine paused, so no ticks arrive while the shards
+        // finish the ones already handed to them; the snapshot then matches
+        // the engine's tick offset. Only a stopped strategy leaves ticks behind.
+        while (completed_messages.load() < enqueued_messages.load()) {
+            if (!running) {
+                winter::utils::Logger::error() << "StatArb stopped with "
+                                               << enqueued_messages.load() - completed_messages.load()
+                                               << " ticks undelivered; its state misses them"
+                                               << winter::utils::Logger::endl;
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        
+        StrategyBase::serialize(out);
+        
+        {
+            std::lock_guard<std::mutex> lock(pair_data_mutex);
+            out.write<uint64_t>(pair_data.size());
+            for (const auto& [key, pair] : pair_data) {
+                out.write_string(key);
+                out.write_string(pair.symbol1);
+                out.write_string(pair.symbol2);
+                out.write_string(pair.sector);
+                out.write_deque(pair.spread_history_short);
+                out.write_deque(pair.spread_history_medium);
+                out.write_deque(pair.spread_history_long);
+                out.write<int32_t>(pair.position1);
+                out.write<int32_t>(pair.position2);
+                for (double value : {pair.beta, pair.half_life, pair.entry_price1, pair.entry_price2,
+                                     pair.entry_z_score, pair.peak_profit, pair.max_favorable_excursion,
+                                     pair.entry_time, pair.prev_z_score,
+                                     pair.spread_mean_short, pair.spread_std_short,
+                                     pair.spread_mean_medium, pair.spread_std_medium,
+                                     pair.spread_mean_long, pair.spread_std_long}) {
+                    out.write(value);
+                }
+                out.write<int32_t>(pair.signals_generated);
+                out.write<int32_t>(pair.signals_filled);
+                out.write<int32_t>(pair.trade_count);
+                for (double value : {pair.total_pnl, pair.max_drawdown, pair.current_position_value,
+                                     pair.sharpe_ratio}) {
+                    out.write(value);
+                }
+                out.write_deque(pair.returns);
+                out.write(pair.cointegration_score);
+                out.write(pair.correlation_coefficient);
+            }
+        }
+        
+        {
+            std::lock_guard<std::mutex> lock(prices_mutex);
+            out.write_map(latest_prices);
+        }
+        
+        // Per-thread maps are flattened by symbol; restore re-shards them
+        uint64_t history_count = 0;
+        for (size_t t = 0; t < thread_price_history.size(); ++t) {
+            std::lock_guard<std::mutex> lock(*history_mutexes[t]);
+            history_count += thread_price_history[t].size();
+        }
+        out.write(history_count);
+        for (size_t t = 0; t < thread_price_history.size(); ++t) {
+            std::lock_guard<std::mutex> lock(*history_mutexes[t]);
+            for (const auto& [symbol, history] : thread_price_history[t]) {
+                out.write_string(symbol);
+                out.write_deque(history);
+            }
+        }
+        
+        std::unordered_map<std::string, double> volatility;
+        for (size_t t = 0; t < thread_volatility.size(); ++t) {
+            std::lock_guard<std::mutex> lock(*volatility_mutexes[t]);
+            volatility.insert(thread_volatility[t].begin(), thread_volatility[t].end());
+        }
+        out.write_map(volatility);
+        out.write(market_volatility);
+        
+        {
+            std::lock_guard<std::mutex> lock(sector_mutex);
+            out.write_map(sector_allocation);
+        }
+        {
+            std::lock_guard<std::mutex> lock(day_mutex);
+            out.write_string(current_day);
+            out.write<uint8_t>(unwinding_mode ? 1 : 0);
+        }
+        
+        out.write(available_cash.load());
+        out.write(current_fill_rate);
+        out.write<int32_t>(total_signals.load());
+        out.write<int32_t>(filled_signals.load());
+        out.write<int32_t>(trade_counter.load());
+        out.write<int32_t>(throttle_level.load());
+        out.write(last_cash_check_ns);
+        
+        {
+            std::lock_guard<std::mutex> lock(signals_mutex);
+            out.write<uint64_t>(pending_signals.size());
+            for (const auto& signal : pending_signals) {
+                out.write_string(signal.symbol);
+                out.write(signal.type);
+                out.write(signal.strength);
+                out.write(signal.price);
+            }
+        }
+        
+        std::ostringstream rng_state;
+        rng_state << rng;
+        out.write_string(rng_state.str());
+    }
+    
+    bool deserialize(winter::utils::BinaryReader& in) override {
+        if (!StrategyBase::deserialize(in)) {
+            return false;
+        }
+        
+        {
+            std::lock_guard<std::mutex> lock(pair_data_mutex);
+            uint64_t pair_count = in.read<uint64_t>();
+            for (uint64_t i = 0; i < pair_count && in.ok(); ++i) {
+                std::string key = in.read_string();
+                PairData pair;
+                pair.symbol1 = in.read_string();
+                pair.symbol2 = in.read_string();
+                pair.sector = in.read_string();
+                pair.spread_history_short = in.read_deque<double>();
+                pair.spread_history_medium = in.read_deque<double>();
+                pair.spread_history_long = in.read_deque<double>();
+                pair.position1 = in.read<int32_t>();
+                pair.position2 = in.read<int32_t>();
+                for (double* value : {&pair.beta, &pair.half_life, &pair.entry_price1, &pair.entry_price2,
+                                      &pair.entry_z_score, &pair.peak_profit, &pair.max_favorable_excursion,
+                                      &pair.entry_time, &pair.prev_z_score,
+                                      &pair.spread_mean_short, &pair.spread_std_short,
+                                      &pair.spread_mean_medium, &pair.spread_std_medium,
+                                      &pair.spread_mean_long, &pair.spread_std_long}) {
+                    *value = in.read<double>();
+                }
+                pair.signals_generated = in.read<int32_t>();
+                pair.signals_filled = in.read<int32_t>();
+                pair.trade_count = in.read<int32_t>();
+                for (double* value : {&pair.total_pnl, &pair.max_drawdown, &pair.current_position_value,
+                                      &pair.sharpe_ratio}) {
+                    *value = in.read<double>();
+                }
+                pair.returns = in.read_deque<double>();
+                pair.cointegration_score = in.read<double>();
+                pair.correlation_coefficient = in.read<double>();
+                pair_data[key] = std::move(pair);
+            }
+        }
+        
+        {
+            std::lock_guard<std::mutex> lock(prices_mutex);
+            latest_prices = in.read_map<double>();
+        }
+        
+        for (size_t t = 0; t < thread_price_history.size(); ++t) {
+            std::lock_guard<std::mutex> lock(*history_mutexes[t]);
+            thread_price_history[t].clear();
+        }
+        uint64_t history_count = in.read<uint64_t>();
+        for (uint64_t i = 0; i < history_count && in.ok(); ++i) {
+            std::string symbol = in.read_string();
+            auto history = in.read_deque<double>();
+            int t = get_thread_for_symbol(symbol);
+            std::lock_guard<std::mutex> lock(*history_mutexes[t]);
+            thread_price_history[t][symbol] = std::move(history);
+        }
+        
+        auto volatility = in.read_map<double>();
+        for (size_t t = 0; t < thread_volatility.size(); ++t) {
+            std::lock_guard<std::mutex> lock(*volatility_mutexes[t]);
+            thread_volatility[t].clear();
+        }
+        for (const auto& [symbol, value] : volatility) {
+            int t = get_thread_for_symbol(symbol);
+            std::lock_guard<std::mutex> lock(*volatility_mutexes[t]);
+            thread_volatility[t][symbol] = value;
+        }
+        market_volatility = in.read<double>();
+        
+        {
+            std::lock_guard<std::mutex> lock(sector_mutex);
+            sector_allocation = in.read_map<double>();
+        }
+        {
+            std::lock_guard<std::mutex> lock(day_mutex);
+            current_day = in.read_string();
+            unwinding_mode = in.read<uint8_t>() != 0;
+        }
+        
+        available_cash = in.read<double>();
+        current_fill_rate = in.read<double>();
+        total_signals = in.read<int32_t>();
+        filled_signals = in.read<int32_t>();
+        trade_counter = in.read<int32_t>();
+        throttle_level = in.read<int32_t>();
+        last_cash_check_ns = in.read<int64_t>();
+        
+        {
+            std::lock_guard<std::mutex> lock(signals_mutex);
+            pending_signals.clear();
+            uint64_t signal_count = in.read<uint64_t>();
+            for (uint64_t i = 0; i < signal_count && in.ok(); ++i) {
+                winter::core::Signal signal;
+                signal.symbol = in.read_string();
+                signal.type = in.read<winter::core::SignalType>();
+                signal.strength = in.read<double>();
+                signal.price = in.read<double>();
+                pending_signals.push_back(std::move(signal));
+            }
+        }
+        
+        std::istringstream rng_state(in.read_string());
+        rng_state >> rng;
+        
+        return in.ok();
+    }
+    
 private:
     void assign_symbol_to_thread(const std::string& symbol) {
         std::lock_guard<std::mutex> lock(mapping_mutex);
@@ -552,7 +811,7 @@ private:
         double cash_pct = avail_capital / CAPITAL;
         
         // Emergency capital management
-        if (cash_pct < EMERGENCY_CASH_LEVEL) {
+        if (cash_pct < params_->emergency_cash_level) {
             winter::utils::Logger::info() << "Emergency cash management triggered (" 
                                       << (cash_pct * 100.0) 
                                       << "% available)" << winter::utils::Logger::endl;
@@ -603,11 +862,11 @@ private:
     
     // RESTORED: Performance statistics logging
     void log_performance_stats() {
-        auto now = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::seconds>(now - last_stats_time).count();
+        uint64_t now = winter::utils::tsc_now();
+        double duration = winter::utils::TscClock::instance().elapsed_ns(last_stats_tsc, now) / 1e9;
         
-        if (duration > 0) {
-            double msgs_per_sec = processed_messages.load() / static_cast<double>(duration);
+        if (duration >= 1.0) {
+            double msgs_per_sec = processed_messages.load() / duration;
             double drop_rate = 0.0;
             size_t total_processed = processed_messages.load();
             size_t total_dropped = dropped_messages.load();
@@ -625,7 +884,7 @@ private:
             winter::utils::Logger::info() << "Performance: " << msgs_per_sec << " msgs/sec, " 
                                       << drop_rate << "% drop rate, " 
                                       << (current_fill_rate * 100.0) << "% fill rate, "
-                                      << active_workers.load() << "/" << MAX_THREADS << " workers, "
+                                      << active_workers.load() << "/" << MAX_THREADS << " shards draining, "
                                       << "Cash: " << (available_cash.load() / CAPITAL * 100.0) << "%"
                                       << winter::utils::Logger::endl;
             
@@ -641,118 +900,98 @@ private:
             }
             
             processed_messages = 0;
-            last_stats_time = now;
+            last_stats_tsc = now;
         }
     }
     
     void start_worker_threads() {
         running = true;
-        for (int i = 0; i < MAX_THREADS; i++) {
-            worker_threads.emplace_back([this, i]() {
-                try {
-                    worker_function(i);
-                } catch (...) {
-                    // Silent error handling
-                }
-            });
-        }
-        winter::utils::Logger::info() << "Started " << MAX_THREADS << " worker threads for parallel processing" 
+        winter::utils::Logger::info() << "Processing " << MAX_THREADS << " symbol shards on "
+                                  << winter::utils::ThreadPool::shared().size() << " shared pool workers"
                                   << winter::utils::Logger::endl;
     }
     
     void stop_worker_threads() {
         running = false;
-        for (int i = 0; i < MAX_THREADS; i++) {
-            queue_cvs[i].notify_all();
-        }
-        for (auto& thread : worker_threads) {
-            if (thread.joinable()) {
-                thread.join();
-            }
+        // Drain tasks hold this pointer; wait for the last one to return
+        while (active_workers.load() > 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
         }
-        worker_threads.clear();
     }
     
-    void worker_function(int thread_id) {
+    void schedule_shard(int thread_id) {
+        if (!running || shard_scheduled[thread_id].exchange(true)) {
+            return;
+        }
         active_workers++;
+        winter::utils::ThreadPool::shared().post([this, thread_id]() { drain_shard(thread_id); });
+    }
+    
+    // Processes one batch from a shard's queue, then hands the worker back to
+    // the pool and reschedules itself if more ticks are waiting
+    void drain_shard(int thread_id) {
+        auto& ring = shard_rings[thread_id];
+        auto& batch_data = shard_batches[thread_id];  // Slots keep their symbol buffers between drains
+        auto& batch_signals = shard_signals[thread_id];
+        
+        size_t items_to_collect = BATCH_SIZE;
+        
+        // Adaptive batch sizing
+        if (ring.size() > SHARD_RING_CAPACITY * 7 / 10) {
+            items_to_collect = BATCH_SIZE * 2;
+        }
         
-        std::vector<std::shared_ptr<winter::core::MarketData>> batch_data;
-        batch_data.reserve(BATCH_SIZE);
-        std::vector<winter::core::Signal> batch_signals;
+        size_t collected = 0;
+        while (collected < items_to_collect && ring.pop(batch_data[collected])) {
+            ++collected;
+        }
         
-        while (running) {
-            batch_data.clear();
-            bool has_data = false;
-            
-            size_t current_queue_size = queue_sizes[thread_id].load();
-            size_t items_to_collect = BATCH_SIZE;
-            
-            // Adaptive batch sizing
-            if (current_queue_size > MAX_QUEUE_SIZE * 0.7) {
-                items_to_collect = std::min(BATCH_SIZE * 2, current_queue_size);
-            }
-            
-            {
-                std::unique_lock<std::mutex> lock(queue_mutexes[thread_id]);
-                queue_cvs[thread_id].wait_for(lock, std::chrono::milliseconds(2), [this, thread_id] {
-                    return !data_queues[thread_id].empty() || !running; 
-                });
-                
-                if (!running && data_queues[thread_id].empty()) {
-                    break;
-                }
-                
-                for (size_t i = 0; i < items_to_collect; ++i) {
-                    if (data_queues[thread_id].empty()) break;
-                    
-                    batch_data.push_back(data_queues[thread_id].front());
-                    data_queues[thread_id].pop();
-                    queue_sizes[thread_id]--;
-                    has_data = true;
-                }
-            }
-            
-            if (has_data) {
-                try {
-                    batch_signals.clear();
-                    for (const auto& data_ptr : batch_data) {
-                        if (!data_ptr) continue;
-                        
-                        auto signals = process_data_internal(*data_ptr, thread_id);
-                        processed_messages++;
-                        
-                        if (!signals.empty()) {
-                            batch_signals.insert(batch_signals.end(), signals.begin(), signals.end());
-                        }
-                    }
+        if (running && collected > 0) {
+            try {
+                // One snapshot per batch: a reload mid-drain neither frees the
+                // parameters under us nor mixes old and new ones in a decision
+                const auto params = params_.snapshot();
+                batch_signals.clear();
+                for (size_t i = 0; i < collected; ++i) {
+                    auto signals = process_data_internal(batch_data[i], thread_id, *params);
+                    processed_messages++;
                     
-                    if (!batch_signals.empty()) {
-                        std::lock_guard<std::mutex> lock(signals_mutex);
-                        pending_signals.insert(pending_signals.end(), batch_signals.begin(), batch_signals.end());
+                    if (!signals.empty()) {
+                        batch_signals.insert(batch_signals.end(), signals.begin(), signals.end());
                     }
-                } catch (...) {
-                    // Silent error handling
                 }
+                
+                if (!batch_signals.empty()) {
+                    std::lock_guard<std::mutex> lock(signals_mutex);
+                    pending_signals.insert(pending_signals.end(), batch_signals.begin(), batch_signals.end());
+                }
+            } catch (...) {
+                // Silent error handling
             }
             
             // Adaptive throttling
             if (throttling_enabled && throttle_level > 0) {
                 std::this_thread::sleep_for(std::chrono::microseconds(throttle_level * 75));
             }
-            
-            if (!has_data) {
-                std::this_thread::sleep_for(std::chrono::microseconds(250));
-            }
         }
         
+        // Settled even if processing threw or we are stopping, so serialize() never waits on them
+        completed_messages += collected;
+        
+        // A producer that saw the flag still set relies on this re-check
+        shard_scheduled[thread_id] = false;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!ring.empty()) {
+            schedule_shard(thread_id);
+        }
         active_workers--;
     }
     
-    bool check_cash_for_position(double position_value) {
+    bool check_cash_for_position(double position_value, const StatArbParams& p) {
         double avail = available_cash.load();
         double current_cash_pct = avail / CAPITAL;
         
-        if (current_cash_pct < MIN_CASH_RESERVE_PCT || avail < position_value) {
+        if (current_cash_pct < p.min_cash_reserve_pct || avail < position_value) {
             return false;
         }
         
@@ -767,7 +1006,8 @@ private:
     }
     
     // RESTORED: Enhanced sector allocation checking
-    bool check_sector_allocation(const std::string& sector, double additional_allocation) {
+    bool check_sector_allocation(const std::string& sector, double additional_allocation,
+                                 const StatArbParams& p) {
         std::lock_guard<std::mutex> lock(sector_mutex);
         
         double current_allocation = 0.0;
@@ -777,11 +1017,12 @@ private:
         }
         
         double new_allocation_pct = (current_allocation + additional_allocation) / CAPITAL;
-        return new_allocation_pct <= MAX_SECTOR_ALLOCATION;
+        return new_allocation_pct <= p.max_sector_allocation;
     }
     
     // RESTORED: Full data processing with all features
-    std::vector<winter::core::Signal> process_data_internal(const winter::core::MarketData& data, int thread_id) {
+    std::vector<winter::core::Signal> process_data_internal(const winter::core::MarketData& data, int thread_id,
+                                                          const StatArbParams& p) {
         std::vector<winter::core::Signal> signals;
         
         try {
@@ -865,16 +1106,16 @@ private:
                                 }
                                 
                                 // Multiple exit conditions
-                                bool stop_loss_hit = unrealized_pnl < -STOP_LOSS_PCT * position_value;
+                                bool stop_loss_hit = unrealized_pnl < -p.stop_loss_pct * position_value;
                                 
                                 // RESTORED: Trailing stop logic
                                 bool trailing_stop_hit = pd.peak_profit > 0.01 && // Only after 1% profit
-                                                        (pd.peak_profit - profit_pct) >= TRAILING_STOP_PCT * pd.peak_profit;
+                                                        (pd.peak_profit - profit_pct) >= p.trailing_stop * pd.peak_profit;
                                 
                                 // RESTORED: Time-based exit with minimum holding period
                                 double holding_time_hours = (data.timestamp - pd.entry_time) / (3600.0 * 1000000.0);
-                                bool time_based_exit = holding_time_hours > MAX_HOLDING_PERIODS;
-                                bool min_holding_met = holding_time_hours >= MIN_HOLDING_PERIODS;
+                                bool time_based_exit = holding_time_hours > p.max_holding_hours;
+                                bool min_holding_met = holding_time_hours >= p.min_holding_hours;
                                 
                                 if ((stop_loss_hit || (trailing_stop_hit && min_holding_met) || time_based_exit)) {
                                     auto stop_signals = generate_exit_signals(pd, price1, price2);
@@ -883,7 +1124,7 @@ private:
                                     std::string exit_reason = stop_loss_hit ? "Stop Loss" : 
                                                             trailing_stop_hit ? "Trailing Stop" : "Time-based Exit";
                                     
-                                    if (verbose_logging || (++trade_counter % log_every_n_trades == 0)) {
+                                    if (p.verbose_logging || (++trade_counter % p.log_every_n_trades == 0)) {
                                         winter::utils::Logger::info() << "EXIT (" << exit_reason << "): " 
                                                               << (pd.position1 > 0 ? "SELL " : "BUY ") << pair.first 
                                                               << ", " 
@@ -929,15 +1170,11 @@ private:
                             double z_score_long = calculate_z_score(pd.spread_history_long, spread, 
                                                                   pd.spread_mean_long, pd.spread_std_long);
                             
-                            // Store z-scores
-                            last_z_scores[pair.first] = z_score_medium;
-                            last_z_scores[pair.second] = z_score_medium;
-                            
                             // RESTORED: Entry confirmation logic
                             bool entry_confirmed = false;
-                            if (z_score_medium > ENTRY_THRESHOLD && z_score_medium < pd.prev_z_score) {
+                            if (z_score_medium > p.entry_threshold && z_score_medium < pd.prev_z_score) {
                                 entry_confirmed = true;
-                            } else if (z_score_medium < -ENTRY_THRESHOLD && z_score_medium > pd.prev_z_score) {
+                            } else if (z_score_medium < -p.entry_threshold && z_score_medium > pd.prev_z_score) {
                                 entry_confirmed = true;
                             }
                             
@@ -957,24 +1194,24 @@ private:
                             // Entry logic with enhanced conditions
                             if (pd.position1 == 0 && pd.position2 == 0) {
                                 double current_cash_pct = available_cash.load() / CAPITAL;
-                                if (current_cash_pct < MIN_CASH_RESERVE_PCT) {
+                                if (current_cash_pct < p.min_cash_reserve_pct) {
                                     continue;
                                 }
                                 
                                 // RESTORED: Multi-timeframe entry confirmation
-                                bool strong_signal = (std::abs(z_score_short) > ENTRY_THRESHOLD * 0.8) &&
-                                                   (std::abs(z_score_medium) > ENTRY_THRESHOLD) &&
-                                                   (std::abs(z_score_long) > ENTRY_THRESHOLD * 0.6);
+                                bool strong_signal = (std::abs(z_score_short) > p.entry_threshold * 0.8) &&
+                                                   (std::abs(z_score_medium) > p.entry_threshold) &&
+                                                   (std::abs(z_score_long) > p.entry_threshold * 0.6);
                                 
-                                if (z_score_medium > ENTRY_THRESHOLD && entry_confirmed && strong_signal) {
+                                if (z_score_medium > p.entry_threshold && entry_confirmed && strong_signal) {
                                     // Check sector allocation
-                                    int qty1 = calculate_position_size(pair.first, price1, z_score_medium, thread_id, pd);
-                                    int qty2 = calculate_position_size(pair.second, price2, z_score_medium, thread_id, pd);
+                                    int qty1 = calculate_position_size(pair.first, price1, z_score_medium, thread_id, pd, p);
+                                    int qty2 = calculate_position_size(pair.second, price2, z_score_medium, thread_id, pd, p);
                                     
                                     double position_value = qty1 * price1 + qty2 * price2;
                                     
-                                    if (!check_cash_for_position(position_value) || 
-                                        !check_sector_allocation(pd.sector, position_value)) {
+                                    if (!check_cash_for_position(position_value, p) || 
+                                        !check_sector_allocation(pd.sector, position_value, p)) {
                                         continue;
                                     }
                                     
@@ -1009,21 +1246,21 @@ private:
                                     total_signals += 2;
                                     filled_signals += 2;
                                     
-                                    if (verbose_logging || (++trade_counter % log_every_n_trades == 0)) {
+                                    if (p.verbose_logging || (++trade_counter % p.log_every_n_trades == 0)) {
                                         winter::utils::Logger::info() << "ENTRY: SELL " << pair.first << ", BUY " << pair.second 
                                                               << " | Z-score: " << z_score_medium 
                                                               << " | Beta: " << pd.beta << winter::utils::Logger::endl;
                                     }
                                 }
-                                else if (z_score_medium < -ENTRY_THRESHOLD && entry_confirmed && strong_signal) {
+                                else if (z_score_medium < -p.entry_threshold && entry_confirmed && strong_signal) {
                                     // Similar logic for long spread entry
-                                    int qty1 = calculate_position_size(pair.first, price1, -z_score_medium, thread_id, pd);
-                                    int qty2 = calculate_position_size(pair.second, price2, -z_score_medium, thread_id, pd);
+                                    int qty1 = calculate_position_size(pair.first, price1, -z_score_medium, thread_id, pd, p);
+                                    int qty2 = calculate_position_size(pair.second, price2, -z_score_medium, thread_id, pd, p);
                                     
                                     double position_value = qty1 * price1 + qty2 * price2;
                                     
-                                    if (!check_cash_for_position(position_value) || 
-                                        !check_sector_allocation(pd.sector, position_value)) {
+                                    if (!check_cash_for_position(position_value, p) || 
+                                        !check_sector_allocation(pd.sector, position_value, p)) {
                                         continue;
                                     }
                                     
@@ -1056,7 +1293,7 @@ private:
                                     total_signals += 2;
                                     filled_signals += 2;
                                     
-                                    if (verbose_logging || (++trade_counter % log_every_n_trades == 0)) {
+                                    if (p.verbose_logging || (++trade_counter % p.log_every_n_trades == 0)) {
                                         winter::utils::Logger::info() << "ENTRY: BUY " << pair.first << ", SELL " << pair.second 
                                                               << " | Z-score: " << z_score_medium 
                                                               << " | Beta: " << pd.beta << winter::utils::Logger::endl;
@@ -1065,16 +1302,16 @@ private:
                             }
                             else {
                                 // RESTORED: Enhanced exit conditions
-                                bool mean_reversion_exit = (pd.position1 > 0 && z_score_medium > -EXIT_THRESHOLD) ||
-                                                        (pd.position1 < 0 && z_score_medium < EXIT_THRESHOLD);
+                                bool mean_reversion_exit = (pd.position1 > 0 && z_score_medium > -p.exit_threshold) ||
+                                                        (pd.position1 < 0 && z_score_medium < p.exit_threshold);
                                 
                                 bool profit_target_exit = pd.max_favorable_excursion > 0 && 
-                                                        (pd.max_favorable_excursion * PROFIT_TARGET_MULT) <= 
+                                                        (pd.max_favorable_excursion * p.profit_target_mult) <= 
                                                         std::abs(pd.entry_z_score - z_score_medium);
                                 
                                 // RESTORED: Multi-timeframe exit confirmation
                                 bool multi_timeframe_exit = mean_reversion_exit && 
-                                                          (std::abs(z_score_short) < EXIT_THRESHOLD * 1.5);
+                                                          (std::abs(z_score_short) < p.exit_threshold * 1.5);
                                 
                                 if (multi_timeframe_exit || profit_target_exit) {
                                     auto exit_signals = generate_exit_signals(pd, price1, price2);
@@ -1082,7 +1319,7 @@ private:
                                     
                                     std::string exit_reason = profit_target_exit ? "Profit Target" : "Mean Reversion";
                                     
-                                    if (verbose_logging || (++trade_counter % log_every_n_trades == 0)) {
+                                    if (p.verbose_logging || (++trade_counter % p.log_every_n_trades == 0)) {
                                         winter::utils::Logger::info() << "EXIT (" << exit_reason << "): " 
                                                               << (pd.position1 > 0 ? "SELL " : "BUY ") << pair.first 
                                                               << ", " 
@@ -1225,7 +1462,8 @@ private:
     }
     
     // RESTORED: Advanced position sizing with multiple factors
-    int calculate_position_size(const std::string& symbol, double price, double z_score, int thread_id, const PairData& pd) {
+    int calculate_position_size(const std::string& symbol, double price, double z_score, int thread_id,
+                                const PairData& pd, const StatArbParams& p) {
         // Get historical volatility
         double vol = 0.015; // Default
         {
@@ -1240,7 +1478,7 @@ private:
         double vol_factor = std::min(2.0, 0.25 / std::max(0.03, vol));
         
         // Z-score scaling
-        double z_score_factor = std::min(2.0, 0.7 + std::pow(std::abs(z_score) / ENTRY_THRESHOLD, 0.6));
+        double z_score_factor = std::min(2.0, 0.7 + std::pow(std::abs(z_score) / p.entry_threshold, 0.6));
         
         // Sharpe ratio scaling
         double sharpe_factor = std::max(0.4, std::min(1.8, pd.sharpe_ratio / 1.5));
@@ -1254,7 +1492,7 @@ private:
         // Market volatility adjustment
         double market_vol_factor = std::min(1.5, 0.02 / std::max(0.005, market_volatility));
         
-        return std::max(1, static_cast<int>((CAPITAL * MAX_POSITION_PCT * 
+        return std::max(1, static_cast<int>((CAPITAL * p.max_position_pct * 
                                            vol_factor * z_score_factor * sharpe_factor * 
                                            half_life_factor * market_vol_factor) / price));
     }
@@ -0,0 +1,239 @@
+#include <winter/utils/core_affinity.hpp>
+#include <winter/utils/realtime.hpp>
+#include <winter/utils/thread_placement.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Idle-loop wake-up jitter, before and after realtime mode.
+//
+// A thread sleeps until absolute deadlines `period` apart and records how late
+// each wake-up is. The baseline phase runs it as an ordinary thread; the
+// realtime phase pins it, locks memory, pre-faults its stack and raises it to
+// SCHED_FIFO, the same steps Engine takes with EngineConfiguration::realtime.
+// Unpinned busy threads load the machine in both phases, which is what a
+// normal-priority thread has to compete with.
+//
+// mlockall lasts for the rest of the process, so the baseline always runs first.
+//
+// Usage: jitter_benchmark [--samples N] [--period-us P] [--load threads]
+//                         [--core C] [--priority P] [--output result.json]
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Bucket i counts wake-ups less than 2^i microseconds late; the last is open-ended
+constexpr size_t BUCKETS = 16;
+
+struct Options {
+    size_t samples = 20000;
+    int64_t period_us = 200;
+    int load_threads = -1;  // -1: one per hardware thread
+    int core = -2;          // -2: the planner's strategy core
+    int priority = 80;
+    std::string output;
+};
+
+struct Phase {
+    std::string name;
+    std::vector<std::string> applied;   // Realtime steps that took effect
+    std::vector<std::string> problems;  // And the ones that did not
+    std::vector<int64_t> late_ns;       // Sorted after the run
+    uint64_t histogram[BUCKETS] = {};
+
+    int64_t percentile(double p) const {
+        if (late_ns.empty()) return 0;
+        size_t index = static_cast<size_t>(p / 100.0 * static_cast<double>(late_ns.size() - 1));
+        return late_ns[index];
+    }
+};
+
+size_t bucket_for(int64_t late_ns) {
+    size_t bucket = 0;
+    int64_t limit = 1000;
+    while (bucket + 1 < BUCKETS && late_ns >= limit) {
+        limit *= 2;
+        ++bucket;
+    }
+    return bucket;
+}
+
+std::string bucket_label(size_t bucket) {
+    if (bucket + 1 == BUCKETS) {
+        return ">= " + std::to_string(1 << (BUCKETS - 2)) + " us";
+    }
+    return "< " + std::to_string(1 << bucket) + " us";
+}
+
+void run_phase(Phase& phase, const Options& options, bool realtime, int core) {
+    phase.late_ns.reserve(options.samples);
+
+    std::thread sampler([&]() {
+        if (realtime) {
+            if (core >= 0 && winter::utils::CoreAffinity::pin_current_thread(core)) {
+                phase.applied.push_back("pinned to cpu " + std::to_string(core));
+            } else {
+                phase.problems.push_back("not pinned");
+            }
+            std::string error;
+            if (winter::utils::lock_process_memory(error)) {
+                phase.applied.push_back("memory locked");
+            } else {
+                phase.problems.push_back(error);
+            }
+            winter::utils::prefault_stack();
+            phase.applied.push_back("stack pre-faulted");
+            if (winter::utils::set_realtime_priority(options.priority, error)) {
+                phase.applied.push_back("SCHED_FIFO " + std::to_string(options.priority));
+            } else {
+                phase.problems.push_back(error);
+            }
+        }
+
+        const auto period = std::chrono::microseconds(options.period_us);
+        auto deadline = Clock::now() + period;
+        for (size_t i = 0; i < options.samples; ++i) {
+            std::this_thread::sleep_until(deadline);
+            int64_t late = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - deadline).count();
+            phase.late_ns.push_back(late);
+            deadline += period;
+            // Skip deadlines already missed rather than bunching up behind them
+            auto now = Clock::now();
+            while (deadline < now) {
+                deadline += period;
+            }
+        }
+    });
+    sampler.join();
+
+    std::sort(phase.late_ns.begin(), phase.late_ns.end());
+    for (int64_t late : phase.late_ns) {
+        ++phase.histogram[bucket_for(late)];
+    }
+}
+
+void print_report(const std::vector<Phase>& phases, const Options& options, int load_threads) {
+    std::cout << "Wake-up lateness over " << options.samples << " sleeps of " << options.period_us << " us, "
+              << load_threads << " busy threads\n\n";
+    for (const auto& phase : phases) {
+        if (phase.applied.empty() && phase.problems.empty()) continue;
+        std::cout << phase.name << ":";
+        for (const auto& step : phase.applied) std::cout << " [" << step << "]";
+        std::cout << "\n";
+        for (const auto& problem : phase.problems) std::cout << "  fallback: " << problem << "\n";
+    }
+    std::cout << "\n";
+
+    std::cout << std::left << std::setw(14) << "lateness";
+    for (const auto& phase : phases) std::cout << std::right << std::setw(12) << phase.name;
+    std::cout << "\n";
+    for (size_t b = 0; b < BUCKETS; ++b) {
+        bool any = std::any_of(phases.begin(), phases.end(), [b](const Phase& p) { return p.histogram[b] > 0; });
+        if (!any) continue;
+        std::cout << std::left << std::setw(14) << bucket_label(b);
+        for (const auto& phase : phases) std::cout << std::right << std::setw(12) << phase.histogram[b];
+        std::cout << "\n";
+    }
+    std::cout << "\n";
+    const std::pair<const char*, double> percentiles[] = {{"p50", 50}, {"p99", 99}, {"p99.9", 99.9}, {"max", 100}};
+    for (const auto& [label, p] : percentiles) {
+        std::cout << std::left << std::setw(14) << std::string(label) + " (us)";
+        for (const auto& phase : phases) {
+            std::cout << std::right << std::setw(12) << std::fixed << std::setprecision(1)
+                      << static_cast<double>(phase.percentile(p)) / 1000.0;
+        }
+        std::cout << "\n";
+    }
+}
+
+void write_json(const std::string& path, const std::vector<Phase>& phases, const Options& options) {
+    std::ofstream out(path);
+    out << "{\n  \"period_us\": " << options.period_us << ",\n  \"samples\": " << options.samples
+        << ",\n  \"phases\": [\n";
+    for (size_t i = 0; i < phases.size(); ++i) {
+        const Phase& phase = phases[i];
+        bool applied = !phase.applied.empty() && phase.problems.empty();
+        out << "    {\"name\": \"" << phase.name << "\", \"realtime_applied\": " << (applied ? "true" : "false")
+            << ", \"p50_ns\": " << phase.percentile(50) << ", \"p99_ns\": " << phase.percentile(99)
+            << ", \"p999_ns\": " << phase.percentile(99.9) << ", \"max_ns\": " << phase.percentile(100)
+            << ", \"histogram_us_log2\": [";
+        for (size_t b = 0; b < BUCKETS; ++b) {
+            out << (b ? ", " : "") << phase.histogram[b];
+        }
+        out << "]}" << (i + 1 < phases.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--samples" && i + 1 < argc) {
+            options.samples = std::stoul(argv[++i]);
+        } else if (arg == "--period-us" && i + 1 < argc) {
+            options.period_us = std::stoll(argv[++i]);
+        } else if (arg == "--load" && i + 1 < argc) {
+            options.load_threads = std::stoi(argv[++i]);
+        } else if (arg == "--core" && i + 1 < argc) {
+            options.core = std::stoi(argv[++i]);
+        } else if (arg == "--priority" && i + 1 < argc) {
+            options.priority = std::stoi(argv[++i]);
+        } else if (arg == "--output" && i + 1 < argc) {
+            options.output = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--samples N] [--period-us P] [--load threads]"
+                      << " [--core C] [--priority P] [--output result.json]" << std::endl;
+            return 1;
+        }
+    }
+
+    int core = options.core;
+    if (core == -2) {
+        core = winter::utils::PlacementPlanner(winter::utils::CpuTopology::detect()).plan().strategy;
+    }
+    int load_threads = options.load_threads >= 0 ? options.load_threads
+                                                 : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+    // Ordinary-priority competition for every cpu, the sampler's included
+    std::atomic<bool> loading{true};
+    std::vector<std::thread> load;
+    for (int i = 0; i < load_threads; ++i) {
+        load.emplace_back([&loading]() {
+            volatile uint64_t spin = 0;
+            while (loading.load(std::memory_order_relaxed)) {
+                spin = spin + 1;
+            }
+        });
+    }
+
+    std::vector<Phase> phases(2);
+    phases[0].name = "baseline";
+    phases[1].name = "realtime";
+    run_phase(phases[0], options, false, core);
+    run_phase(phases[1], options, true, core);
+
+    loading = false;
+    for (auto& thread : load) {
+        thread.join();
+    }
+
+    print_report(phases, options, load_threads);
+    if (!options.output.empty()) {
+        write_json(options.output, phases, options);
+        std::cout << "\nResults written to " << options.output << std::endl;
+    }
+    return 0;
+}
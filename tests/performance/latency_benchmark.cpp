@@ -1,134 +1,308 @@
 #include <winter/core/engine.hpp>
 #include <winter/strategy/strategy_registry.hpp>
+#include <winter/utils/core_affinity.hpp>
 #include <winter/utils/logger.hpp>
 #include <winter/utils/flamegraph.hpp>
+#include <winter/utils/tsc_clock.hpp>
 
-#include <chrono>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iomanip>
 #include <iostream>
-#include <vector>
-#include <string>
+#include <memory>
 #include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Tick-to-signal and tick-to-fill latency benchmark.
+//
+// Each tick carries its sequence number in `timestamp`, and the producer stamps
+// it (TSC) just before enqueueing. The strategy stamps the tick on entry to
+// process_tick, and the order callback stamps the fill. Order prices are the
+// tick price, which encodes the sequence number, so fills map back to their
+// tick even when signals do not turn into orders.
+
+namespace {
+
+const std::vector<std::string> SYMBOLS = {
+    "AAPL", "MSFT", "GOOGL", "AMZN", "META", "TSLA", "NVDA", "JPM"
+};
+
+constexpr double BASE_PRICE = 100.0;
+constexpr double PRICE_STEP = 0.0001;
+
+double price_for(size_t seq) {
+    return BASE_PRICE + static_cast<double>(seq) * PRICE_STEP;
+}
+
+size_t seq_for(double price) {
+    return static_cast<size_t>(std::llround((price - BASE_PRICE) / PRICE_STEP));
+}
+
+// Stamps per tick; each array is written by one thread and read after the run
+struct LatencyRecorder {
+    std::vector<uint64_t> enqueue_tsc;
+    std::vector<uint64_t> strategy_tsc;
+    std::vector<uint64_t> fill_tsc;
+    std::atomic<size_t> ticks_seen{0};
+    // Filled position per symbol, set from the order callback
+    std::vector<std::atomic<bool>> held;
+
+    explicit LatencyRecorder(size_t ticks)
+        : enqueue_tsc(ticks, 0), strategy_tsc(ticks, 0), fill_tsc(ticks, 0), held(SYMBOLS.size()) {}
+};
 
-// Simple strategy for benchmarking
+// Strategy for benchmarking: signals on ~10% of ticks, buying when flat and
+// selling once the buy has filled, so every order it sends can fill
 class BenchmarkStrategy : public winter::strategy::StrategyBase {
 private:
+    LatencyRecorder* recorder_;
     std::mt19937 rng_;
     std::uniform_real_distribution<double> dist_;
-    
+    std::vector<bool> buy_sent_;
+
 public:
-    BenchmarkStrategy() 
-        : StrategyBase("BenchmarkStrategy"), 
-          rng_(std::random_device{}()),
-          dist_(-1.0, 1.0) {}
-    
+    BenchmarkStrategy(LatencyRecorder* recorder, uint32_t seed)
+        : StrategyBase("BenchmarkStrategy"),
+          recorder_(recorder),
+          rng_(seed),
+          dist_(0.0, 1.0),
+          buy_sent_(SYMBOLS.size(), false) {}
+
     std::vector<winter::core::Signal> process_tick(const winter::core::MarketData& data) override {
+        size_t seq = static_cast<size_t>(data.timestamp);
+        if (recorder_) {
+            recorder_->strategy_tsc[seq] = winter::utils::tsc_now();
+            recorder_->ticks_seen.fetch_add(1, std::memory_order_release);
+        }
+
         std::vector<winter::core::Signal> signals;
-        
-        // Generate random signal with 10% probability
-        if (dist_(rng_) > 0.8) {
+        if (!recorder_ || dist_(rng_) >= 0.1) {
+            return signals;
+        }
+
+        // Wait out an order that has not filled yet
+        size_t symbol = seq % SYMBOLS.size();
+        bool held = recorder_->held[symbol].load(std::memory_order_acquire);
+        if (held == buy_sent_[symbol]) {
             winter::core::Signal signal;
             signal.symbol = data.symbol;
             signal.price = data.price;
-            signal.strength = std::abs(dist_(rng_));
-            
-            if (dist_(rng_) > 0.0) {
-                signal.type = winter::core::SignalType::BUY;
-            } else {
-                signal.type = winter::core::SignalType::SELL;
-            }
-            
+            signal.strength = 1.0;
+            signal.type = held ? winter::core::SignalType::SELL : winter::core::SignalType::BUY;
+            buy_sent_[symbol] = !held;
             signals.push_back(signal);
         }
-        
         return signals;
     }
 };
 
-// Function to generate random market data
-winter::core::MarketData generate_market_data(std::mt19937& rng) {
-    static const std::vector<std::string> symbols = {
-        "AAPL", "MSFT", "GOOGL", "AMZN", "META", "TSLA", "NVDA", "JPM"
+struct LoadLevel {
+    std::string name;
+    double rate = 0.0;  // Ticks per second; 0 means closed loop
+};
+
+struct CoreLayout {
+    int producer = -1;
+    int strategy = -1;
+    int execution = -1;
+};
+
+void print_distribution(const std::string& label, std::vector<double> samples_ns) {
+    if (samples_ns.empty()) {
+        std::cout << "  " << std::left << std::setw(16) << label << "no samples" << std::endl;
+        return;
+    }
+    std::sort(samples_ns.begin(), samples_ns.end());
+    auto percentile = [&samples_ns](double p) {
+        size_t index = static_cast<size_t>(std::ceil(p / 100.0 * samples_ns.size()));
+        return samples_ns[std::min(samples_ns.size() - 1, index == 0 ? 0 : index - 1)];
     };
-    
-    std::uniform_int_distribution<size_t> symbol_dist(0, symbols.size() - 1);
-    std::uniform_real_distribution<double> price_dist(100.0, 1000.0);
-    std::uniform_int_distribution<int> volume_dist(100, 10000);
-    
-    winter::core::MarketData data;
-    data.symbol = symbols[symbol_dist(rng)];
-    data.price = price_dist(rng);
-    data.volume = volume_dist(rng);
-    data.timestamp = std::chrono::duration_cast<std::chrono::microseconds>(
-        std::chrono::high_resolution_clock::now().time_since_epoch()
-    ).count();
-    
-    return data;
+    double sum = 0.0;
+    for (double s : samples_ns) {
+        sum += s;
+    }
+
+    std::cout << "  " << std::left << std::setw(16) << label << std::right << std::fixed << std::setprecision(0)
+              << "n=" << samples_ns.size()
+              << "  min " << samples_ns.front()
+              << "  mean " << sum / samples_ns.size()
+              << "  p50 " << percentile(50)
+              << "  p90 " << percentile(90)
+              << "  p99 " << percentile(99)
+              << "  p99.9 " << percentile(99.9)
+              << "  p99.99 " << percentile(99.99)
+              << "  max " << samples_ns.back() << " ns" << std::endl;
 }
 
+void run_level(const LoadLevel& level, int num_strategies, size_t warmup_ticks, size_t measured_ticks,
+               const CoreLayout& cores) {
+    const size_t total_ticks = warmup_ticks + measured_ticks;
+    auto& tsc = winter::utils::TscClock::instance();
+
+    LatencyRecorder recorder(total_ticks);
+    winter::core::Engine engine;
+    winter::core::EngineConfiguration config;
+    config.batch_size = 64;
+    engine.configure(config);
+    engine.portfolio().set_cash(1e12);
+
+    // Only the first strategy stamps ticks and trades; the rest add per-tick work
+    for (int i = 0; i < num_strategies; ++i) {
+        engine.add_strategy(std::make_shared<BenchmarkStrategy>(i == 0 ? &recorder : nullptr, 42 + i));
+    }
+    engine.set_order_callback([&recorder](const winter::core::Order& order) {
+        size_t seq = seq_for(order.price);
+        if (seq < recorder.fill_tsc.size() && recorder.fill_tsc[seq] == 0) {
+            recorder.fill_tsc[seq] = winter::utils::tsc_now();
+        }
+        recorder.held[seq % SYMBOLS.size()].store(order.side == winter::core::OrderSide::BUY,
+                                                  std::memory_order_release);
+    });
+    engine.start(cores.strategy, cores.execution);
+
+    // Pre-build ticks so the send loop only stamps and enqueues
+    std::vector<winter::core::MarketData> ticks(total_ticks);
+    for (size_t i = 0; i < total_ticks; ++i) {
+        ticks[i].symbol = SYMBOLS[i % SYMBOLS.size()];
+        ticks[i].price = price_for(i);
+        ticks[i].volume = 100;
+        ticks[i].timestamp = static_cast<int64_t>(i);
+    }
+
+    std::thread producer([&]() {
+        if (cores.producer >= 0) {
+            winter::utils::CoreAffinity::pin_thread_to_core(pthread_self(), cores.producer);
+        }
+
+        const double ticks_per_ns = level.rate / 1e9;
+        const uint64_t start = winter::utils::tsc_now();
+        for (size_t i = 0; i < total_ticks; ++i) {
+            if (level.rate > 0.0) {
+                // Open loop: tick i is due at start + i / rate. The stamp is the
+                // scheduled time, so a producer stall shows up as latency
+                // instead of being hidden (coordinated omission).
+                double due_ns = static_cast<double>(i) / ticks_per_ns;
+                uint64_t now = winter::utils::tsc_now();
+                while (tsc.elapsed_ns(start, now) < due_ns) {
+                    now = winter::utils::tsc_now();
+                }
+                recorder.enqueue_tsc[i] = start + static_cast<uint64_t>(due_ns / tsc.ns_per_tick());
+            } else {
+                recorder.enqueue_tsc[i] = winter::utils::tsc_now();
+            }
+
+            engine.process_market_data(ticks[i]);
+
+            if (level.rate <= 0.0) {
+                // Closed loop: one tick in flight at a time; spin only on a pinned core
+                while (recorder.ticks_seen.load(std::memory_order_acquire) <= i) {
+                    if (cores.producer < 0) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        }
+    });
+    producer.join();
+
+    while (engine.ticks_processed() < total_ticks) {
+        std::this_thread::yield();
+    }
+    // Let the last orders fill
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    engine.stop();
+
+    std::vector<double> to_strategy;
+    std::vector<double> to_fill;
+    to_strategy.reserve(measured_ticks);
+    for (size_t i = warmup_ticks; i < total_ticks; ++i) {
+        if (recorder.strategy_tsc[i] != 0) {
+            to_strategy.push_back(tsc.elapsed_ns(recorder.enqueue_tsc[i], recorder.strategy_tsc[i]));
+        }
+        if (recorder.fill_tsc[i] != 0) {
+            to_fill.push_back(tsc.elapsed_ns(recorder.enqueue_tsc[i], recorder.fill_tsc[i]));
+        }
+    }
+
+    std::cout << level.name << std::endl;
+    print_distribution("tick->strategy", std::move(to_strategy));
+    print_distribution("tick->fill", std::move(to_fill));
+}
+
+std::vector<LoadLevel> parse_levels(const std::string& spec) {
+    std::vector<LoadLevel> levels;
+    std::stringstream ss(spec);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        LoadLevel level;
+        if (item == "closed") {
+            level.name = "closed loop (1 in flight)";
+        } else {
+            level.rate = std::stod(item);
+            level.name = "open loop @ " + item + " ticks/s";
+        }
+        levels.push_back(level);
+    }
+    return levels;
+}
+
+} // namespace
+
 int main(int argc, char* argv[]) {
     // Set log level to reduce output
     winter::utils::Logger::set_level(winter::utils::LogLevel::WARN);
-    
-    // Parse command line arguments
+
+    // Usage: latency_benchmark [strategies] [ticks per level] [levels] [first core]
+    //   levels: comma-separated ticks/s for open loop, "closed" for closed loop
+    //   first core: producer, strategy and execution threads use it and the next
+    //               two cores; -1 leaves them unpinned
     int num_strategies = 1;
-    int num_ticks = 100000;
-    
+    size_t num_ticks = 100000;
+    std::string level_spec = "closed,100000,500000,1000000";
+    int first_core = 0;
+
     if (argc > 1) {
         num_strategies = std::stoi(argv[1]);
     }
     if (argc > 2) {
-        num_ticks = std::stoi(argv[2]);
+        num_ticks = std::stoul(argv[2]);
     }
-    
-    std::cout << "Running latency benchmark with " << num_strategies 
-              << " strategies and " << num_ticks << " ticks" << std::endl;
-    
-    // Create engine
-    winter::core::Engine engine;
-    
-    // Register strategies
-    for (int i = 0; i < num_strategies; ++i) {
-        auto strategy = std::make_shared<BenchmarkStrategy>();
-        engine.add_strategy(strategy);
+    if (argc > 3) {
+        level_spec = argv[3];
+    }
+    if (argc > 4) {
+        first_core = std::stoi(argv[4]);
     }
-    
+
+    CoreLayout cores;
+    if (first_core >= 0 && static_cast<unsigned>(first_core) + 3 <= std::thread::hardware_concurrency()) {
+        cores = CoreLayout{first_core, first_core + 1, first_core + 2};
+    } else if (first_core >= 0) {
+        std::cout << "Not enough cores to pin three threads from core " << first_core << "; running unpinned" << std::endl;
+    }
+
+    const size_t warmup_ticks = std::max<size_t>(1000, num_ticks / 10);
+
+    std::cout << "Running latency benchmark with " << num_strategies << " strategies, "
+              << num_ticks << " measured ticks per level after " << warmup_ticks << " warm-up ticks" << std::endl;
+    std::cout << "Cores: producer " << cores.producer << ", strategy " << cores.strategy
+              << ", execution " << cores.execution << std::endl;
+
     // Start flamegraph profiling
     winter::utils::Flamegraph flamegraph("latency_benchmark");
     flamegraph.start();
-    
-    // Start engine
-    engine.start();
-    
-    // Generate and process market data
-    std::mt19937 rng(std::random_device{}());
-    
-    auto start_time = std::chrono::high_resolution_clock::now();
-    
-    for (int i = 0; i < num_ticks; ++i) {
-        auto data = generate_market_data(rng);
-        engine.process_market_data(data);
+
+    for (const auto& level : parse_levels(level_spec)) {
+        run_level(level, num_strategies, warmup_ticks, num_ticks, cores);
     }
-    
-    auto end_time = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
-        end_time - start_time
-    ).count();
-    
-    // Stop engine
-    engine.stop();
-    
+
     // Stop flamegraph profiling
     flamegraph.stop();
     flamegraph.generate_report();
-    
-    // Calculate and print results
-    double avg_latency = static_cast<double>(duration) / num_ticks;
-    double ticks_per_second = static_cast<double>(num_ticks) * 1000000.0 / duration;
-    
-    std::cout << "Benchmark results:" << std::endl;
-    std::cout << "Total time: " << duration << " us" << std::endl;
-    std::cout << "Average latency per tick: " << avg_latency << " us" << std::endl;
-    std::cout << "Ticks processed per second: " << ticks_per_second << std::endl;
-    
+
     return 0;
 }
@@ -0,0 +1,257 @@
+#pragma once
+
+#include <algorithm>
+#include <barrier>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Small built-in microbenchmark runner.
+//
+// A case is registered with the sizes and thread counts to sweep. For each
+// combination the runner calls the case's setup, which returns one loop per
+// thread; setup time is not measured. The loops start together behind a
+// barrier and each runs `iterations` operations. The iteration count grows
+// until a run takes at least the minimum time, then the run is repeated and
+// the median time per operation is reported. Thread counts above the
+// machine's hardware threads are skipped: oversubscribed runs time the
+// scheduler, not the code.
+
+namespace winter::bench {
+
+struct Params {
+    int64_t size = 0;
+    int threads = 1;
+};
+
+using Loop = std::function<void(size_t iterations)>;
+using Setup = std::function<std::vector<Loop>(const Params& params)>;
+
+struct Case {
+    std::string name;
+    std::vector<int64_t> sizes;
+    std::vector<int> thread_counts;
+    Setup setup;
+};
+
+struct Result {
+    std::string name;
+    int64_t size = 0;
+    int threads = 1;
+    size_t iterations = 0;
+    double ns_per_op = 0.0;      // Median over repetitions, per thread
+    double min_ns_per_op = 0.0;
+    double max_ns_per_op = 0.0;
+    double ops_per_sec = 0.0;    // All threads together, at the median
+};
+
+// Swallows library log output while benchmarks run
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+};
+
+struct Options {
+    std::string filter;
+    std::string output;
+    double min_time_ms = 50.0;
+    int repetitions = 5;
+    bool list = false;
+};
+
+inline std::vector<Case>& cases() {
+    static std::vector<Case> registered;
+    return registered;
+}
+
+inline bool register_case(std::string name, std::vector<int64_t> sizes, std::vector<int> thread_counts, Setup setup) {
+    cases().push_back(Case{std::move(name), std::move(sizes), std::move(thread_counts), std::move(setup)});
+    return true;
+}
+
+inline std::string full_name(const std::string& name, int64_t size, int threads) {
+    return name + "/" + std::to_string(size) + "/threads:" + std::to_string(threads);
+}
+
+// Keeps a value alive so the optimizer cannot drop the work producing it
+template<typename T>
+inline void do_not_optimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Wall time of one run with every loop started at once
+inline double run_once(const Case& c, const Params& params, size_t iterations) {
+    std::vector<Loop> loops = c.setup(params);
+    if (loops.size() == 1) {
+        auto start = std::chrono::steady_clock::now();
+        loops[0](iterations);
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    std::barrier sync(static_cast<std::ptrdiff_t>(loops.size() + 1));
+    std::vector<std::thread> threads;
+    threads.reserve(loops.size());
+    for (auto& loop : loops) {
+        threads.emplace_back([&sync, &loop, iterations]() {
+            sync.arrive_and_wait();
+            loop(iterations);
+            sync.arrive_and_wait();
+        });
+    }
+    sync.arrive_and_wait();
+    auto start = std::chrono::steady_clock::now();
+    sync.arrive_and_wait();
+    double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return elapsed;
+}
+
+inline Result measure(const Case& c, const Params& params, const Options& options) {
+    const double min_time_ns = options.min_time_ms * 1e6;
+    size_t iterations = 1;
+    while (true) {
+        double elapsed = run_once(c, params, iterations);
+        if (elapsed >= min_time_ns || iterations >= (size_t{1} << 40)) {
+            break;
+        }
+        // Aim straight for the target once a run is long enough to time
+        double scale = elapsed > min_time_ns / 100.0 ? 1.2 * min_time_ns / elapsed : 10.0;
+        iterations = static_cast<size_t>(std::ceil(iterations * std::clamp(scale, 2.0, 10.0)));
+    }
+
+    std::vector<double> per_op;
+    for (int r = 0; r < std::max(1, options.repetitions); ++r) {
+        per_op.push_back(run_once(c, params, iterations) / static_cast<double>(iterations));
+    }
+    std::sort(per_op.begin(), per_op.end());
+
+    Result result;
+    result.name = full_name(c.name, params.size, params.threads);
+    result.size = params.size;
+    result.threads = params.threads;
+    result.iterations = iterations;
+    result.ns_per_op = per_op[per_op.size() / 2];
+    result.min_ns_per_op = per_op.front();
+    result.max_ns_per_op = per_op.back();
+    result.ops_per_sec = result.ns_per_op > 0.0 ? params.threads * 1e9 / result.ns_per_op : 0.0;
+    return result;
+}
+
+// Results only compare against runs on the same processor
+inline std::string cpu_model() {
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+        if (line.rfind("model name", 0) == 0 && line.find(':') != std::string::npos) {
+            std::string model = line.substr(line.find(':') + 1);
+            model.erase(0, model.find_first_not_of(" \t"));
+            model.erase(std::remove_if(model.begin(), model.end(), [](char c) { return c == '"' || c == '\\'; }),
+                        model.end());
+            return model;
+        }
+    }
+    return "unknown";
+}
+
+inline void write_json(std::ostream& out, const std::vector<Result>& results, const Options& options) {
+    out << "{\n  \"context\": {\"hardware_concurrency\": " << std::thread::hardware_concurrency()
+        << ", \"cpu_model\": \"" << cpu_model() << "\""
+        << ", \"min_time_ms\": " << options.min_time_ms
+        << ", \"repetitions\": " << options.repetitions << "},\n  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        out << (i ? ",\n" : "\n") << std::fixed << std::setprecision(3)
+            << "    {\"name\": \"" << r.name << "\", \"size\": " << r.size << ", \"threads\": " << r.threads
+            << ", \"iterations\": " << r.iterations << ", \"ns_per_op\": " << r.ns_per_op
+            << ", \"min_ns_per_op\": " << r.min_ns_per_op << ", \"max_ns_per_op\": " << r.max_ns_per_op
+            << ", \"ops_per_sec\": " << std::setprecision(0) << r.ops_per_sec << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+inline int run_all(int argc, char* argv[]) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&]() -> std::string { return i + 1 < argc ? argv[++i] : ""; };
+        if (arg == "--filter") {
+            options.filter = next();
+        } else if (arg == "--output") {
+            options.output = next();
+        } else if (arg == "--min-time-ms") {
+            options.min_time_ms = std::stod(next());
+        } else if (arg == "--repetitions") {
+            options.repetitions = std::stoi(next());
+        } else if (arg == "--list") {
+            options.list = true;
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--filter substring] [--output result.json]\n"
+                      << "       [--min-time-ms N] [--repetitions N] [--list]" << std::endl;
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    // Logger writes to std::cout; the report goes to the real stdout instead
+    std::ostream report(std::cout.rdbuf());
+    NullBuffer null_buffer;
+    std::streambuf* stdout_buffer = std::cout.rdbuf(&null_buffer);
+
+    const int hardware_threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    size_t oversubscribed = 0;
+    std::vector<Result> results;
+    report << std::left << std::setw(48) << "Benchmark" << std::right << std::setw(14) << "ns/op"
+           << std::setw(14) << "min" << std::setw(16) << "ops/s" << std::endl;
+    for (const auto& c : cases()) {
+        for (int threads : c.thread_counts) {
+            for (int64_t size : c.sizes) {
+                std::string name = full_name(c.name, size, threads);
+                if (!options.filter.empty() && name.find(options.filter) == std::string::npos) {
+                    continue;
+                }
+                if (threads > hardware_threads) {
+                    ++oversubscribed;
+                    continue;
+                }
+                if (options.list) {
+                    report << name << std::endl;
+                    continue;
+                }
+                Result r = measure(c, Params{size, threads}, options);
+                report << std::left << std::setw(48) << r.name << std::right << std::fixed
+                       << std::setprecision(2) << std::setw(14) << r.ns_per_op << std::setw(14) << r.min_ns_per_op
+                       << std::setprecision(0) << std::setw(16) << r.ops_per_sec << std::endl;
+                results.push_back(std::move(r));
+            }
+        }
+    }
+
+    std::cout.rdbuf(stdout_buffer);
+    if (oversubscribed > 0) {
+        std::cout << "Skipped " << oversubscribed << " case(s) with more threads than the " << hardware_threads
+                  << " hardware thread(s)" << std::endl;
+    }
+
+    if (!options.output.empty()) {
+        std::ofstream out(options.output);
+        if (!out) {
+            std::cerr << "Cannot write " << options.output << std::endl;
+            return 1;
+        }
+        write_json(out, results, options);
+        std::cout << "Results written to " << options.output << std::endl;
+    }
+    return 0;
+}
+
+} // namespace winter::bench
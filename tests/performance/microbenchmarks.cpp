@@ -0,0 +1,299 @@
+#include "microbench.hpp"
+
+#include <winter/backtest/csv_loader.hpp>
+#include <winter/core/portfolio.hpp>
+#include <winter/strategy/enhanced_strategy_base.hpp>
+#include <winter/utils/lock_free_queue.hpp>
+#include <winter/utils/logger.hpp>
+#include <winter/utils/memory_pool.hpp>
+#include <winter/utils/spsc_ring.hpp>
+#include "strategies/mean_reversion_strategy.hpp"
+
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Microbenchmarks for the core primitives. Sizes are per case (capacity, live
+// objects, symbols, fields or period); see each registration. Types that are
+// not thread-safe (MemoryPool, Portfolio, strategies) get one instance per
+// thread, so their thread counts measure scaling rather than contention.
+//
+// Usage: microbenchmarks [--filter substring] [--output result.json]
+//        [--min-time-ms N] [--repetitions N] [--list]
+// Compare against the stored baseline with scripts/compare_benchmarks.py.
+
+namespace {
+
+using winter::bench::Loop;
+using winter::bench::Params;
+using winter::bench::do_not_optimize;
+using winter::bench::register_case;
+
+std::vector<std::string> make_symbols(size_t count) {
+    std::vector<std::string> symbols;
+    symbols.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        symbols.push_back("SYM" + std::to_string(i));
+    }
+    return symbols;
+}
+
+// Random walk around 100 so indicators see realistic variance
+std::vector<double> make_prices(size_t count, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::normal_distribution<double> step(0.0, 0.05);
+    std::vector<double> prices(count);
+    double price = 100.0;
+    for (auto& p : prices) {
+        price = std::max(1.0, price + step(rng));
+        p = price;
+    }
+    return prices;
+}
+
+// One thread pushes and pops in turn; two threads split producer and consumer
+template<typename Queue>
+std::vector<Loop> queue_loops(std::shared_ptr<Queue> queue, int threads) {
+    if (threads == 1) {
+        return {[queue](size_t iterations) {
+            int64_t value = 0;
+            for (size_t i = 0; i < iterations; ++i) {
+                queue->push(static_cast<int64_t>(i));
+                queue->pop(value);
+            }
+            do_not_optimize(value);
+        }};
+    }
+    return {
+        [queue](size_t iterations) {
+            for (size_t i = 0; i < iterations; ++i) {
+                while (!queue->push(static_cast<int64_t>(i))) {
+                    std::this_thread::yield();
+                }
+            }
+        },
+        [queue](size_t iterations) {
+            int64_t value = 0;
+            for (size_t i = 0; i < iterations; ++i) {
+                while (!queue->pop(value)) {
+                    std::this_thread::yield();
+                }
+            }
+            do_not_optimize(value);
+        }};
+}
+
+template<size_t Capacity>
+std::vector<Loop> lock_free_queue_loops(int threads) {
+    return queue_loops(std::make_shared<winter::utils::LockFreeQueue<int64_t, Capacity>>(), threads);
+}
+
+const bool lock_free_queue_registered = register_case(
+    "lock_free_queue/push_pop", {64, 1024, 65536}, {1, 2}, [](const Params& p) {
+        switch (p.size) {
+        case 64: return lock_free_queue_loops<64>(p.threads);
+        case 1024: return lock_free_queue_loops<1024>(p.threads);
+        default: return lock_free_queue_loops<65536>(p.threads);
+        }
+    });
+
+const bool spsc_ring_registered = register_case(
+    "spsc_ring/push_pop", {64, 1024, 65536}, {1, 2}, [](const Params& p) {
+        return queue_loops(std::make_shared<winter::utils::SpscRing<int64_t>>(p.size), p.threads);
+    });
+
+// Size is the number of live objects: allocate that many, then free them all
+struct PoolObject {
+    double price;
+    int64_t timestamp;
+    int quantity;
+};
+
+const bool memory_pool_registered = register_case(
+    "memory_pool/alloc_free", {64, 4096, 65536}, {1, 2, 4}, [](const Params& p) {
+        std::vector<Loop> loops;
+        for (int t = 0; t < p.threads; ++t) {
+            auto pool = std::make_shared<winter::utils::MemoryPool<PoolObject>>();
+            loops.push_back([pool, live = static_cast<size_t>(p.size)](size_t iterations) {
+                std::vector<PoolObject*> objects;
+                objects.reserve(live);
+                for (size_t done = 0; done < iterations;) {
+                    size_t batch = std::min(live, iterations - done);
+                    for (size_t i = 0; i < batch; ++i) {
+                        objects.push_back(pool->allocate());
+                    }
+                    for (auto* object : objects) {
+                        pool->deallocate(object);
+                    }
+                    objects.clear();
+                    done += batch;
+                }
+            });
+        }
+        return loops;
+    });
+
+// Size is the number of fields per message; threads share the console mutex
+std::vector<Loop> logger_loops(const Params& p, bool emitted) {
+    std::vector<Loop> loops;
+    for (int t = 0; t < p.threads; ++t) {
+        loops.push_back([fields = p.size, emitted](size_t iterations) {
+            for (size_t i = 0; i < iterations; ++i) {
+                auto& log = emitted ? winter::utils::Logger::info() : winter::utils::Logger::debug();
+                for (int64_t f = 0; f < fields; ++f) {
+                    log << "field " << 42.5;
+                }
+                log << winter::utils::Logger::endl;
+            }
+        });
+    }
+    return loops;
+}
+
+const bool logger_filtered_registered = register_case(
+    "logger/filtered", {1, 4, 16}, {1, 2, 4}, [](const Params& p) {
+        winter::utils::Logger::set_level(winter::utils::LogLevel::INFO);
+        return logger_loops(p, false);
+    });
+
+const bool logger_emitted_registered = register_case(
+    "logger/emitted", {1, 4, 16}, {1, 2, 4}, [](const Params& p) {
+        winter::utils::Logger::set_level(winter::utils::LogLevel::INFO);
+        return logger_loops(p, true);
+    });
+
+// Size is the number of symbols held; each op is a buy followed by a sell
+const bool portfolio_registered = register_case(
+    "portfolio/add_reduce", {8, 512, 8192}, {1, 2, 4}, [](const Params& p) {
+        auto symbols = std::make_shared<std::vector<std::string>>(make_symbols(p.size));
+        std::vector<Loop> loops;
+        for (int t = 0; t < p.threads; ++t) {
+            auto portfolio = std::make_shared<winter::core::Portfolio>();
+            portfolio->set_cash(1e9);
+            // A standing lot per symbol keeps the position map at full size
+            for (const auto& symbol : *symbols) {
+                portfolio->add_position(symbol, 100, 10000.0);
+            }
+            loops.push_back([portfolio, symbols](size_t iterations) {
+                for (size_t i = 0; i < iterations; ++i) {
+                    const auto& symbol = (*symbols)[i % symbols->size()];
+                    portfolio->add_position(symbol, 10, 1000.0);
+                    portfolio->reduce_position(symbol, 10);
+                }
+            });
+        }
+        return loops;
+    });
+
+const bool portfolio_value_registered = register_case(
+    "portfolio/total_value", {8, 512, 8192}, {1, 2, 4}, [](const Params& p) {
+        auto symbols = make_symbols(p.size);
+        std::vector<Loop> loops;
+        for (int t = 0; t < p.threads; ++t) {
+            auto portfolio = std::make_shared<winter::core::Portfolio>();
+            for (const auto& symbol : symbols) {
+                portfolio->add_position(symbol, 100, 10000.0);
+            }
+            loops.push_back([portfolio](size_t iterations) {
+                double value = 0.0;
+                for (size_t i = 0; i < iterations; ++i) {
+                    value += portfolio->total_value();
+                }
+                do_not_optimize(value);
+            });
+        }
+        return loops;
+    });
+
+// Size is the number of columns per row, the first five being the ones parsed
+const bool csv_registered = register_case(
+    "csv/parse_line", {5, 12, 24}, {1, 2, 4}, [](const Params& p) {
+        auto lines = std::make_shared<std::vector<std::string>>();
+        auto prices = make_prices(1024, 7);
+        for (size_t i = 0; i < prices.size(); ++i) {
+            std::string line = "09:30:00." + std::to_string(i % 1000) + ",AAPL,Q," + std::to_string(prices[i]) + "," +
+                               std::to_string(100 + i % 900);
+            for (int64_t column = 5; column < p.size; ++column) {
+                line += ",X";
+            }
+            lines->push_back(std::move(line));
+        }
+        std::vector<Loop> loops;
+        for (int t = 0; t < p.threads; ++t) {
+            loops.push_back([lines](size_t iterations) {
+                double sum = 0.0;
+                for (size_t i = 0; i < iterations; ++i) {
+                    auto data = winter::backtest::parse_market_data_line((*lines)[i % lines->size()]);
+                    sum += data ? data->price : 0.0;
+                }
+                do_not_optimize(sum);
+            });
+        }
+        return loops;
+    });
+
+// Exposes the protected indicator helpers of the strategy base
+class IndicatorStrategy : public winter::strategy::EnhancedStrategyBase {
+public:
+    IndicatorStrategy() : EnhancedStrategyBase("IndicatorStrategy") {}
+    using EnhancedStrategyBase::calculate_sma;
+};
+
+// Size is the SMA period, over a full price history
+const bool sma_registered = register_case(
+    "indicators/sma", {10, 50, 200}, {1, 2, 4}, [](const Params& p) {
+        auto prices = make_prices(1000, 11);
+        std::vector<Loop> loops;
+        for (int t = 0; t < p.threads; ++t) {
+            auto strategy = std::make_shared<IndicatorStrategy>();
+            winter::core::MarketData tick;
+            tick.symbol = "AAPL";
+            tick.volume = 100;
+            for (double price : prices) {
+                tick.price = price;
+                strategy->process_tick(tick);
+            }
+            loops.push_back([strategy, period = static_cast<int>(p.size)](size_t iterations) {
+                double sum = 0.0;
+                for (size_t i = 0; i < iterations; ++i) {
+                    sum += strategy->calculate_sma("AAPL", period);
+                }
+                do_not_optimize(sum);
+            });
+        }
+        return loops;
+    });
+
+// Size is the number of symbols; each op is one tick through the rolling
+// mean/variance, EMA and volume indicators of the mean-reversion strategy
+const bool mean_reversion_registered = register_case(
+    "indicators/mean_reversion_tick", {1, 8, 64}, {1, 2, 4}, [](const Params& p) {
+        auto symbols = std::make_shared<std::vector<std::string>>(make_symbols(p.size));
+        auto prices = std::make_shared<std::vector<double>>(make_prices(4096, 13));
+        std::vector<Loop> loops;
+        for (int t = 0; t < p.threads; ++t) {
+            auto strategy = std::make_shared<MeanReversionStrategy>();
+            strategy->initialize();
+            loops.push_back([strategy, symbols, prices](size_t iterations) {
+                winter::core::MarketData tick;
+                tick.volume = 100;
+                size_t signals = 0;
+                for (size_t i = 0; i < iterations; ++i) {
+                    tick.symbol = (*symbols)[i % symbols->size()];
+                    tick.price = (*prices)[i % prices->size()];
+                    tick.timestamp = static_cast<int64_t>(i);
+                    signals += strategy->process_tick(tick).size();
+                }
+                do_not_optimize(signals);
+            });
+        }
+        return loops;
+    });
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    return winter::bench::run_all(argc, argv);
+}
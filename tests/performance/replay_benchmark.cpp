@@ -0,0 +1,353 @@
+#include <winter/backtest/csv_loader.hpp>
+#include <winter/core/engine.hpp>
+#include <winter/utils/alloc_tracker.hpp>
+#include <winter/utils/logger.hpp>
+#include <winter/utils/tsc_clock.hpp>
+#include "strategies/mean_reversion_strategy.hpp"
+#include "strategies/stat_arbitrage.hpp"
+#include "examples/strategy_ma_strategy/simple_ma_strategy.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+// Replays the 2021 trade tape through the Engine with the production
+// strategies and reports load time, throughput, allocations per tick, peak
+// RSS and per-stage latency percentiles as JSON, so runs can be diffed
+// across commits.
+
+namespace {
+
+using winter::core::MarketData;
+
+struct Percentiles {
+    size_t count = 0;
+    double p50 = 0, p90 = 0, p99 = 0, p999 = 0, max = 0, mean = 0;
+};
+
+Percentiles summarize(std::vector<double>& samples) {
+    Percentiles p;
+    p.count = samples.size();
+    if (samples.empty()) {
+        return p;
+    }
+    std::sort(samples.begin(), samples.end());
+    auto at = [&samples](double q) {
+        size_t index = static_cast<size_t>(std::ceil(q * samples.size()));
+        return samples[std::min(samples.size() - 1, index == 0 ? 0 : index - 1)];
+    };
+    double sum = 0.0;
+    for (double s : samples) {
+        sum += s;
+    }
+    p.p50 = at(0.50);
+    p.p90 = at(0.90);
+    p.p99 = at(0.99);
+    p.p999 = at(0.999);
+    p.max = samples.back();
+    p.mean = sum / samples.size();
+    return p;
+}
+
+// Times process_tick of the wrapped strategy. The first stage in the engine
+// also records how long each tick waited after its batch was handed over.
+class TimedStrategy : public winter::strategy::StrategyBase {
+private:
+    winter::strategy::StrategyPtr inner_;
+    const MarketData* store_;
+    const std::vector<uint64_t>* submit_tsc_;  // Per tick; only set on the first stage
+    std::vector<uint64_t> queue_wait_ticks_;
+    std::vector<uint64_t> process_ticks_;
+    uint64_t signals_ = 0;
+
+public:
+    TimedStrategy(winter::strategy::StrategyPtr inner, const MarketData* store,
+                  const std::vector<uint64_t>* submit_tsc, size_t expected_ticks)
+        : StrategyBase(inner->name()), inner_(std::move(inner)), store_(store), submit_tsc_(submit_tsc) {
+        process_ticks_.reserve(expected_ticks);
+        if (submit_tsc_) {
+            queue_wait_ticks_.reserve(expected_ticks);
+        }
+    }
+
+    void initialize() override { inner_->initialize(); }
+    void shutdown() override { inner_->shutdown(); }
+
+    std::vector<winter::core::Signal> process_tick(const MarketData& data) override {
+        std::vector<winter::core::Signal> signals;
+        append_signals(data, signals);
+        return signals;
+    }
+
+    void append_signals(const MarketData& data, std::vector<winter::core::Signal>& signals) override {
+        uint64_t start = winter::utils::tsc_now();
+        if (submit_tsc_) {
+            // Ticks are read in place from the store, so the address gives the index
+            queue_wait_ticks_.push_back(start - (*submit_tsc_)[static_cast<size_t>(&data - store_)]);
+        }
+        size_t before = signals.size();
+        inner_->append_signals(data, signals);
+        process_ticks_.push_back(winter::utils::tsc_now() - start);
+        signals_ += signals.size() - before;
+    }
+
+    uint64_t signals() const { return signals_; }
+    const std::vector<uint64_t>& queue_wait_ticks() const { return queue_wait_ticks_; }
+    const std::vector<uint64_t>& process_ticks() const { return process_ticks_; }
+};
+
+winter::strategy::StrategyPtr make_strategy(const std::string& name) {
+    if (name == "MeanReversion") {
+        return std::make_shared<MeanReversionStrategy>();
+    }
+    if (name == "StatArbitrage") {
+        return std::make_shared<StatisticalArbitrageStrategy>();
+    }
+    if (name == "SimpleMA") {
+        return std::make_shared<winter::examples::SimpleMAStrategy>();
+    }
+    return nullptr;
+}
+
+long peak_rss_kb() {
+#ifndef _WIN32
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+#else
+    return 0;
+#endif
+}
+
+// Best effort: lets each run report its own high-water mark (Linux 4.0+)
+void reset_peak_rss() {
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    if (clear_refs) {
+        clear_refs << "5";
+    }
+}
+
+std::string json_percentiles(const Percentiles& p) {
+    std::ostringstream out;
+    out << "{\"count\": " << p.count << ", \"mean\": " << p.mean << ", \"p50\": " << p.p50
+        << ", \"p90\": " << p.p90 << ", \"p99\": " << p.p99 << ", \"p99_9\": " << p.p999
+        << ", \"max\": " << p.max << "}";
+    return out.str();
+}
+
+std::string json_escape(const std::string& value) {
+    std::string out;
+    for (char c : value) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+        }
+        out += c;
+    }
+    return out;
+}
+
+// One replay of the whole store through a fresh engine
+std::string run_replay(const std::vector<MarketData>& store, const std::vector<std::string>& strategy_names,
+                       size_t batch_size) {
+    auto& tsc = winter::utils::TscClock::instance();
+    std::vector<uint64_t> submit_tsc(store.size(), 0);
+
+    winter::core::Engine engine;
+    winter::core::EngineConfiguration config;
+    config.batch_size = batch_size;
+    engine.configure(config);
+    engine.set_clock(std::make_shared<winter::core::SimulatedClock>());
+    engine.portfolio().set_cash(1000000.0);
+
+    std::vector<std::shared_ptr<TimedStrategy>> stages;
+    for (const auto& name : strategy_names) {
+        auto strategy = make_strategy(name);
+        if (!strategy) {
+            std::cerr << "Unknown strategy: " << name << std::endl;
+            return {};
+        }
+        strategy->set_clock(engine.clock());
+        auto stage = std::make_shared<TimedStrategy>(strategy, store.data(), stages.empty() ? &submit_tsc : nullptr,
+                                                     store.size());
+        stage->initialize();
+        engine.add_strategy(stage);
+        stages.push_back(stage);
+    }
+
+    reset_peak_rss();
+    engine.start();
+
+    auto allocations_before = winter::utils::AllocTracker::process_stats();
+    uint64_t start = winter::utils::tsc_now();
+
+    for (size_t begin = 0; begin < store.size(); begin += batch_size) {
+        size_t count = std::min(batch_size, store.size() - begin);
+        uint64_t now = winter::utils::tsc_now();
+        std::fill(submit_tsc.begin() + begin, submit_tsc.begin() + begin + count, now);
+        std::span<const MarketData> view(store.data() + begin, count);
+        while (!engine.try_process_market_data_view(view)) {
+            std::this_thread::yield();
+        }
+    }
+    while (engine.ticks_processed() < store.size()) {
+        std::this_thread::yield();
+    }
+
+    double seconds = tsc.elapsed_ns(start, winter::utils::tsc_now()) / 1e9;
+    auto allocated = winter::utils::AllocTracker::process_stats() - allocations_before;
+    engine.stop();
+    for (auto& stage : stages) {
+        stage->shutdown();
+    }
+
+    std::ostringstream out;
+    out << "    {\n      \"strategies\": [";
+    for (size_t i = 0; i < strategy_names.size(); ++i) {
+        out << (i ? ", " : "") << "\"" << json_escape(strategy_names[i]) << "\"";
+    }
+    out << "],\n";
+    out << "      \"seconds\": " << seconds << ",\n";
+    out << "      \"ticks_per_sec\": " << (seconds > 0.0 ? store.size() / seconds : 0.0) << ",\n";
+    out << "      \"allocations_per_tick\": " << static_cast<double>(allocated.allocations) / store.size() << ",\n";
+    out << "      \"allocated_bytes_per_tick\": " << static_cast<double>(allocated.bytes) / store.size() << ",\n";
+    out << "      \"peak_rss_kb\": " << peak_rss_kb() << ",\n";
+    out << "      \"trades\": " << engine.portfolio().trade_count() << ",\n";
+    out << "      \"stages_ns\": {\n";
+
+    std::vector<double> samples;
+    auto to_ns = [&tsc, &samples](const std::vector<uint64_t>& ticks) {
+        samples.clear();
+        samples.reserve(ticks.size());
+        for (uint64_t t : ticks) {
+            samples.push_back(tsc.elapsed_ns(0, t));
+        }
+        return summarize(samples);
+    };
+    out << "        \"queue_wait\": " << json_percentiles(to_ns(stages.front()->queue_wait_ticks()));
+    for (const auto& stage : stages) {
+        out << ",\n        \"" << json_escape(stage->name()) << ".process_tick\": "
+            << json_percentiles(to_ns(stage->process_ticks()));
+    }
+    out << "\n      }\n    }";
+    return out.str();
+}
+
+std::vector<std::string> split(const std::string& value, char separator) {
+    std::vector<std::string> parts;
+    std::stringstream ss(value);
+    std::string part;
+    while (std::getline(ss, part, separator)) {
+        if (!part.empty()) {
+            parts.push_back(part);
+        }
+    }
+    return parts;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    winter::utils::Logger::set_level(winter::utils::LogLevel::LOG_ERROR);
+
+    std::string data_file = "2021_Market_Data_RAW.csv";
+    std::string binary_file;
+    std::string output_file;
+    std::string run_spec = "MeanReversion;StatArbitrage;SimpleMA;MeanReversion,StatArbitrage,SimpleMA";
+    size_t batch_size = 10000;
+    size_t max_ticks = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&]() -> std::string { return i + 1 < argc ? argv[++i] : ""; };
+        if (arg == "--data") {
+            data_file = next();
+        } else if (arg == "--binary") {
+            binary_file = next();
+        } else if (arg == "--output") {
+            output_file = next();
+        } else if (arg == "--runs") {
+            run_spec = next();
+        } else if (arg == "--batch-size") {
+            batch_size = std::max<size_t>(1, std::stoul(next()));
+        } else if (arg == "--max-ticks") {
+            max_ticks = std::stoul(next());
+        } else {
+            std::cerr << "Usage: replay_benchmark [--data file.csv] [--binary store.bin] [--output result.json]\n"
+                      << "                        [--runs \"A;B;A,B\"] [--batch-size N] [--max-ticks N]\n"
+                      << "  --binary  load the tick store from this file, creating it from --data if missing\n"
+                      << "  --runs    ';'-separated runs, each a ','-separated strategy list\n"
+                      << "            (MeanReversion, StatArbitrage, SimpleMA)" << std::endl;
+            return 1;
+        }
+    }
+
+    // Load the tick store
+    std::vector<MarketData> store;
+    std::string source = "csv";
+    auto& tsc = winter::utils::TscClock::instance();
+    uint64_t load_start = winter::utils::tsc_now();
+    bool loaded;
+    if (!binary_file.empty() && std::filesystem::exists(binary_file)) {
+        source = "binary";
+        loaded = winter::backtest::load_market_data_binary(binary_file, store);
+    } else {
+        loaded = winter::backtest::load_market_data_csv(data_file, store);
+    }
+    double load_seconds = tsc.elapsed_ns(load_start, winter::utils::tsc_now()) / 1e9;
+    if (!loaded) {
+        std::cerr << "Failed to load market data" << std::endl;
+        return 1;
+    }
+    if (!binary_file.empty() && source == "csv") {
+        winter::backtest::save_market_data_binary(binary_file, store);
+    }
+    if (max_ticks > 0 && store.size() > max_ticks) {
+        store.resize(max_ticks);
+    }
+
+    std::unordered_set<std::string> symbols;
+    for (const auto& tick : store) {
+        symbols.insert(tick.symbol);
+    }
+
+    std::ostringstream json;
+    json << "{\n";
+    json << "  \"benchmark\": \"replay\",\n";
+    json << "  \"data_file\": \"" << json_escape(source == "binary" ? binary_file : data_file) << "\",\n";
+    json << "  \"ticks\": " << store.size() << ",\n";
+    json << "  \"symbols\": " << symbols.size() << ",\n";
+    json << "  \"batch_size\": " << batch_size << ",\n";
+    json << "  \"load\": {\"source\": \"" << source << "\", \"seconds\": " << load_seconds << "},\n";
+    json << "  \"runs\": [\n";
+    bool first = true;
+    for (const auto& run : split(run_spec, ';')) {
+        std::string result = run_replay(store, split(run, ','), batch_size);
+        if (result.empty()) {
+            return 1;
+        }
+        json << (first ? "" : ",\n") << result;
+        first = false;
+    }
+    json << "\n  ]\n}\n";
+
+    if (output_file.empty()) {
+        std::cout << json.str();
+    } else {
+        std::ofstream out(output_file);
+        out << json.str();
+        std::cerr << "Wrote " << output_file << std::endl;
+    }
+    return 0;
+}
@@ -2,6 +2,7 @@
 #include <winter/strategy/strategy_registry.hpp>
 #include <winter/utils/logger.hpp>
 #include <winter/utils/flamegraph.hpp>
+#include <winter/utils/tsc_clock.hpp>
 
 #include <chrono>
 #include <iostream>
@@ -60,9 +61,7 @@ winter::core::MarketData generate_market_data(std::mt19937& rng) {
     data.symbol = symbols[symbol_dist(rng)];
     data.price = price_dist(rng);
     data.volume = volume_dist(rng);
-    data.timestamp = std::chrono::duration_cast<std::chrono::microseconds>(
-        std::chrono::high_resolution_clock::now().time_since_epoch()
-    ).count();
+    data.timestamp = winter::utils::TscClock::instance().now_epoch_ns() / 1000;
     
     return data;
 }
@@ -124,7 +123,7 @@ int main(int argc, char* argv[]) {
     std::vector<std::thread> producer_threads;
     std::atomic<int> ticks_processed(0);
     
-    auto start_time = std::chrono::high_resolution_clock::now();
+    uint64_t start_tsc = winter::utils::tsc_now();
     
     for (int i = 0; i < num_producers; ++i) {
         producer_threads.emplace_back(
@@ -150,10 +149,8 @@ int main(int argc, char* argv[]) {
         }
     }
     
-    auto end_time = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
-        end_time - start_time
-    ).count();
+    uint64_t end_tsc = winter::utils::tsc_now();
+    double duration = winter::utils::TscClock::instance().elapsed_ns(start_tsc, end_tsc) / 1000.0;
     
     // Stop engine
     engine.stop();
@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+#include <winter/core/engine.hpp>
+#include <winter/core/market_data.hpp>
+#include <winter/utils/alloc_tracker.hpp>
+#include "examples/strategy_ma_strategy/simple_ma_strategy.hpp"
+#include "strategies/mean_reversion_strategy.hpp"
+#include "strategies/stat_arbitrage.hpp"
+
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Links winter_alloc_hooks, so every heap allocation in the process is counted.
+// The steady-state tests fail if the engine threads or the reference
+// strategies allocate once they are warmed up.
+
+namespace {
+
+constexpr size_t WARMUP_TICKS = 20000;
+constexpr size_t MEASURED_TICKS = 20000;
+
+// Random walk over a few symbols with varying volume
+std::vector<winter::core::MarketData> make_ticks(size_t count) {
+    const std::vector<std::string> symbols = {"AAPL", "MSFT", "GOOGL", "AMZN", "META", "TSLA", "NVDA", "JPM"};
+    std::mt19937 rng(1234);
+    std::normal_distribution<double> step(0.0, 0.4);
+    std::uniform_int_distribution<int> volume(10, 2000);
+    std::vector<double> prices(symbols.size(), 100.0);
+
+    std::vector<winter::core::MarketData> ticks(count);
+    for (size_t i = 0; i < count; ++i) {
+        size_t s = i % symbols.size();
+        prices[s] = std::max(10.0, prices[s] + step(rng));
+        ticks[i].symbol = symbols[s];
+        ticks[i].price = prices[s];
+        ticks[i].volume = volume(rng);
+        ticks[i].timestamp = static_cast<int64_t>(i);
+    }
+    return ticks;
+}
+
+// StatisticalArbitrageStrategy is covered on its own below: its per-tick work
+// runs on shared-pool drains, which are not held to zero allocations
+std::vector<winter::strategy::StrategyPtr> reference_strategies() {
+    std::vector<winter::strategy::StrategyPtr> strategies = {
+        std::make_shared<winter::examples::SimpleMAStrategy>(),
+        std::make_shared<MeanReversionStrategy>()};
+    for (auto& strategy : strategies) {
+        strategy->initialize();
+    }
+    return strategies;
+}
+
+struct LoopAllocations {
+    uint64_t strategy = 0;
+    uint64_t execution = 0;
+    size_t trades = 0;
+};
+
+// Warms the engine up, then counts what its loops allocate over the next
+// MEASURED_TICKS ticks
+LoopAllocations measure_engine_loops(const std::vector<winter::strategy::StrategyPtr>& strategies,
+                                     size_t warmup_ticks = WARMUP_TICKS) {
+    auto ticks = make_ticks(warmup_ticks + MEASURED_TICKS);
+
+    winter::core::Engine engine;
+    winter::core::EngineConfiguration config;
+    // Fills land before the next tick, so the execution count is settled
+    // whenever the tick counter is
+    config.sequential_fills = true;
+    engine.configure(config);
+    engine.portfolio().set_cash(1e9);
+    // The trade log is the one structure that grows for the whole run
+    engine.portfolio().reserve_trades(2 * ticks.size());
+    for (const auto& strategy : strategies) {
+        engine.add_strategy(strategy);
+    }
+    engine.start();
+
+    auto feed = [&](size_t begin, size_t end) {
+        EXPECT_TRUE(engine.try_process_market_data_view({ticks.data() + begin, end - begin}));
+        while (engine.ticks_processed() < end) {
+            std::this_thread::yield();
+        }
+    };
+
+    feed(0, warmup_ticks);
+    uint64_t strategy_warm = engine.strategy_loop_allocations();
+    uint64_t execution_warm = engine.execution_loop_allocations();
+    size_t trades_warm = engine.portfolio().trade_count();
+
+    feed(warmup_ticks, ticks.size());
+    LoopAllocations measured;
+    measured.strategy = engine.strategy_loop_allocations() - strategy_warm;
+    measured.execution = engine.execution_loop_allocations() - execution_warm;
+    measured.trades = engine.portfolio().trade_count() - trades_warm;
+    engine.stop();
+    return measured;
+}
+
+} // namespace
+
+TEST(AllocTrackerTest, CountsPerThreadAndScope) {
+    ASSERT_TRUE(winter::utils::AllocTracker::hooks_installed());
+
+    auto process_before = winter::utils::AllocTracker::process_stats();
+    winter::utils::AllocStats outer;
+    {
+        winter::utils::AllocScope scope("outer");
+        auto value = std::make_unique<int64_t>(42);
+        {
+            winter::utils::AllocScope inner("inner");
+            std::vector<char> buffer(1000);
+            EXPECT_EQ(inner.stats().allocations, 1u);
+            EXPECT_EQ(inner.stats().bytes, 1000u);
+        }
+
+        // Another thread's allocations do not land in this thread's scope
+        std::thread([]() { std::vector<char> other(500); }).join();
+        outer = scope.stats();
+    }
+    EXPECT_GE(outer.allocations, 2u);
+    EXPECT_GE(outer.bytes, 1000u + sizeof(int64_t));
+    EXPECT_LT(outer.bytes, 1500u);
+
+    auto process = winter::utils::AllocTracker::process_stats() - process_before;
+    EXPECT_GE(process.bytes, 1500u + sizeof(int64_t));
+    EXPECT_EQ(process.allocations, process.deallocations);
+}
+
+TEST(AllocTrackerTest, ReferenceStrategiesTickWithoutAllocating) {
+    auto ticks = make_ticks(WARMUP_TICKS + MEASURED_TICKS);
+    std::vector<winter::core::Signal> signals;
+    signals.reserve(16);
+
+    size_t total_signals = 0;
+    for (auto& strategy : reference_strategies()) {
+        for (size_t i = 0; i < WARMUP_TICKS; ++i) {
+            signals.clear();
+            strategy->append_signals(ticks[i], signals);
+        }
+
+        winter::utils::AllocScope scope(strategy->name());
+        for (size_t i = WARMUP_TICKS; i < ticks.size(); ++i) {
+            signals.clear();
+            strategy->append_signals(ticks[i], signals);
+            total_signals += signals.size();
+        }
+        EXPECT_EQ(scope.stats().allocations, 0u) << strategy->name() << " allocated after warm-up";
+    }
+    EXPECT_GT(total_signals, 0u);
+}
+
+TEST(AllocTrackerTest, EngineLoopsAreAllocationFreeInSteadyState) {
+    auto measured = measure_engine_loops(reference_strategies());
+
+    EXPECT_GT(measured.trades, 0u) << "No orders filled after warm-up; the test is not exercising execution";
+    EXPECT_EQ(measured.strategy, 0u);
+    EXPECT_EQ(measured.execution, 0u);
+}
+
+// StatArb copies each tick into a preallocated shard ring and hands it to a
+// shared-pool drain. What may still allocate on the strategy thread is
+// occasional: the pool's task deque growing a node, or a burst of signals
+// larger than any seen in warm-up. Allocating per tick would be 20000 here.
+TEST(AllocTrackerTest, StatArbitrageDoesNotAllocatePerTick) {
+    auto strategy = std::make_shared<StatisticalArbitrageStrategy>();
+    strategy->initialize();
+    // Its pairs buy both legs on one tick, sized from the same cash, so the
+    // second leg is often rejected; rejections log a formatted warning
+    winter::utils::Logger::set_level(winter::utils::LogLevel::LOG_ERROR);
+    // Entries wait for a full spread history per pair, so the first fills (and
+    // the portfolio's first positions) come later than for the others
+    auto measured = measure_engine_loops({strategy}, 4 * WARMUP_TICKS);
+    winter::utils::Logger::set_level(winter::utils::LogLevel::INFO);
+
+    EXPECT_GT(measured.trades, 0u);
+    EXPECT_LE(measured.strategy, MEASURED_TICKS / 100);
+    EXPECT_EQ(measured.execution, 0u);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,453 @@
+#include <gtest/gtest.h>
+#include <winter/utils/downsample.hpp>
+#include <winter/backtest/report_writer.hpp>
+#include <winter/backtest/monte_carlo.hpp>
+#include <winter/backtest/multi_strategy_backtest.hpp>
+#include <winter/backtest/csv_loader.hpp>
+#include <winter/backtest/report.hpp>
+#include <winter/utils/random.hpp>
+#include <winter/runtime/execution.hpp>
+#include <winter/runtime/ingest.hpp>
+
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// LTTB keeps endpoints and respects the requested point budget
+TEST(DownsampleTest, LttbKeepsEndpointsAndBudget) {
+    std::vector<double> values(10000);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = std::sin(i * 0.01);
+    }
+
+    std::vector<size_t> selected;
+    winter::utils::lttb_downsample(values.size(), 100,
+        [](size_t i) { return static_cast<double>(i); },
+        [&](size_t i) { return values[i]; },
+        [&](size_t i) { selected.push_back(i); });
+
+    ASSERT_EQ(selected.size(), 100u);
+    EXPECT_EQ(selected.front(), 0u);
+    EXPECT_EQ(selected.back(), values.size() - 1);
+    for (size_t i = 1; i < selected.size(); ++i) {
+        EXPECT_LT(selected[i - 1], selected[i]);
+    }
+}
+
+// A single-point drawdown trough must survive downsampling
+TEST(DownsampleTest, LttbKeepsDrawdownTrough) {
+    std::vector<double> equity(100000, 100000.0);
+    const size_t trough = 54321;
+    equity[trough] = 50000.0;
+
+    bool kept_trough = false;
+    winter::utils::lttb_downsample(equity.size(), 1000,
+        [](size_t i) { return static_cast<double>(i); },
+        [&](size_t i) { return equity[i]; },
+        [&](size_t i) { kept_trough |= (i == trough); });
+
+    EXPECT_TRUE(kept_trough);
+}
+
+// Inputs under the budget are passed through unchanged
+TEST(DownsampleTest, LttbPassThroughSmallInput) {
+    std::vector<size_t> selected;
+    winter::utils::lttb_downsample(5, 100,
+        [](size_t i) { return static_cast<double>(i); },
+        [](size_t i) { return static_cast<double>(i * i); },
+        [&](size_t i) { selected.push_back(i); });
+
+    EXPECT_EQ(selected, (std::vector<size_t>{0, 1, 2, 3, 4}));
+}
+
+// Report data is written as a loadable script next to the HTML file
+TEST(ReportWriterTest, WritesDataFile) {
+    const std::string html = "report_writer_test.html";
+    EXPECT_EQ(winter::backtest::ReportWriter::data_file_for(html), "report_writer_test.data.js");
+
+    std::vector<double> ys = {1.0, 2.5, -3.0};
+    std::vector<std::string> labels = {"AAPL", "MS\"FT", "GOOG"};
+    {
+        winter::backtest::ReportWriter writer(html, 10);
+        ASSERT_TRUE(writer.is_open());
+        writer.number("initial", 100000.0);
+        writer.series("equity", ys.size(),
+            [](size_t i) { return static_cast<double>(i); },
+            [&](size_t i) { return ys[i]; },
+            [&](size_t i) -> std::string_view { return labels[i]; });
+        EXPECT_TRUE(writer.close());
+    }
+
+    std::ifstream in("report_writer_test.data.js");
+    std::stringstream content;
+    content << in.rdbuf();
+    EXPECT_EQ(content.str(),
+              "window.WINTER_REPORT = {\n"
+              "\"initial\":1e+05,\n"
+              "\"equity\":{\"x\":[0,1,2],\"y\":[1,2.5,-3],\"label\":[\"AAPL\",\"MS\\\"FT\",\"GOOG\"]}\n"
+              "};\n");
+    std::remove("report_writer_test.data.js");
+}
+
+// One metrics.json per run: run facts, then one object per strategy lane
+TEST(ReportTest, MetricsJsonCoversEveryLane) {
+    winter::backtest::RunSummary run;
+    run.mode = "lanes";
+    run.data_files = {"day \"1\".csv", "C:\\data\\day2.csv"};
+    run.ticks = 1000;
+    run.threads = 4;
+    run.profile = {{"run_ms", 12.5}};
+
+    std::vector<winter::backtest::StrategyResult> results(2);
+    results[0].strategy_name = "Fast";
+    results[0].metrics.final_capital = 101000.0;
+    results[0].metrics.total_trades = 7;
+    results[0].orders_executed = 7;
+    results[1].strategy_name = "Slow\tv2";
+    results[1].metrics.sharpe_ratio = std::nan("");
+    results[1].orders_rejected = 2;
+
+    const std::string file = "metrics_json_test.json";
+    ASSERT_TRUE(winter::backtest::write_metrics_json(file, run, results));
+    std::ifstream in(file);
+    std::stringstream content;
+    content << in.rdbuf();
+    const std::string json = content.str();
+    std::remove(file.c_str());
+
+    auto has = [&json](const std::string& text) { return json.find(text) != std::string::npos; };
+    EXPECT_TRUE(has(R"("mode": "lanes")"));
+    EXPECT_TRUE(has(R"("data_files": ["day \"1\".csv", "C:\\data\\day2.csv"])"));
+    EXPECT_TRUE(has(R"("ticks": 1000)"));
+    EXPECT_TRUE(has(R"("threads": 4)"));
+    EXPECT_TRUE(has(R"("profile": {"run_ms": 12.5})"));
+    EXPECT_TRUE(has(R"({"name": "Fast", "initial_capital": 0, "final_capital": 101000)"));
+    EXPECT_TRUE(has(R"("total_trades": 7)"));
+    EXPECT_TRUE(has(R"({"name": "Slow\tv2")"));
+    EXPECT_TRUE(has(R"("sharpe_ratio": null)"));  // NaN is not valid JSON
+    EXPECT_TRUE(has(R"("orders_rejected": 2})"));
+    EXPECT_EQ(json.find('\t'), std::string::npos);
+
+    // Lanes get their own files; a single result keeps the plain name
+    EXPECT_EQ(winter::backtest::result_file_name("trades.csv", results[0], 2), "Fast_trades.csv");
+    EXPECT_EQ(winter::backtest::result_file_name("trades.csv", results[0], 1), "trades.csv");
+    results[1].strategy_name = "A/B";
+    EXPECT_EQ(winter::backtest::result_file_name("report.html", results[1], 2), "A_B_report.html");
+}
+
+// Binary tick store reproduces the ticks it was written from
+TEST(TickStoreTest, BinaryRoundTrip) {
+    std::vector<winter::core::MarketData> ticks;
+    for (int i = 0; i < 100; ++i) {
+        winter::core::MarketData tick(i % 3 == 0 ? "AAPL" : "MSFT", 100.0 + i * 0.25, 10 + i);
+        tick.timestamp = i;
+        ticks.push_back(tick);
+    }
+
+    const std::string file = "tick_store_test.bin";
+    ASSERT_TRUE(winter::backtest::save_market_data_binary(file, ticks));
+    std::vector<winter::core::MarketData> loaded;
+    ASSERT_TRUE(winter::backtest::load_market_data_binary(file, loaded));
+    ASSERT_EQ(loaded.size(), ticks.size());
+    for (size_t i = 0; i < ticks.size(); ++i) {
+        EXPECT_EQ(loaded[i].symbol, ticks[i].symbol);
+        EXPECT_EQ(loaded[i].price, ticks[i].price);
+        EXPECT_EQ(loaded[i].volume, ticks[i].volume);
+        EXPECT_EQ(loaded[i].timestamp, ticks[i].timestamp);
+    }
+
+    // A truncated file is refused
+    std::filesystem::resize_file(file, std::filesystem::file_size(file) - 5);
+    EXPECT_FALSE(winter::backtest::load_market_data_binary(file, loaded));
+    std::remove(file.c_str());
+}
+
+// load_market_data tells tick stores, CSV tapes and Parquet apart by content
+TEST(TickStoreTest, LoaderDetectsFormat) {
+    std::vector<winter::core::MarketData> ticks(2, winter::core::MarketData("AAPL", 101.5, 200));
+    ticks[1].timestamp = 1;
+    ASSERT_TRUE(winter::backtest::save_market_data_binary("loader_test.csv", ticks));
+    std::vector<winter::core::MarketData> loaded;
+    ASSERT_TRUE(winter::backtest::load_market_data("loader_test.csv", loaded));
+    EXPECT_EQ(loaded.size(), 2u);
+
+    {
+        std::ofstream csv("loader_test.csv");
+        csv << "Time,Symbol,Market Center,Price,Size\n09:30:00,MSFT,Q,250.25,10\n";
+    }
+    ASSERT_TRUE(winter::backtest::load_market_data("loader_test.csv", loaded));
+    ASSERT_EQ(loaded.size(), 1u);
+    EXPECT_EQ(loaded[0].symbol, "MSFT");
+    EXPECT_EQ(loaded[0].timestamp, 34200LL * 1000000);
+
+    {
+        std::ofstream parquet("loader_test.csv", std::ios::binary);
+        parquet << "PAR1 not really";
+    }
+    EXPECT_FALSE(winter::backtest::load_market_data("loader_test.csv", loaded));
+    EXPECT_FALSE(winter::backtest::load_market_data("loader_test_missing.csv", loaded));
+    std::remove("loader_test.csv");
+}
+
+// The Time column is event time; equal and out-of-order prints keep file order
+TEST(TickStoreTest, TapeTimesBecomeEventTime) {
+    int64_t us = 0;
+    EXPECT_TRUE(winter::backtest::parse_tape_time("09:30:00", us));
+    EXPECT_EQ(us, 34200LL * 1000000);
+    EXPECT_TRUE(winter::backtest::parse_tape_time("09:38:36.769", us));
+    EXPECT_EQ(us, (9 * 3600 + 38 * 60 + 36) * 1000000LL + 769000);
+    EXPECT_TRUE(winter::backtest::parse_tape_time("04:00:00.0000019", us));
+    EXPECT_EQ(us, 4 * 3600 * 1000000LL + 1);
+    EXPECT_FALSE(winter::backtest::parse_tape_time("12345", us));
+    EXPECT_FALSE(winter::backtest::parse_tape_time("9:30:00", us));
+    EXPECT_FALSE(winter::backtest::parse_tape_time("09:30:00.", us));
+    EXPECT_FALSE(winter::backtest::parse_tape_time("24:00:00", us));
+    EXPECT_EQ(winter::backtest::format_tape_time(34200LL * 1000000 + 5), "09:30:00.000005");
+
+    {
+        std::ofstream csv("tape_time_test.csv");
+        csv << "Time,Symbol,Market Center,Price,Size\n"
+            << "09:30:00.250000,AAA,Q,10,1\n"
+            << "09:30:00.250000,BBB,Q,20,1\n"
+            << "09:29:59.900000,CCC,Q,30,1\n"
+            << "10:00:00,DDD,Q,40,1\n";
+    }
+    std::vector<winter::core::MarketData> first;
+    ASSERT_TRUE(winter::backtest::load_market_data("tape_time_test.csv", first));
+    ASSERT_EQ(first.size(), 4u);
+    EXPECT_EQ(first[0].symbol, "AAA");
+    EXPECT_EQ(first[1].symbol, "BBB");
+    EXPECT_EQ(first[1].timestamp, first[0].timestamp);
+    EXPECT_EQ(first[2].symbol, "CCC");
+    EXPECT_EQ(first[2].timestamp, first[1].timestamp);
+    EXPECT_EQ(first[3].timestamp - first[0].timestamp, 1799750000);
+
+    // A second day's tape moves on by whole days
+    std::vector<winter::core::MarketData> both;
+    ASSERT_TRUE(winter::runtime::load_ticks({"tape_time_test.csv", "tape_time_test.csv"}, both));
+    ASSERT_EQ(both.size(), 8u);
+    EXPECT_EQ(both[4].timestamp, first[0].timestamp + winter::backtest::TAPE_DAY_US);
+    EXPECT_EQ(winter::backtest::format_tape_time(both[7].timestamp), "10:00:00.000000");
+    std::remove("tape_time_test.csv");
+}
+
+// Counter-based streams are reproducible and distinct
+TEST(RandomTest, PhiloxStreams) {
+    winter::utils::Philox4x32 a(7, 0), b(7, 0), c(7, 1);
+    bool differs = false;
+    for (int i = 0; i < 100; ++i) {
+        uint32_t va = a(), vb = b(), vc = c();
+        EXPECT_EQ(va, vb);
+        differs |= (va != vc);
+    }
+    EXPECT_TRUE(differs);
+
+    winter::utils::Philox4x32 rng(1);
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_LT(rng.below(10), 10u);
+        double u = rng.uniform();
+        EXPECT_GE(u, 0.0);
+        EXPECT_LT(u, 1.0);
+    }
+}
+
+// Results depend on the seed only, not on the number of worker threads
+TEST(MonteCarloTest, ReproducibleAcrossThreadCounts) {
+    std::vector<double> returns;
+    winter::utils::Philox4x32 rng(3);
+    for (int i = 0; i < 500; ++i) {
+        returns.push_back((rng.uniform() - 0.48) * 0.02);
+    }
+
+    winter::backtest::MonteCarloConfiguration config;
+    config.simulations = 2000;
+    config.thread_count = 1;
+    auto single = winter::backtest::MonteCarloEngine(config).run_on_returns(returns, 100000.0);
+
+    config.thread_count = 4;
+    auto multi = winter::backtest::MonteCarloEngine(config).run_on_returns(returns, 100000.0);
+
+    EXPECT_EQ(single.simulations, 2000u);
+    EXPECT_DOUBLE_EQ(single.sharpe_ratio.median, multi.sharpe_ratio.median);
+    EXPECT_DOUBLE_EQ(single.max_drawdown_pct.upper, multi.max_drawdown_pct.upper);
+    EXPECT_DOUBLE_EQ(single.terminal_equity.lower, multi.terminal_equity.lower);
+
+    EXPECT_LE(single.sharpe_ratio.lower, single.sharpe_ratio.median);
+    EXPECT_LE(single.sharpe_ratio.median, single.sharpe_ratio.upper);
+    EXPECT_LE(single.terminal_equity.lower, single.terminal_equity.upper);
+    EXPECT_GE(single.max_drawdown_pct.lower, 0.0);
+}
+
+// Reshuffling trades only changes the path, never the terminal equity
+TEST(MonteCarloTest, ReshuffleKeepsTerminalEquity) {
+    std::vector<double> pnl = {500.0, -200.0, 300.0, -800.0, 1200.0, -100.0, 50.0};
+
+    winter::backtest::MonteCarloConfiguration config;
+    config.simulations = 500;
+    config.method = winter::backtest::ResamplingMethod::RESHUFFLE;
+    auto result = winter::backtest::MonteCarloEngine(config).run_on_trades(pnl, 10000.0);
+
+    EXPECT_NEAR(result.terminal_equity.lower, 10950.0, 1e-6);
+    EXPECT_NEAR(result.terminal_equity.upper, 10950.0, 1e-6);
+    EXPECT_LT(result.max_drawdown_pct.lower, result.max_drawdown_pct.upper);
+    EXPECT_DOUBLE_EQ(result.probability_of_loss, 0.0);
+}
+
+// Buys on the first tick of a symbol and sells once the price moves by `exit_move`
+class ThresholdStrategy : public winter::strategy::StrategyBase {
+private:
+    double exit_move_;
+    double entry_price_ = 0.0;
+    bool in_position_ = false;
+
+public:
+    ThresholdStrategy(const std::string& name, double exit_move)
+        : StrategyBase(name), exit_move_(exit_move) {}
+
+    std::vector<winter::core::Signal> process_tick(const winter::core::MarketData& data) override {
+        if (!in_position_) {
+            in_position_ = true;
+            entry_price_ = data.price;
+            return {winter::core::Signal(data.symbol, winter::core::SignalType::BUY, 1.0, data.price)};
+        }
+        if (std::abs(data.price - entry_price_) >= exit_move_) {
+            in_position_ = false;
+            return {winter::core::Signal(data.symbol, winter::core::SignalType::SELL, 1.0, data.price)};
+        }
+        return {};
+    }
+};
+
+// One data pass feeds isolated portfolios, one per strategy
+TEST(MultiStrategyBacktestTest, IsolatedLanesShareOnePass) {
+    std::vector<winter::core::MarketData> ticks;
+    for (int i = 0; i < 1000; ++i) {
+        winter::core::MarketData tick("AAPL", 100.0 + (i % 50), 100);
+        tick.timestamp = i;
+        ticks.push_back(tick);
+    }
+
+    winter::backtest::BacktestConfiguration config;
+    config.batch_size = 64;
+    config.thread_count = 2;
+
+    winter::backtest::MultiStrategyBacktest backtest;
+    backtest.configure(config);
+    auto fast = std::make_shared<ThresholdStrategy>("Fast", 5.0);
+    auto slow = std::make_shared<ThresholdStrategy>("Slow", 40.0);
+    ASSERT_TRUE(backtest.add_strategy(fast));
+    ASSERT_TRUE(backtest.add_strategy(slow));
+    EXPECT_FALSE(backtest.add_strategy(fast));
+    backtest.initialize(100000.0);
+    backtest.set_data(ticks);
+    ASSERT_TRUE(backtest.run());
+
+    auto results = backtest.get_results();
+    ASSERT_EQ(results.size(), 2u);
+    EXPECT_EQ(results[0].strategy_name, "Fast");
+    EXPECT_EQ(results[1].strategy_name, "Slow");
+
+    // Each lane traded on its own schedule and cash
+    EXPECT_GT(results[0].orders_executed, results[1].orders_executed);
+    EXPECT_EQ(results[0].trades.size(), results[0].orders_executed);
+    EXPECT_EQ(results[1].trades.size(), results[1].orders_executed);
+    EXPECT_EQ(results[0].orders_rejected, 0u);
+
+    // Running again from a fresh state reproduces the same results
+    auto fast2 = std::make_shared<ThresholdStrategy>("Fast", 5.0);
+    winter::backtest::MultiStrategyBacktest single;
+    single.configure(config);
+    single.add_strategy(fast2);
+    single.initialize(100000.0);
+    single.set_data(ticks);
+    ASSERT_TRUE(single.run());
+    EXPECT_EQ(single.get_results()[0].orders_executed, results[0].orders_executed);
+    EXPECT_DOUBLE_EQ(single.get_results()[0].metrics.final_capital, results[0].metrics.final_capital);
+}
+
+TEST(RuntimeTest, DecodesFeedMessages) {
+    winter::core::MarketData data;
+    ASSERT_TRUE(winter::runtime::decode_json_tick(R"({"Symbol": "AAPL", "Price": 132.69, "Size": 100})", data));
+    EXPECT_EQ(data.symbol, "AAPL");
+    EXPECT_DOUBLE_EQ(data.price, 132.69);
+    EXPECT_EQ(data.volume, 100);
+
+    // Quoted numbers are accepted, a missing field leaves data alone
+    ASSERT_TRUE(winter::runtime::decode_json_tick(R"({"Size":"7","Symbol":"MSFT","Price":"250.5"})", data));
+    EXPECT_EQ(data.symbol, "MSFT");
+    EXPECT_DOUBLE_EQ(data.price, 250.5);
+    EXPECT_EQ(data.volume, 7);
+    EXPECT_FALSE(winter::runtime::decode_json_tick(R"({"Symbol": "IBM", "Size": 5})", data));
+    EXPECT_FALSE(winter::runtime::decode_json_tick(R"({"Symbol": "IBM", "Price": "abc", "Size": 5})", data));
+    EXPECT_EQ(data.symbol, "MSFT");
+}
+
+TEST(RuntimeTest, ZScoreTrackerMatchesFullRecompute) {
+    const size_t window = 5;
+    winter::runtime::ZScoreTracker tracker(window);
+    std::vector<double> prices;
+    for (int i = 0; i < 3000; ++i) {
+        double price = 1000.0 + 10.0 * std::sin(i * 0.37) + (i % 7);
+        prices.push_back(price);
+        double z = tracker.update("AAA", price);
+        ASSERT_EQ(tracker.last("AAA"), z);
+
+        size_t first = prices.size() > window ? prices.size() - window : 0;
+        double mean = 0.0;
+        for (size_t j = first; j < prices.size(); ++j) mean += prices[j];
+        mean /= static_cast<double>(prices.size() - first);
+        double var = 0.0;
+        for (size_t j = first; j < prices.size(); ++j) var += (prices[j] - mean) * (prices[j] - mean);
+        var /= static_cast<double>(prices.size() - first);
+        double expected = var > 0.0 && prices.size() > 1 ? (price - mean) / std::sqrt(var) : 0.0;
+        ASSERT_NEAR(z, expected, 1e-6) << "update " << i;
+    }
+    EXPECT_EQ(tracker.last("ZZZ"), 0.0);
+
+    // A flat window has no spread to score against
+    winter::runtime::ZScoreTracker flat(window);
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(flat.update("FLAT", 42.0), 0.0);
+    }
+}
+
+TEST(RuntimeTest, LedgerReportsAverageCostPnl) {
+    using winter::core::Order;
+    using winter::core::OrderSide;
+    winter::runtime::TradeLedger ledger;
+    ledger.record_fill(Order("AAA", OrderSide::BUY, 10, 100.0), "1", 1);
+    ledger.record_fill(Order("AAA", OrderSide::BUY, 10, 110.0), "2", 2);
+    const auto& sell = ledger.record_fill(Order("AAA", OrderSide::SELL, 5, 120.0), "3", 3);
+    EXPECT_DOUBLE_EQ(sell.profit_loss, 5 * (120.0 - 105.0));
+    EXPECT_DOUBLE_EQ(sell.value, 600.0);
+    ledger.record_fill(Order("AAA", OrderSide::SELL, 15, 100.0), "4", 4);
+    EXPECT_DOUBLE_EQ(ledger.realized_pnl(), 0.0);
+
+    auto closed = winter::runtime::closed_trades(ledger.trades());
+    ASSERT_EQ(closed.size(), 2u);
+    EXPECT_DOUBLE_EQ(closed[0].profit, 75.0);
+    EXPECT_DOUBLE_EQ(closed[1].profit, -75.0);
+
+    // Replayed fills get the z-score of the tick they filled on
+    std::vector<winter::core::MarketData> ticks;
+    for (int i = 1; i <= 4; ++i) {
+        winter::core::MarketData tick("AAA", 100.0 + i * i, 1);
+        tick.timestamp = i;
+        ticks.push_back(tick);
+    }
+    auto trades = ledger.trades();
+    winter::runtime::annotate_z_scores(trades, ticks);
+    winter::runtime::ZScoreTracker tracker;
+    for (size_t i = 0; i < ticks.size(); ++i) {
+        EXPECT_DOUBLE_EQ(trades[i].z_score, tracker.update("AAA", ticks[i].price));
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
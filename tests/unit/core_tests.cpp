@@ -4,11 +4,26 @@
 #include <winter/core/signal.hpp>
 #include <winter/core/order.hpp>
 #include <winter/core/portfolio.hpp>
+#include <winter/core/execution.hpp>
+#include <winter/core/checkpoint.hpp>
+#include <winter/core/config_reloader.hpp>
+#include <winter/core/journal.hpp>
+#include <winter/core/async.hpp>
 #include <winter/strategy/strategy_base.hpp>
+#include <winter/utils/tsc_clock.hpp>
+#include <winter/utils/thread_pool.hpp>
+#include <winter/utils/thread_placement.hpp>
 
 #include <vector>
 #include <memory>
 #include <string>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <unistd.h>
 
 // Test strategy that always generates a buy signal
 class TestBuyStrategy : public winter::strategy::StrategyBase {
@@ -98,6 +113,58 @@ TEST_F(EngineTest, ProcessMarketData) {
     EXPECT_GT(engine->portfolio().get_position("AAPL"), 0);
 }
 
+TEST_F(EngineTest, StrategySetChangesWhileTicksFlow) {
+    // Counts ticks, and destructions so retired sets are seen to be freed
+    struct CountingStrategy : winter::strategy::StrategyBase {
+        std::atomic<int>* alive;
+        std::atomic<uint64_t> ticks{0};
+        CountingStrategy(std::string name, std::atomic<int>* alive) : StrategyBase(std::move(name)), alive(alive) { ++*alive; }
+        ~CountingStrategy() override { --*alive; }
+        std::vector<winter::core::Signal> process_tick(const winter::core::MarketData&) override {
+            ticks.fetch_add(1, std::memory_order_relaxed);
+            return {};
+        }
+    };
+    
+    std::atomic<int> alive{0};
+    auto anchor = std::make_shared<CountingStrategy>("Anchor", &alive);
+    engine->add_strategy(anchor);
+    engine->start();
+    
+    std::atomic<bool> feeding{true};
+    std::thread feeder([&]() {
+        while (feeding) {
+            engine->try_process_market_data(winter::core::MarketData("AAPL", 100.0, 10));
+        }
+    });
+    
+    for (int i = 0; i < 200; ++i) {
+        const std::string name = "Churn" + std::to_string(i % 4);
+        if (engine->get_strategy(name)) {
+            engine->remove_strategy(name);
+        } else {
+            engine->add_strategy(std::make_shared<CountingStrategy>(name, &alive));
+        }
+        anchor->set_enabled(i % 3 != 0);
+    }
+    anchor->set_enabled(true);
+    
+    feeding = false;
+    feeder.join();
+    uint64_t before = anchor->ticks.load();
+    engine->process_market_data(winter::core::MarketData("AAPL", 100.0, 10));
+    while (anchor->ticks.load() == before) {
+        std::this_thread::yield();
+    }
+    engine->stop();
+    
+    // 200 toggles over 4 names leave every churn strategy removed
+    EXPECT_EQ(engine->strategy_count(), 1u);
+    EXPECT_EQ(engine->get_strategy("Anchor"), anchor);
+    // Once stopped, nothing but the anchor is kept alive by retired sets
+    EXPECT_EQ(alive.load(), 1);
+}
+
 // Test portfolio functionality
 TEST(PortfolioTest, BasicOperations) {
     winter::core::Portfolio portfolio;
@@ -152,6 +219,916 @@ TEST(OrderTest, Creation) {
     EXPECT_EQ(order.total_value(), 1500.0);
 }
 
+// Test shared signal sizing and fill rules
+TEST(ExecutionTest, SignalToOrderAndFill) {
+    winter::core::Portfolio portfolio;
+    portfolio.set_cash(10000.0);
+    
+    // BUY commits 10% of cash
+    winter::core::Signal buy("AAPL", winter::core::SignalType::BUY, 1.0, 100.0);
+    auto order = winter::core::order_from_signal(buy, portfolio);
+    ASSERT_TRUE(order.has_value());
+    EXPECT_EQ(order->side, winter::core::OrderSide::BUY);
+    EXPECT_EQ(order->quantity, 10);
+    
+    auto executed = winter::core::execute_order(*order, portfolio);
+    ASSERT_TRUE(executed.has_value());
+    EXPECT_EQ(portfolio.get_position("AAPL"), 10);
+    EXPECT_DOUBLE_EQ(portfolio.cash(), 9000.0);
+    
+    // SELL closes the whole position; oversized sells are reduced
+    winter::core::Order sell("AAPL", winter::core::OrderSide::SELL, 25, 110.0);
+    executed = winter::core::execute_order(sell, portfolio);
+    ASSERT_TRUE(executed.has_value());
+    EXPECT_EQ(executed->quantity, 10);
+    EXPECT_EQ(portfolio.get_position("AAPL"), 0);
+    EXPECT_DOUBLE_EQ(portfolio.cash(), 10100.0);
+    
+    // Nothing to sell and neutral signals produce no order
+    winter::core::Signal sell_signal("AAPL", winter::core::SignalType::SELL, 1.0, 110.0);
+    EXPECT_FALSE(winter::core::order_from_signal(sell_signal, portfolio).has_value());
+    winter::core::Signal neutral("AAPL", winter::core::SignalType::NEUTRAL, 0.0, 110.0);
+    EXPECT_FALSE(winter::core::order_from_signal(neutral, portfolio).has_value());
+}
+
+// Test strategy that counts ticks and keeps the count in its snapshot
+class CountingStrategy : public winter::strategy::StrategyBase {
+public:
+    uint64_t ticks = 0;
+    
+    CountingStrategy() : StrategyBase("CountingStrategy") {}
+    
+    std::vector<winter::core::Signal> process_tick(const winter::core::MarketData&) override {
+        ++ticks;
+        return {};
+    }
+    
+    void serialize(winter::utils::BinaryWriter& out) const override {
+        StrategyBase::serialize(out);
+        out.write(ticks);
+    }
+    
+    bool deserialize(winter::utils::BinaryReader& in) override {
+        if (!StrategyBase::deserialize(in)) return false;
+        ticks = in.read<uint64_t>();
+        return in.ok();
+    }
+};
+
+TEST(SnapshotTest, PortfolioRoundTrip) {
+    winter::core::Portfolio portfolio;
+    portfolio.set_cash(10000.0);
+    portfolio.add_position("AAPL", 10, 1000.0);
+    portfolio.reduce_cash(1000.0);
+    
+    winter::utils::BinaryWriter out;
+    portfolio.serialize(out);
+    
+    winter::core::Portfolio restored;
+    winter::utils::BinaryReader in(out.buffer());
+    ASSERT_TRUE(restored.deserialize(in));
+    EXPECT_TRUE(in.at_end());
+    EXPECT_DOUBLE_EQ(restored.cash(), 9000.0);
+    EXPECT_EQ(restored.get_position("AAPL"), 10);
+    ASSERT_EQ(restored.get_trades().size(), portfolio.get_trades().size());
+    EXPECT_EQ(restored.get_trades()[0].symbol, "AAPL");
+    EXPECT_EQ(restored.get_trades()[0].timestamp, portfolio.get_trades()[0].timestamp);
+    
+    // Truncated input is rejected rather than read past the end
+    winter::utils::BinaryReader truncated(out.data(), out.size() - 1);
+    EXPECT_FALSE(winter::core::Portfolio().deserialize(truncated));
+}
+
+TEST(SnapshotTest, RunningEngineCheckpointRoundTrip) {
+    auto strategy = std::make_shared<CountingStrategy>();
+    winter::core::Engine engine;
+    engine.add_strategy(strategy);
+    engine.portfolio().set_cash(5000.0);
+    engine.start();
+    
+    winter::core::MarketData data("AAPL", 150.0, 100);
+    for (int i = 0; i < 500; ++i) {
+        while (!engine.try_process_market_data(data)) {
+            std::this_thread::yield();
+        }
+    }
+    while (engine.ticks_processed() < 500) {
+        std::this_thread::yield();
+    }
+    
+    std::string path = (std::filesystem::temp_directory_path() / "winter_core_test.ckpt").string();
+    winter::core::Checkpointer checkpointer(engine, path, std::chrono::milliseconds(60000));
+    ASSERT_TRUE(checkpointer.checkpoint_now());
+    engine.stop();
+    
+    auto restored_strategy = std::make_shared<CountingStrategy>();
+    winter::core::Engine restored;
+    restored.add_strategy(restored_strategy);
+    ASSERT_TRUE(winter::core::Checkpointer::restore(restored, path));
+    EXPECT_EQ(restored.ticks_processed(), 500u);
+    EXPECT_EQ(restored_strategy->ticks, 500u);
+    EXPECT_DOUBLE_EQ(restored.portfolio().cash(), 5000.0);
+    
+    // A corrupted payload fails the checksum
+    FILE* file = std::fopen(path.c_str(), "r+b");
+    ASSERT_NE(file, nullptr);
+    std::fseek(file, 20, SEEK_SET);
+    std::fputc(0x7f, file);
+    std::fclose(file);
+    EXPECT_FALSE(winter::core::Checkpointer::restore(restored, path));
+    
+    std::filesystem::remove(path);
+}
+
+// Writes no state at all, so restoring it always fails
+class StatelessStrategy : public winter::strategy::StrategyBase {
+public:
+    StatelessStrategy() : StrategyBase("StatelessStrategy") {}
+    
+    std::vector<winter::core::Signal> process_tick(const winter::core::MarketData&) override { return {}; }
+    void serialize(winter::utils::BinaryWriter&) const override {}
+};
+
+TEST(SnapshotTest, FailedRestoreLeavesEngineUntouched) {
+    auto saved_strategy = std::make_shared<CountingStrategy>();
+    saved_strategy->ticks = 7;
+    winter::core::Engine saved;
+    saved.add_strategy(saved_strategy);
+    saved.add_strategy(std::make_shared<StatelessStrategy>());
+    saved.portfolio().set_cash(5000.0);
+    winter::utils::BinaryWriter snapshot;
+    saved.save_snapshot(snapshot);
+    
+    // The counting strategy restores fine before the stateless one fails
+    auto strategy = std::make_shared<CountingStrategy>();
+    strategy->ticks = 3;
+    winter::core::Engine engine;
+    engine.add_strategy(strategy);
+    engine.add_strategy(std::make_shared<StatelessStrategy>());
+    engine.portfolio().set_cash(100.0);
+    winter::utils::BinaryReader in(snapshot.buffer());
+    EXPECT_FALSE(engine.restore_snapshot(in));
+    EXPECT_EQ(strategy->ticks, 3u);
+    EXPECT_DOUBLE_EQ(engine.portfolio().cash(), 100.0);
+    EXPECT_EQ(engine.ticks_processed(), 0u);
+}
+
+// Test strategy that buys on every third tick and sells on every fifth
+class CyclingStrategy : public winter::strategy::StrategyBase {
+    int count_ = 0;
+    
+public:
+    CyclingStrategy() : StrategyBase("CyclingStrategy") {}
+    
+    std::vector<winter::core::Signal> process_tick(const winter::core::MarketData& data) override {
+        ++count_;
+        if (count_ % 5 == 0) {
+            return {winter::core::Signal(data.symbol, winter::core::SignalType::SELL, 1.0, data.price)};
+        }
+        if (count_ % 3 == 0) {
+            return {winter::core::Signal(data.symbol, winter::core::SignalType::BUY, 1.0, data.price)};
+        }
+        return {};
+    }
+};
+
+TEST(JournalTest, ReplayReproducesLiveFills) {
+    std::string path = (std::filesystem::temp_directory_path() / "winter_core_test.journal").string();
+    
+    // "Live" run: journal every tick and fill
+    std::vector<winter::core::Order> live_fills;
+    {
+        winter::core::JournalWriter journal(path, std::chrono::milliseconds(5));
+        ASSERT_TRUE(journal.is_open());
+        
+        winter::core::Engine engine;
+        winter::core::EngineConfiguration config;
+        config.sequential_fills = true;
+        engine.configure(config);
+        engine.add_strategy(std::make_shared<CyclingStrategy>());
+        engine.portfolio().set_cash(100000.0);
+        engine.set_order_callback([&](const winter::core::Order& order) {
+            live_fills.push_back(order);
+            journal.append_fill(order, 0);
+        });
+        engine.start();
+        
+        for (int i = 0; i < 300; ++i) {
+            winter::core::MarketData data(i % 2 ? "AAPL" : "MSFT", 100.0 + i * 0.5, 100);
+            data.timestamp = i;
+            data.seq = i + 1;
+            journal.append_tick(data, i * 1000);
+            while (!engine.try_process_market_data(data)) {
+                std::this_thread::yield();
+            }
+        }
+        while (engine.ticks_processed() < 300) {
+            std::this_thread::yield();
+        }
+        engine.pause();
+        engine.stop();
+    }
+    ASSERT_FALSE(live_fills.empty());
+    
+    // Replay from the journal
+    winter::core::JournalReader reader(path);
+    ASSERT_TRUE(reader.is_open());
+    
+    winter::core::Engine engine;
+    winter::core::EngineConfiguration config;
+    config.sequential_fills = true;
+    engine.configure(config);
+    engine.add_strategy(std::make_shared<CyclingStrategy>());
+    engine.portfolio().set_cash(100000.0);
+    std::vector<winter::core::Order> replay_fills;
+    engine.set_order_callback([&](const winter::core::Order& order) { replay_fills.push_back(order); });
+    engine.start();
+    
+    winter::core::JournalEvent event;
+    size_t ticks = 0;
+    std::vector<winter::core::Order> journaled_fills;
+    while (reader.next(event)) {
+        if (event.type == winter::core::JournalEventType::FILL) {
+            journaled_fills.push_back(event.fill);
+            continue;
+        }
+        EXPECT_EQ(event.arrival_ns, static_cast<int64_t>(ticks * 1000));
+        EXPECT_EQ(event.tick.seq, ticks + 1);
+        event.tick.timestamp = event.arrival_ns / 1000;
+        while (!engine.try_process_market_data(event.tick)) {
+            std::this_thread::yield();
+        }
+        ++ticks;
+    }
+    while (engine.ticks_processed() < ticks) {
+        std::this_thread::yield();
+    }
+    engine.pause();
+    engine.stop();
+    
+    EXPECT_EQ(ticks, 300u);
+    ASSERT_EQ(journaled_fills.size(), live_fills.size());
+    ASSERT_EQ(replay_fills.size(), live_fills.size());
+    for (size_t i = 0; i < live_fills.size(); ++i) {
+        EXPECT_GT(live_fills[i].tick_seq, 0u);
+        EXPECT_EQ(journaled_fills[i].tick_seq, live_fills[i].tick_seq);
+        EXPECT_EQ(replay_fills[i].tick_seq, live_fills[i].tick_seq);
+        EXPECT_EQ(replay_fills[i].symbol, live_fills[i].symbol);
+        EXPECT_EQ(replay_fills[i].side, live_fills[i].side);
+        EXPECT_EQ(replay_fills[i].quantity, live_fills[i].quantity);
+        EXPECT_DOUBLE_EQ(replay_fills[i].price, live_fills[i].price);
+    }
+    
+    // A torn final record is dropped, not misread
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 3);
+    winter::core::JournalReader torn(path);
+    size_t events = 0;
+    while (torn.next(event)) {
+        ++events;
+    }
+    EXPECT_EQ(events, ticks + journaled_fills.size() - 1);
+    
+    std::filesystem::remove(path);
+}
+
+// Test strategy that records the strategy clock for every tick
+class ClockRecordingStrategy : public winter::strategy::StrategyBase {
+public:
+    std::vector<int64_t> seen_us;
+    
+    ClockRecordingStrategy() : StrategyBase("ClockRecordingStrategy") {}
+    
+    std::vector<winter::core::Signal> process_tick(const winter::core::MarketData& data) override {
+        seen_us.push_back(clock().now_us());
+        if (seen_us.size() == 1) {
+            return {winter::core::Signal(data.symbol, winter::core::SignalType::BUY, 1.0, data.price)};
+        }
+        return {};
+    }
+};
+
+TEST(ClockTest, EngineRunsOnEventTime) {
+    auto strategy = std::make_shared<ClockRecordingStrategy>();
+    winter::core::Engine engine;
+    winter::core::EngineConfiguration config;
+    config.sequential_fills = true;
+    engine.configure(config);
+    engine.add_strategy(strategy);
+    engine.set_clock(std::make_shared<winter::core::SimulatedClock>());
+    engine.portfolio().set_cash(10000.0);
+    engine.start();
+    
+    // 1970-01-01 00:00:05 onwards, one tick per second of event time
+    const int64_t base_us = 5000000;
+    for (int i = 0; i < 50; ++i) {
+        winter::core::MarketData data("AAPL", 100.0, 10);
+        data.timestamp = base_us + i * 1000000LL;
+        while (!engine.try_process_market_data(data)) {
+            std::this_thread::yield();
+        }
+    }
+    while (engine.ticks_processed() < 50) {
+        std::this_thread::yield();
+    }
+    engine.pause();
+    engine.stop();
+    
+    ASSERT_EQ(strategy->seen_us.size(), 50u);
+    for (size_t i = 0; i < strategy->seen_us.size(); ++i) {
+        EXPECT_EQ(strategy->seen_us[i], base_us + static_cast<int64_t>(i) * 1000000LL);
+    }
+    
+    // The fill for the first tick is stamped with event time, not wall time
+    ASSERT_EQ(engine.portfolio().get_trades().size(), 1u);
+    EXPECT_EQ(engine.portfolio().get_trades()[0].timestamp, winter::core::format_time_of_day(base_us * 1000));
+}
+
+TEST(OverflowQueueTest, PoliciesAndCounters) {
+    using Queue = winter::core::OverflowQueue<winter::core::MarketData>;
+    using winter::core::OverflowPolicy;
+    std::atomic<bool> active{true};
+    winter::core::MarketData tick;
+    
+    // Drop-oldest keeps the newest ticks
+    Queue drop;
+    drop.reset(4, false);
+    drop.set_policy(OverflowPolicy::DROP_OLDEST);
+    for (int i = 0; i < 6; ++i) {
+        drop.push(winter::core::MarketData("AAPL", i, 1), active);
+    }
+    EXPECT_EQ(drop.stats().dropped_oldest, 2u);
+    ASSERT_TRUE(drop.pop(tick));
+    EXPECT_EQ(tick.price, 2.0);
+    
+    // Conflation keeps the latest pending tick per symbol, after everything queued
+    Queue conflate;
+    conflate.reset(2, false);
+    conflate.set_policy(OverflowPolicy::CONFLATE);
+    conflate.push(winter::core::MarketData("AAPL", 1.0, 1), active);
+    conflate.push(winter::core::MarketData("MSFT", 2.0, 1), active);
+    EXPECT_EQ(conflate.push(winter::core::MarketData("AAPL", 3.0, 1), active), Queue::Outcome::CONFLATED);
+    conflate.push(winter::core::MarketData("MSFT", 4.0, 1), active);
+    conflate.push(winter::core::MarketData("AAPL", 5.0, 1), active);
+    EXPECT_EQ(conflate.stats().conflated, 1u);
+    std::vector<double> prices;
+    while (conflate.pop(tick)) {
+        prices.push_back(tick.price);
+    }
+    EXPECT_EQ(prices, (std::vector<double>{1.0, 2.0, 5.0, 4.0}));
+    EXPECT_TRUE(conflate.empty());
+    
+    // Reject refuses new ticks; block gives up once the consumer is gone
+    Queue reject;
+    reject.reset(2, false);
+    reject.set_policy(OverflowPolicy::REJECT);
+    for (int i = 0; i < 3; ++i) {
+        reject.push(tick, active);
+    }
+    EXPECT_EQ(reject.stats().rejected, 1u);
+    
+    Queue block;
+    block.reset(2, false);
+    block.set_policy(OverflowPolicy::BLOCK);
+    block.push(tick, active);
+    block.push(tick, active);
+    active = false;
+    EXPECT_EQ(block.push(tick, active), Queue::Outcome::REJECTED);
+    EXPECT_EQ(block.stats().blocked, 1u);
+    
+    EXPECT_EQ(winter::core::Engine::default_overflow_policy(winter::core::EngineConfiguration::ExecutionMode::BACKTEST),
+              OverflowPolicy::BLOCK);
+    EXPECT_EQ(winter::core::Engine::default_overflow_policy(winter::core::EngineConfiguration::ExecutionMode::PAPER_TRADING),
+              OverflowPolicy::REJECT);
+    
+    // Orders are rejected, never evicted, outside backtests
+    EXPECT_EQ(winter::core::Engine::default_order_overflow_policy(winter::core::EngineConfiguration::ExecutionMode::LIVE_TRADING),
+              OverflowPolicy::REJECT);
+    winter::core::Engine engine;
+    winter::core::EngineConfiguration config;
+    config.execution_mode = winter::core::EngineConfiguration::ExecutionMode::LIVE_TRADING;
+    config.market_data_queue_size = 16;
+    config.order_queue_size = 16;
+    config.order_overflow = OverflowPolicy::DROP_OLDEST;
+    engine.configure(config);
+    EXPECT_EQ(engine.order_overflow_policy(), OverflowPolicy::REJECT);
+}
+
+// Test strategy that records where each tick it sees lives in memory
+class AddressRecordingStrategy : public winter::strategy::StrategyBase {
+public:
+    std::vector<const winter::core::MarketData*> seen;
+    
+    AddressRecordingStrategy() : StrategyBase("AddressRecordingStrategy") {}
+    
+    std::vector<winter::core::Signal> process_tick(const winter::core::MarketData& data) override {
+        seen.push_back(&data);
+        return {};
+    }
+};
+
+TEST_F(EngineTest, QueuesFollowConfiguredSizes) {
+    winter::core::EngineConfiguration config;
+    config.market_data_queue_size = 3000;
+    config.order_queue_size = 100;
+    engine->configure(config);
+    
+    // Rounded up to a power of two, not capped at a compile-time size
+    EXPECT_EQ(engine->market_data_queue_capacity(), 4096u);
+    EXPECT_EQ(engine->order_queue_capacity(), 128u);
+    
+    // A backtest burst larger than the queue is applied in full
+    auto strategy = std::make_shared<AddressRecordingStrategy>();
+    engine->add_strategy(strategy);
+    engine->start();
+    for (int i = 0; i < 20000; ++i) {
+        engine->process_market_data(winter::core::MarketData("AAPL", 100.0, 10));
+    }
+    while (engine->ticks_processed() < 20000) {
+        std::this_thread::yield();
+    }
+    engine->stop();
+    EXPECT_EQ(strategy->seen.size(), 20000u);
+}
+
+TEST(SpscRingTest, WrapsAndReportsCapacity) {
+    winter::utils::SpscRing<int> ring(5);
+    EXPECT_EQ(ring.capacity(), 8u);
+    EXPECT_EQ(ring.requested_capacity(), 5u);
+    
+    // Every slot is usable and order survives many wrap-arounds
+    int next_in = 0;
+    int next_out = 0;
+    for (int round = 0; round < 100; ++round) {
+        while (ring.push(next_in)) {
+            ++next_in;
+        }
+        EXPECT_EQ(ring.size(), 8u);
+        int value;
+        for (int i = 0; i < 3 && ring.pop(value); ++i) {
+            EXPECT_EQ(value, next_out++);
+        }
+    }
+}
+
+TEST(RollingWindowTest, KeepsNewestValuesAndRoundTrips) {
+    winter::utils::RollingWindow<double> window(4);
+    for (int i = 1; i <= 10; ++i) {
+        window.push_back(i);
+    }
+    ASSERT_TRUE(window.full());
+    EXPECT_EQ(window.front(), 7.0);
+    EXPECT_EQ(window.back(), 10.0);
+    EXPECT_EQ(window[1], 8.0);
+    EXPECT_EQ(std::accumulate(window.end() - 2, window.end(), 0.0), 19.0);
+    
+    winter::utils::BinaryWriter out;
+    out.write_window(window);
+    winter::utils::BinaryReader in(out.buffer());
+    winter::utils::RollingWindow<double> restored(4);
+    in.read_window(restored);
+    ASSERT_TRUE(in.ok());
+    EXPECT_TRUE(std::equal(window.begin(), window.end(), restored.begin(), restored.end()));
+}
+
+TEST(EngineViewTest, BatchesAreReadInPlaceAndInOrder) {
+    auto strategy = std::make_shared<AddressRecordingStrategy>();
+    winter::core::Engine engine;
+    engine.add_strategy(strategy);
+    
+    std::vector<winter::core::MarketData> store;
+    for (int i = 0; i < 5000; ++i) {
+        store.emplace_back("AAPL", 100.0 + i, 10);
+    }
+    
+    engine.start();
+    const size_t batch = 256;
+    for (size_t begin = 0; begin < store.size(); begin += batch) {
+        std::span<const winter::core::MarketData> view(store.data() + begin, std::min(batch, store.size() - begin));
+        while (!engine.try_process_market_data_view(view)) {
+            std::this_thread::yield();
+        }
+    }
+    while (engine.ticks_processed() < store.size()) {
+        std::this_thread::yield();
+    }
+    engine.stop();
+    
+    // Every tick was seen at its address in the store, in store order
+    ASSERT_EQ(strategy->seen.size(), store.size());
+    for (size_t i = 0; i < store.size(); ++i) {
+        EXPECT_EQ(strategy->seen[i], &store[i]);
+    }
+}
+
+TEST(TscClockTest, TracksSteadyClock) {
+    auto& tsc = winter::utils::TscClock::instance();
+    
+    auto steady_start = std::chrono::steady_clock::now();
+    uint64_t start = winter::utils::tsc_now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    uint64_t end = winter::utils::tsc_now();
+    double steady_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - steady_start).count();
+    
+    // Calibrated interval within 5% of the OS clock (the sleep itself dominates)
+    double tsc_ns = tsc.elapsed_ns(start, end);
+    EXPECT_GT(tsc_ns, 45e6);
+    EXPECT_NEAR(tsc_ns, steady_ns, steady_ns * 0.05);
+    
+    // Conversions never run backwards across a recalibration
+    int64_t previous = tsc.now_ns();
+    tsc.recalibrate();
+    for (int i = 0; i < 10000; ++i) {
+        int64_t now = tsc.now_ns();
+        EXPECT_GE(now, previous);
+        previous = now;
+    }
+    
+    // Epoch time agrees with the system clock to within a millisecond
+    int64_t system_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    EXPECT_NEAR(static_cast<double>(tsc.now_epoch_ns()), static_cast<double>(system_ns), 1e6);
+}
+
+TEST(ThreadPoolTest, ParallelForAndReduceCoverTheRange) {
+    winter::utils::ThreadPool pool(4);
+    ASSERT_EQ(pool.size(), 4u);
+    
+    // Every index is visited exactly once, whatever the grain
+    std::vector<std::atomic<int>> visits(10007);
+    pool.parallel_for(0, visits.size(), 37, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            visits[i]++;
+        }
+    });
+    EXPECT_TRUE(std::all_of(visits.begin(), visits.end(), [](const auto& v) { return v.load() == 1; }));
+    
+    // Partials are folded in chunk order, so a non-commutative combine is stable
+    std::string digits = pool.parallel_reduce(0, 20, 3, std::string(),
+        [](size_t begin, size_t end) {
+            std::string s;
+            for (size_t i = begin; i < end; ++i) s += static_cast<char>('a' + i);
+            return s;
+        },
+        [](std::string a, std::string b) { return a + b; });
+    EXPECT_EQ(digits, "abcdefghijklmnopqrst");
+    
+    auto future = pool.submit([]() { return 42; });
+    EXPECT_EQ(future.get(), 42);
+    
+    EXPECT_THROW(pool.parallel_for(0, 100, 10, [](size_t begin, size_t) {
+        if (begin == 50) throw std::runtime_error("chunk failed");
+    }), std::runtime_error);
+}
+
+TEST(ThreadPoolTest, NestedWorkIsStolenWithoutDeadlock) {
+    winter::utils::ThreadPool pool(2);
+    std::mutex ids_mutex;
+    std::set<std::thread::id> ids;
+    std::atomic<int> leaves{0};
+    
+    // One task fans out from a worker's own deque; the idle worker has to
+    // steal, and the waiting worker keeps running tasks rather than blocking
+    pool.submit([&]() {
+        pool.parallel_for(0, 16, 1, [&](size_t, size_t) {
+            pool.parallel_for(0, 4, 1, [&](size_t, size_t) { leaves++; });
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            std::lock_guard<std::mutex> lock(ids_mutex);
+            ids.insert(std::this_thread::get_id());
+        });
+    }).get();
+    EXPECT_EQ(leaves.load(), 64);
+    EXPECT_EQ(ids.size(), 2u);
+}
+
+TEST(AsyncTest, PipelineStagesAwaitFdsQueuesAndClockTimers) {
+    auto clock = std::make_shared<winter::core::SimulatedClock>(0);
+    winter::core::Executor producer("producer");
+    winter::core::Executor consumer("consumer", -1, clock);
+    winter::core::AsyncQueue<int> queue(16);
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+    
+    // Waits for a byte on the pipe, then forwards one value per byte read
+    auto produce = [&]() -> winter::core::Task<void> {
+        int sent = 0;
+        while (sent < 10) {
+            co_await producer.readable(fds[0]);
+            char buffer[16];
+            ssize_t n = ::read(fds[0], buffer, sizeof(buffer));
+            for (ssize_t i = 0; i < n; ++i) {
+                while (!queue.try_push(++sent)) {
+                    co_await producer.sleep_for(std::chrono::microseconds(50));
+                }
+            }
+        }
+        queue.close();
+    };
+    
+    std::atomic<int> sum{0};
+    std::atomic<bool> timer_fired{false};
+    auto consume = [&]() -> winter::core::Task<void> {
+        while (auto value = co_await queue.pop()) {
+            sum += *value;
+        }
+        // Event-clock timer: fires only once the clock is moved past it
+        co_await consumer.sleep_until(1000);
+        timer_fired = true;
+        consumer.stop();
+    };
+    
+    producer.spawn(produce());
+    consumer.spawn(consume());
+    ASSERT_TRUE(producer.start());
+    ASSERT_TRUE(consumer.start());
+    
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_EQ(::write(fds[1], "x", 1), 1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (sum.load() < 55 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(sum.load(), 55);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(timer_fired.load());
+    
+    clock->set(1000);
+    consumer.join();
+    EXPECT_TRUE(timer_fired.load());
+    
+    producer.stop();
+    producer.join();
+    ::close(fds[0]);
+    ::close(fds[1]);
+}
+
+TEST(PlacementTest, CriticalThreadsGetIsolatedPhysicalCores) {
+    // Fake sysfs: 6 physical cores with SMT siblings (cpu i and i + 6), two
+    // NUMA nodes, cores 3-5 isolated and tickless
+    namespace fs = std::filesystem;
+    fs::path root = fs::temp_directory_path() / "winter_placement_sysfs";
+    fs::remove_all(root);
+    auto write = [](const fs::path& path, const std::string& text) {
+        fs::create_directories(path.parent_path());
+        std::ofstream(path) << text << "\n";
+    };
+    write(root / "cpu/online", "0-11");
+    write(root / "cpu/isolated", "3-5,9-11");
+    write(root / "cpu/nohz_full", "3-5,9-11");
+    write(root / "node/node0/cpulist", "0-2,6-8");
+    write(root / "node/node1/cpulist", "3-5,9-11");
+    for (int cpu = 0; cpu < 12; ++cpu) {
+        fs::path topology = root / ("cpu/cpu" + std::to_string(cpu)) / "topology";
+        write(topology / "core_id", std::to_string(cpu % 6));
+        write(topology / "physical_package_id", "0");
+    }
+    
+    auto topology = winter::utils::CpuTopology::detect(root.string());
+    ASSERT_EQ(topology.cpus().size(), 12u);
+    ASSERT_EQ(topology.cores().size(), 6u);
+    EXPECT_EQ(topology.node_count(), 2u);
+    
+    auto plan = winter::utils::PlacementPlanner(topology).plan();
+    EXPECT_EQ(plan.feed, 3);
+    EXPECT_EQ(plan.strategy, 4);
+    EXPECT_EQ(plan.execution, 5);
+    EXPECT_EQ(plan.logger, 0);
+    EXPECT_EQ(plan.pool, (std::vector<int>{1, 2}));
+    
+    // No thread lands on a sibling of a critical core
+    std::vector<int> assigned = plan.pool;
+    assigned.insert(assigned.end(), {plan.feed, plan.strategy, plan.execution, plan.logger});
+    for (int sibling : {9, 10, 11}) {
+        EXPECT_EQ(std::count(assigned.begin(), assigned.end(), sibling), 0);
+    }
+    EXPECT_NE(plan.describe(topology).find("siblings 9 unused by the plan"), std::string::npos);
+    
+    // A single-core machine still gets a usable (shared) plan
+    auto tiny = winter::utils::PlacementPlanner(winter::utils::CpuTopology({winter::utils::CpuInfo{}})).plan(2);
+    EXPECT_EQ(tiny.feed, 0);
+    EXPECT_EQ(tiny.execution, 0);
+    EXPECT_EQ(tiny.pool, (std::vector<int>{0, 0}));
+    EXPECT_FALSE(tiny.notes.empty());
+    
+    fs::remove_all(root);
+}
+
+TEST(RealtimeTest, SkippedStepsAreReportedAndTheEngineStillRuns) {
+    winter::core::Engine engine;
+    winter::core::EngineConfiguration config;
+    config.market_data_queue_size = 1024;
+    config.order_queue_size = 1024;
+    config.batch_size = 64;
+    config.realtime = true;
+    // Ticks count as processed once their fills landed, so stop() loses none
+    config.sequential_fills = true;
+    engine.configure(config);
+    engine.add_strategy(std::make_shared<TestBuyStrategy>());
+    engine.portfolio().set_cash(1000000.0);
+    
+    EXPECT_FALSE(engine.realtime_status().requested);
+    
+    // Both threads on one core: neither may be raised to SCHED_FIFO
+    engine.start(0, 0);
+    auto status = engine.realtime_status();
+    EXPECT_TRUE(status.requested);
+    EXPECT_FALSE(status.strategy_fifo);
+    EXPECT_FALSE(status.execution_fifo);
+    EXPECT_FALSE(status.fully_applied());
+    // One reason per thread, plus one when mlockall was refused
+    EXPECT_EQ(status.problems.size(), status.memory_locked ? 2u : 3u);
+    
+    for (int i = 0; i < 100; ++i) {
+        engine.process_market_data(winter::core::MarketData("AAPL", 100.0 + i, 10));
+    }
+    while (engine.ticks_processed() < 100) {
+        std::this_thread::yield();
+    }
+    engine.stop();
+    EXPECT_GT(engine.portfolio().get_position("AAPL"), 0);
+}
+
+struct ThresholdParams {
+    double threshold = 1.0;
+    int window = 5;
+
+    static const winter::utils::ConfigSchema<ThresholdParams>& schema() {
+        static const auto schema = winter::utils::ConfigSchema<ThresholdParams>()
+            .field("threshold", &ThresholdParams::threshold, 0.0, 10.0)
+            .field("window", &ThresholdParams::window, 1, 100);
+        return schema;
+    }
+};
+
+// Records the threshold the strategy thread last traded on
+class ThresholdStrategy : public winter::strategy::StrategyBase {
+public:
+    winter::utils::ConfigSnapshot<ThresholdParams> params;
+    std::atomic<double> seen_threshold{0.0};
+
+    ThresholdStrategy() : StrategyBase("Threshold") {}
+
+    bool configure(const std::unordered_map<std::string, std::string>& config) override {
+        return configure_params(params, config);
+    }
+    bool validate_config(const std::unordered_map<std::string, std::string>& config,
+                         std::vector<std::string>& errors) const override {
+        return validate_params<ThresholdParams>(config, errors);
+    }
+    std::vector<winter::core::Signal> process_tick(const winter::core::MarketData&) override {
+        seen_threshold = params->threshold;
+        return {};
+    }
+};
+
+TEST(ConfigReloadTest, EditsApplyWhileRunningAndBadFilesAreRejected) {
+    namespace fs = std::filesystem;
+    const fs::path dir = fs::temp_directory_path() / ("winter_reload_" + std::to_string(::getpid()));
+    fs::create_directories(dir);
+    const std::string path = (dir / "winter_config.yaml").string();
+    // Saved the way editors do: a new file renamed over the old one
+    auto save = [&](const std::string& parameters) {
+        std::ofstream(path + ".tmp") << "enabled_strategies:\n  - Threshold\nstrategy_parameters:\n  Threshold:\n"
+                                     << parameters;
+        fs::rename(path + ".tmp", path);
+    };
+
+    save("    threshold: 1.5\n");
+    winter::utils::WinterConfig initial;
+    std::string error;
+    ASSERT_TRUE(winter::utils::WinterConfig::load(path, initial, error)) << error;
+    auto strategy = std::make_shared<ThresholdStrategy>();
+    ASSERT_TRUE(strategy->configure(initial.parameters_for("Threshold")));
+
+    winter::core::Engine engine;
+    engine.add_strategy(strategy);
+    winter::core::ConfigReloader reloader(engine, path, initial);
+
+    // Saves are picked up the way simulate does it: watch() on an executor
+    winter::core::Executor executor("reload");
+    executor.spawn(reloader.watch(executor));
+    ASSERT_TRUE(executor.start());
+    auto wait_for = [](const auto& done) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!done() && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return done();
+    };
+
+    engine.start();
+    auto run_until_seen = [&](double threshold) {
+        for (int i = 0; i < 100000 && strategy->seen_threshold != threshold; ++i) {
+            engine.process_market_data(winter::core::MarketData("AAPL", 100.0, 10));
+            std::this_thread::yield();
+        }
+        return strategy->seen_threshold.load();
+    };
+    EXPECT_DOUBLE_EQ(run_until_seen(1.5), 1.5);
+
+    save("    threshold: 2.5\n    window: 8\n");
+    ASSERT_TRUE(wait_for([&]() { return reloader.reloads() == 1; }));
+    EXPECT_DOUBLE_EQ(run_until_seen(2.5), 2.5);
+    EXPECT_EQ(strategy->params->window, 8);
+
+    // Out of range, an unknown key and broken YAML all keep the running values
+    const char* rejected[] = {"    threshold: 50\n", "    threshold: 2.0\n    windw: 3\n", "    threshold: [2.0\n"};
+    for (uint64_t i = 0; i < 3; ++i) {
+        save(rejected[i]);
+        ASSERT_TRUE(wait_for([&]() { return reloader.rejected() == i + 1; })) << rejected[i];
+    }
+    EXPECT_EQ(reloader.reloads(), 1u);
+    EXPECT_DOUBLE_EQ(strategy->params->threshold, 2.5);
+    executor.stop();
+    executor.join();
+    EXPECT_EQ(reloader.current().parameters_for("Threshold").at("window"), "8");
+    engine.stop();
+
+    // Stopped: applied before reload() returns; dropped keys fall back to defaults
+    save("    threshold: 0.5\n");
+    EXPECT_TRUE(reloader.reload());
+    EXPECT_DOUBLE_EQ(strategy->params->threshold, 0.5);
+    EXPECT_EQ(strategy->params->window, 5);
+    EXPECT_EQ(reloader.reloads(), 2u);
+
+    fs::remove_all(dir);
+}
+
+TEST(ConfigReloadTest, UpdateQueuedBeforeASwapReachesTheReplacement) {
+    winter::core::Engine engine;
+    auto original = std::make_shared<ThresholdStrategy>();
+    engine.add_strategy(original);
+    engine.start();
+    
+    // Queued while the strategy thread is parked, so it has not applied it yet
+    engine.pause();
+    std::vector<std::string> errors;
+    ASSERT_TRUE(engine.reconfigure_strategies({{"Threshold", {{"threshold", "3.0"}}}}, errors));
+    EXPECT_DOUBLE_EQ(original->params->threshold, 1.0);
+    
+    auto replacement = std::make_shared<ThresholdStrategy>();
+    ASSERT_TRUE(engine.replace_strategy("Threshold", replacement, false));
+    engine.resume();
+    EXPECT_DOUBLE_EQ(replacement->params->threshold, 3.0);
+    EXPECT_EQ(replacement->config().at("threshold"), "3.0");
+    
+    for (int i = 0; i < 100000 && replacement->seen_threshold != 3.0; ++i) {
+        engine.process_market_data(winter::core::MarketData("AAPL", 100.0, 10));
+        std::this_thread::yield();
+    }
+    EXPECT_DOUBLE_EQ(replacement->seen_threshold.load(), 3.0);
+    engine.stop();
+}
+
+#if defined(WINTER_TEST_PLUGIN_V1) && defined(WINTER_TEST_PLUGIN_V2)
+// Tick count the counting plugin carries in its state
+uint64_t plugin_ticks(winter::core::Engine& engine) {
+    auto strategy = engine.get_strategy("CountingStrategy");
+    if (!strategy) {
+        return 0;
+    }
+    winter::utils::BinaryWriter state;
+    strategy->serialize(state);
+    winter::utils::BinaryReader reader(state.buffer());
+    reader.read<uint8_t>();
+    return reader.read<uint64_t>();
+}
+
+TEST(PluginTest, SwapHandsStateToTheNewBuildWhileRunning) {
+    winter::core::Engine engine;
+    EXPECT_EQ(engine.load_strategy_plugin("/nonexistent/strategy.so"), nullptr);
+    
+    auto loaded = engine.load_strategy_plugin(WINTER_TEST_PLUGIN_V1);
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_EQ(loaded->name(), "CountingStrategy");
+    loaded.reset();
+    
+    auto feed = [&engine](int count) {
+        uint64_t target = engine.ticks_processed() + count;
+        for (int i = 0; i < count; ++i) {
+            engine.process_market_data(winter::core::MarketData("AAPL", 100.0, 10));
+        }
+        while (engine.ticks_processed() < target) {
+            std::this_thread::yield();
+        }
+    };
+    
+    engine.start();
+    feed(100);
+    // Version 2 counts every tick twice; its count starts from version 1's
+    ASSERT_TRUE(engine.swap_strategy_plugin("CountingStrategy", WINTER_TEST_PLUGIN_V2));
+    feed(50);
+    EXPECT_EQ(plugin_ticks(engine), 200u);
+    
+    EXPECT_FALSE(engine.swap_strategy_plugin("Missing", WINTER_TEST_PLUGIN_V2));
+    EXPECT_TRUE(engine.unload_strategy_plugin("CountingStrategy"));
+    EXPECT_EQ(engine.get_strategy("CountingStrategy"), nullptr);
+    feed(10);
+    engine.stop();
+}
+#endif
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,42 @@
+#include <winter/strategy/strategy_plugin.hpp>
+
+// Test plugin built twice: TICK_WEIGHT tells the builds apart, and the tick
+// count is the state that has to survive a swap
+#ifndef TICK_WEIGHT
+#define TICK_WEIGHT 1
+#endif
+#ifndef PLUGIN_VERSION
+#define PLUGIN_VERSION "1"
+#endif
+
+namespace {
+
+class CountingStrategy : public winter::strategy::StrategyBase {
+public:
+    explicit CountingStrategy(std::string name) : StrategyBase(std::move(name)) {}
+
+    std::vector<winter::core::Signal> process_tick(const winter::core::MarketData&) override {
+        ticks_ += TICK_WEIGHT;
+        return {};
+    }
+
+    void serialize(winter::utils::BinaryWriter& out) const override {
+        StrategyBase::serialize(out);
+        out.write<uint64_t>(ticks_);
+    }
+
+    bool deserialize(winter::utils::BinaryReader& in) override {
+        if (!StrategyBase::deserialize(in)) {
+            return false;
+        }
+        ticks_ = in.read<uint64_t>();
+        return in.ok();
+    }
+
+private:
+    uint64_t ticks_ = 0;
+};
+
+} // namespace
+
+WINTER_STRATEGY_PLUGIN(CountingStrategy, "CountingStrategy", PLUGIN_VERSION, 1)
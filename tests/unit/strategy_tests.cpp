@@ -1,8 +1,11 @@
 #include <gtest/gtest.h>
 #include <winter/strategy/strategy_base.hpp>
 #include <winter/strategy/strategy_registry.hpp>
+#include <winter/strategy/strategy_factory.hpp>
+#include <winter/utils/config_parser.hpp>
 #include <winter/core/market_data.hpp>
 #include <winter/core/signal.hpp>
+#include "examples/strategy_ma_strategy/simple_ma_strategy.hpp"
 
 #include <vector>
 #include <memory>
@@ -42,6 +45,35 @@ public:
     }
 };
 
+// Parameters for a strategy configured through the typed schema
+struct BandParams {
+    double width = 2.0;
+    int lookback = 20;
+    bool shorting = false;
+
+    static const winter::utils::ConfigSchema<BandParams>& schema() {
+        static const auto schema = winter::utils::ConfigSchema<BandParams>()
+            .field("width", &BandParams::width, 0.1, 10.0)
+            .field("lookback", &BandParams::lookback, 2, 500)
+            .field("shorting", &BandParams::shorting)
+            .check("lookback covers the band", [](const BandParams& p) { return p.lookback > p.width; });
+        return schema;
+    }
+};
+
+class BandStrategy : public winter::strategy::StrategyBase {
+public:
+    winter::utils::ConfigSnapshot<BandParams> params;
+
+    explicit BandStrategy(const std::string& name = "Band") : StrategyBase(name) {}
+
+    bool configure(const std::unordered_map<std::string, std::string>& config) override {
+        return configure_params(params, config);
+    }
+
+    std::vector<winter::core::Signal> process_tick(const winter::core::MarketData&) override { return {}; }
+};
+
 // Test fixture for Strategy tests
 class StrategyTest : public ::testing::Test {
 protected:
@@ -140,6 +172,120 @@ TEST_F(StrategyTest, CreateAndRegister) {
     EXPECT_EQ(strategies.size(), 1);
 }
 
+// Parameters are parsed once; bad values are rejected and the last good set stays
+TEST(TypedConfigTest, SchemaValidatesAndSnapshotsPublish) {
+    BandStrategy strategy;
+    EXPECT_DOUBLE_EQ(strategy.params->width, 2.0);
+    EXPECT_EQ(strategy.params->lookback, 20);
+
+    EXPECT_TRUE(strategy.configure({{"width", "1.5"}, {"lookback", " 30 "}, {"shorting", "yes"}}));
+    const BandParams& first = strategy.params.get();
+    EXPECT_DOUBLE_EQ(first.width, 1.5);
+    EXPECT_EQ(first.lookback, 30);
+    EXPECT_TRUE(first.shorting);
+    EXPECT_EQ(strategy.get_config("lookback"), " 30 ");
+    uint64_t version = strategy.params.version();
+
+    EXPECT_FALSE(strategy.configure({{"width", "50"}}));         // Out of range
+    EXPECT_FALSE(strategy.configure({{"lookback", "20x"}}));     // Trailing garbage
+    EXPECT_FALSE(strategy.configure({{"widht", "1.0"}}));        // Unknown key
+    EXPECT_FALSE(strategy.configure({{"width", "9"}, {"lookback", "5"}}));  // Broken rule
+    EXPECT_EQ(strategy.params.version(), version);
+    EXPECT_EQ(&strategy.params.get(), &first);
+    EXPECT_EQ(strategy.get_config("lookback"), " 30 ");
+    auto held = strategy.params.snapshot();
+    EXPECT_EQ(held.get(), &first);
+
+    // Unset fields fall back to defaults, not to the previous snapshot
+    EXPECT_TRUE(strategy.configure({{"lookback", "40"}}));
+    EXPECT_DOUBLE_EQ(strategy.params->width, 2.0);
+    EXPECT_FALSE(strategy.params->shorting);
+    EXPECT_TRUE(strategy.configure({{"lookback", "50"}}));
+    EXPECT_DOUBLE_EQ(held->width, 1.5);  // A held snapshot outlives later publishes
+    EXPECT_EQ(held->lookback, 30);
+
+    std::vector<std::string> errors;
+    BandParams parsed;
+    EXPECT_FALSE(BandParams::schema().parse({{"width", "abc"}, {"extra", "1"}}, parsed, errors));
+    EXPECT_EQ(errors.size(), 2u);
+    auto fields = BandParams::schema().describe(strategy.params.get());
+    ASSERT_EQ(fields.size(), 3u);
+    EXPECT_EQ(fields[1], std::make_pair(std::string("lookback"), std::string("50")));
+}
+
+// Periods are validated up front and follow configure(), so reloads reach them
+TEST(TypedConfigTest, SimpleMAPeriodsAreReconfigurable) {
+    winter::examples::SimpleMAStrategy strategy;
+    EXPECT_EQ(strategy.params().fast_period, 10);
+    EXPECT_EQ(strategy.params().slow_period, 30);
+
+    std::vector<std::string> errors;
+    EXPECT_FALSE(strategy.validate_config({{"fast_period", "40"}}, errors));  // Not below slow_period
+    EXPECT_FALSE(strategy.validate_config({{"fast_period", "ten"}}, errors));
+    EXPECT_FALSE(strategy.validate_config({{"slow_period", "5000"}}, errors));
+    EXPECT_TRUE(strategy.validate_config({{"fast_period", "5"}, {"slow_period", "12"}}, errors));
+
+    EXPECT_TRUE(strategy.configure({{"fast_period", "5"}, {"slow_period", "12"}}));
+    EXPECT_EQ(strategy.params().fast_period, 5);
+    EXPECT_EQ(strategy.params().slow_period, 12);
+}
+
+// The YAML subset winter_config.yaml is written in, applied through the factory
+TEST(ConfigParserTest, LoadsStrategiesAndParameters) {
+    const char* text = R"(---
+# Strategies to run
+enabled_strategies:
+  # - Disabled
+  - Band
+strategy_parameters:
+  Band:
+    width: 1.5   # tighter
+    shorting: "yes"
+  Other: {}
+)";
+    winter::utils::ConfigNode root;
+    std::string error;
+    EXPECT_FALSE(winter::utils::ConfigParser::parse(text, root, error));
+    EXPECT_EQ(error, "line 10: unsupported YAML construct '{'");
+
+    const char* valid = R"(enabled_strategies:
+- Band
+strategy_parameters:
+  Band:
+    width: 1.5   # tighter
+    shorting: "yes"
+  Other:
+tags: [a, 'b c']
+)";
+    ASSERT_TRUE(winter::utils::ConfigParser::parse(valid, root, error)) << error;
+    ASSERT_NE(root.find("tags"), nullptr);
+    ASSERT_EQ(root.find("tags")->items().size(), 2u);
+    EXPECT_EQ(root.find("tags")->items()[1].scalar(), "b c");
+
+    winter::utils::WinterConfig config;
+    ASSERT_TRUE(winter::utils::WinterConfig::from_node(root, config, error)) << error;
+    ASSERT_EQ(config.enabled_strategies, std::vector<std::string>{"Band"});
+    EXPECT_EQ(config.parameters_for("Band").at("width"), "1.5");
+    EXPECT_TRUE(config.parameters_for("Other").empty());
+
+    winter::strategy::StrategyFactory::register_type<BandStrategy>("Band");
+    auto strategies = winter::strategy::StrategyFactory::create_from_config(config);
+    ASSERT_EQ(strategies.size(), 1u);
+    auto* band = dynamic_cast<BandStrategy*>(strategies[0].get());
+    ASSERT_NE(band, nullptr);
+    EXPECT_DOUBLE_EQ(band->params->width, 1.5);
+    EXPECT_TRUE(band->params->shorting);
+
+    // A parameter the schema rejects fails the whole set
+    config.strategy_parameters["Band"]["lookback"] = "1";
+    EXPECT_TRUE(winter::strategy::StrategyFactory::create_from_config(config).empty());
+
+    EXPECT_FALSE(winter::utils::ConfigParser::parse("a: 1\na: 2\n", root, error));
+    EXPECT_EQ(error, "line 2: duplicate key 'a'");
+    EXPECT_FALSE(winter::utils::ConfigParser::parse("a:\n  - x\n   y: 1\n", root, error));
+    EXPECT_EQ(error, "line 3: unexpected indentation");
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();